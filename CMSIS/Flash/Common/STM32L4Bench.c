@@ -0,0 +1,483 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Programming benchmark of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4Bench.c
+  * @brief   This file provides the programming benchmark of the algorithms:
+  *          a fixed corpus of images erased, programmed and verified through
+  *          the FlashOS entry points, with a report of the times, the calls
+  *          and the throughput of each image.
+  ******************************************************************************
+  */
+
+#include "..\FlashOS.h"
+#include "STM32L4Bench.h"
+#include <string.h>
+
+#if defined FLASH_BENCHMARK
+
+/* Private constants ---------------------------------------------------------*/
+
+/* The on-chip algorithms do not use the device header, the timer is
+   programmed through its addresses */
+#define BENCH_RCC_CFGR          (*(volatile uint32_t *)0x40021008U)
+#define BENCH_RCC_APB1ENR1      (*(volatile uint32_t *)0x40021058U)
+#define BENCH_RCC_TIM2EN        0x00000001U
+#define BENCH_RCC_PPRE1_Pos     8U
+
+#define BENCH_TIM2_CR1          (*(volatile uint32_t *)0x40000000U)
+#define BENCH_TIM2_EGR          (*(volatile uint32_t *)0x40000014U)
+#define BENCH_TIM2_CNT          (*(volatile uint32_t *)0x40000024U)
+#define BENCH_TIM2_PSC          (*(volatile uint32_t *)0x40000028U)
+#define BENCH_TIM2_ARR          (*(volatile uint32_t *)0x4000002CU)
+
+/* Erase, program and verify steps of FlashOS Init and UnInit */
+#define BENCH_FNC_ERASE         1U
+#define BENCH_FNC_PROGRAM       2U
+#define BENCH_FNC_VERIFY        3U
+
+/* One page of the sparse image out of BENCH_SPARSE_RATIO holds data */
+#define BENCH_SPARSE_RATIO      10U
+
+/* Private types -------------------------------------------------------------*/
+
+/* Time and calls of one step of an image */
+typedef struct
+{
+  uint64_t Ticks;
+  uint32_t Calls;
+  uint32_t Commands;
+} Bench_StepTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Page of the image under programming or verify */
+static uint32_t BenchPage[BENCH_PAGE_MAX / 4U];
+
+/* Frequent Thumb-2 halfwords (push, pop, bx lr, ldr/str, movs, cmp, bne, bl)
+   of the firmware image */
+static const uint16_t BenchOpcodes[16] =
+{
+  0xB580U, 0xBD80U, 0x4770U, 0x6800U, 0x6008U, 0x2000U, 0x2800U, 0xD1FAU,
+  0xF000U, 0xF800U, 0x4618U, 0x3001U, 0x4B00U, 0x681BU, 0x601AU, 0x0000U,
+};
+
+/* Exported variables --------------------------------------------------------*/
+
+/* Report of the last Benchmark call */
+Bench_ReportTypeDef Bench_Report;
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup STM32L4_Loader_Bench_Private_Functions Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Next value of a xorshift generator.
+  * @param  pState: generator state, not 0
+  * @retval Pseudo-random value
+  */
+static uint32_t Bench_Random(uint32_t *pState)
+{
+  uint32_t x = *pState;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *pState = x;
+
+  return x;
+}
+
+/**
+  * @brief  Build a page of an image, from the image and the page offset:
+  *         program and verify build the same data.
+  * @param  Image: BENCH_x image
+  * @param  Offset: offset of the page in the image
+  * @param  Size: size of the page, multiple of 4
+  * @param  ImageSize: size of the image
+  * @param  PageSize: pages of the sparse image
+  * @retval None
+  */
+static void Bench_Fill(uint32_t Image, uint32_t Offset, uint32_t Size, uint32_t ImageSize, uint32_t PageSize)
+{
+  uint32_t state = (Offset ^ (Image << 28)) | 1U;
+  uint32_t n, r;
+
+  if (((Image == BENCH_FIRMWARE) && (Offset >= (ImageSize - (ImageSize / 8U)))) ||
+      ((Image == BENCH_SPARSE) && (((Offset / PageSize) % BENCH_SPARSE_RATIO) != 0U)))
+  {
+    memset(BenchPage, 0xFF, Size);
+    return;
+  }
+
+  for (n = 0; n < (Size / 4U); n++)
+  {
+    r = Bench_Random(&state);
+    if (Image == BENCH_FIRMWARE)
+    {
+      /* Two opcodes, with a random low register or immediate field */
+      r = (uint32_t)(BenchOpcodes[r & 0xFU] | ((r >> 8) & 0x7U)) |
+          ((uint32_t)(BenchOpcodes[(r >> 4) & 0xFU] | ((r >> 12) & 0x7U)) << 16);
+    }
+    BenchPage[n] = r;
+  }
+}
+
+/**
+  * @brief  Size of the sector at an address, from the device description.
+  * @param  pDevice: device description
+  * @param  Address: address in the device
+  * @retval Sector size (in bytes)
+  */
+static uint32_t Bench_SectorSize(const struct FlashDevice *pDevice, uint32_t Address)
+{
+  const struct FlashSectors *sector;
+  uint32_t size = 0;
+
+  Address -= pDevice->DevAdr;
+  for (sector = pDevice->sectors; sector->szSector != 0xFFFFFFFFU; sector++)
+  {
+    if (sector->AddrSector > Address)
+      break;
+    size = sector->szSector;
+  }
+
+  return size;
+}
+
+/**
+  * @brief  Start of the sector at an address, from the device description.
+  * @param  pDevice: device description
+  * @param  Address: address in the device
+  * @retval Sector address
+  */
+static uint32_t Bench_SectorStart(const struct FlashDevice *pDevice, uint32_t Address)
+{
+  const struct FlashSectors *sector;
+  uint32_t offset = Address - pDevice->DevAdr;
+  uint32_t start = 0, size = 1;
+
+  for (sector = pDevice->sectors; sector->szSector != 0xFFFFFFFFU; sector++)
+  {
+    if (sector->AddrSector > offset)
+      break;
+    start = sector->AddrSector;
+    size  = sector->szSector;
+  }
+
+  return pDevice->DevAdr + start + (((offset - start) / size) * size);
+}
+
+/**
+  * @brief  Start TIM2, 32-bit, free running. The DWT cycle counter stops
+  *         while the core of the external loaders sleeps in WFE (unless
+  *         DBGMCU DBG_SLEEP is set).
+  * @param  Hclk: HCLK frequency (Hz)
+  * @retval Timer clock (Hz)
+  */
+static uint32_t Bench_TimerStart(uint32_t Hclk)
+{
+  uint32_t ppre = (BENCH_RCC_CFGR >> BENCH_RCC_PPRE1_Pos) & 0x7U;
+
+  BENCH_RCC_APB1ENR1 |= BENCH_RCC_TIM2EN;
+  (void)BENCH_RCC_APB1ENR1;
+  BENCH_TIM2_CR1 = 0;
+  BENCH_TIM2_PSC = 0;
+  BENCH_TIM2_ARR = 0xFFFFFFFFU;
+  BENCH_TIM2_EGR = 1U;
+  BENCH_TIM2_CR1 = 1U;
+
+  /* The timers run at twice PCLK1 when APB1 is divided */
+  return (ppre < 4U) ? Hclk : (Hclk >> (ppre - 4U));
+}
+
+/**
+  * @brief  Time of a step, in us.
+  * @param  Ticks: timer ticks
+  * @param  Clock: timer clock (Hz)
+  * @retval Time (us)
+  */
+static uint32_t Bench_Time(uint64_t Ticks, uint32_t Clock)
+{
+  return (uint32_t)((Ticks * 1000000U) / Clock);
+}
+
+/**
+  * @brief  Throughput of a step.
+  * @param  Bytes: bytes of the step
+  * @param  Ticks: timer ticks
+  * @param  Clock: timer clock (Hz)
+  * @retval Bytes per second
+  */
+static uint32_t Bench_Rate(uint32_t Bytes, uint64_t Ticks, uint32_t Clock)
+{
+  if (Ticks == 0U)
+    return 0;
+
+  return (uint32_t)(((uint64_t)Bytes * Clock) / Ticks);
+}
+
+/**
+  * @brief  Init or UnInit call of a step, timed.
+  * @param  pAlgo: entry points of the algorithm
+  * @param  Address: device address
+  * @param  Clock: clk of Init
+  * @param  Fnc: BENCH_FNC_x
+  * @param  UnInit: 0 calls Init, 1 calls UnInit
+  * @param  pStep: step
+  * @retval 0 - OK,  1 - Failed
+  */
+static int Bench_Session(const Bench_AlgoTypeDef *pAlgo, uint32_t Address, uint32_t Clock,
+                         uint32_t Fnc, uint32_t UnInit, Bench_StepTypeDef *pStep)
+{
+  uint32_t start = BENCH_TIM2_CNT;
+  int result;
+
+  result = (UnInit == 0U) ? pAlgo->Init(Address, Clock, Fnc) : pAlgo->UnInit(Fnc);
+  pStep->Ticks += BENCH_TIM2_CNT - start;
+
+  /* The commands are counted from Init to the end of UnInit */
+  if ((UnInit != 0U) && (pAlgo->Commands != NULL))
+    pStep->Commands += pAlgo->Commands();
+
+  return result;
+}
+
+/**
+  * @brief  Erase, program and verify an image.
+  * @param  pAlgo: entry points of the algorithm
+  * @param  pDevice: device description
+  * @param  Image: BENCH_x image
+  * @param  Address: start of the image, in the device
+  * @param  Size: size of the image
+  * @param  Clock: clk of Init
+  * @param  TimerClock: timer clock (Hz)
+  * @param  pResult: result of the image
+  * @retval None
+  */
+static void Bench_Image(const Bench_AlgoTypeDef *pAlgo, const struct FlashDevice *pDevice,
+                        uint32_t Image, uint32_t Address, uint32_t Size, uint32_t Clock,
+                        uint32_t TimerClock, Bench_ResultTypeDef *pResult)
+{
+  Bench_StepTypeDef erase, program, verify;
+  uint32_t page, offset, size, adr, start, n;
+  uint8_t *read;
+
+  memset(&erase,   0, sizeof(erase));
+  memset(&program, 0, sizeof(program));
+  memset(&verify,  0, sizeof(verify));
+
+  page = (pDevice->szPage < BENCH_PAGE_MAX) ? pDevice->szPage : BENCH_PAGE_MAX;
+  Size &= ~3U;
+
+  pResult->Address = Address;
+  pResult->Size    = Size;
+
+  /* Erase the sectors covering the image */
+  if (Bench_Session(pAlgo, Address, Clock, BENCH_FNC_ERASE, 0, &erase) != 0)
+  {
+    pResult->Status |= BENCH_FAIL_INIT;
+    return;
+  }
+  for (adr = Bench_SectorStart(pDevice, Address); adr < (Address + Size); adr += Bench_SectorSize(pDevice, adr))
+  {
+    start = BENCH_TIM2_CNT;
+    n = (uint32_t)pAlgo->EraseSector(adr);
+    erase.Ticks += BENCH_TIM2_CNT - start;
+    erase.Calls++;
+    if (n != 0U)
+    {
+      pResult->Status |= BENCH_FAIL_ERASE;
+      break;
+    }
+  }
+  if (Bench_Session(pAlgo, Address, Clock, BENCH_FNC_ERASE, 1, &erase) != 0)
+    pResult->Status |= BENCH_FAIL_INIT;
+
+  /* Program the image page by page, the pages are built outside the
+     measured time */
+  if ((pResult->Status == BENCH_OK) &&
+      (Bench_Session(pAlgo, Address, Clock, BENCH_FNC_PROGRAM, 0, &program) != 0))
+    pResult->Status |= BENCH_FAIL_INIT;
+
+  for (offset = 0; (pResult->Status == BENCH_OK) && (offset < Size); offset += size)
+  {
+    size = ((Size - offset) < page) ? (Size - offset) : page;
+    Bench_Fill(Image, offset, size, Size, page);
+
+    start = BENCH_TIM2_CNT;
+    n = (uint32_t)pAlgo->ProgramPage(Address + offset, size, (unsigned char *)BenchPage);
+    program.Ticks += BENCH_TIM2_CNT - start;
+    program.Calls++;
+    if (n != 0U)
+      pResult->Status |= BENCH_FAIL_PROGRAM;
+  }
+
+  if ((pResult->Status & BENCH_FAIL_INIT) == 0U)
+  {
+    if (Bench_Session(pAlgo, Address, Clock, BENCH_FNC_PROGRAM, 1, &program) != 0)
+      pResult->Status |= BENCH_FAIL_INIT;
+  }
+
+  /* Verify with the algorithm, or read the memory back */
+  if ((pResult->Status == BENCH_OK) &&
+      (Bench_Session(pAlgo, Address, Clock, BENCH_FNC_VERIFY, 0, &verify) != 0))
+    pResult->Status |= BENCH_FAIL_INIT;
+
+  for (offset = 0; (pResult->Status == BENCH_OK) && (offset < Size); offset += size)
+  {
+    size = ((Size - offset) < page) ? (Size - offset) : page;
+    Bench_Fill(Image, offset, size, Size, page);
+    adr = Address + offset;
+
+    start = BENCH_TIM2_CNT;
+    if (pAlgo->Verify != NULL)
+    {
+      n = (pAlgo->Verify(adr, size, (unsigned char *)BenchPage) == (adr + size)) ? 0U : 1U;
+    }
+    else
+    {
+      read = (uint8_t *)adr;
+      n = (memcmp(read, BenchPage, size) == 0) ? 0U : 1U;
+    }
+    verify.Ticks += BENCH_TIM2_CNT - start;
+    verify.Calls++;
+    if (n != 0U)
+      pResult->Status |= BENCH_FAIL_VERIFY;
+  }
+
+  if ((pResult->Status & BENCH_FAIL_INIT) == 0U)
+  {
+    if (Bench_Session(pAlgo, Address, Clock, BENCH_FNC_VERIFY, 1, &verify) != 0)
+      pResult->Status |= BENCH_FAIL_INIT;
+  }
+
+  pResult->EraseTime    = Bench_Time(erase.Ticks,   TimerClock);
+  pResult->ProgramTime  = Bench_Time(program.Ticks, TimerClock);
+  pResult->VerifyTime   = Bench_Time(verify.Ticks,  TimerClock);
+  pResult->EraseCalls   = erase.Calls;
+  pResult->ProgramCalls = program.Calls;
+  pResult->VerifyCalls  = verify.Calls;
+  pResult->Commands     = erase.Commands + program.Commands + verify.Commands;
+  pResult->ProgramRate  = Bench_Rate(Size, program.Ticks, TimerClock);
+  pResult->TotalRate    = Bench_Rate(Size, erase.Ticks + program.Ticks + verify.Ticks, TimerClock);
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup STM32L4_Loader_Bench_Exported_Functions Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Run the corpus through the FlashOS entry points, as a download
+  *         would: Init, EraseSector over the sectors of the image, UnInit,
+  *         then Init, ProgramPage page by page, UnInit, and Init, Verify,
+  *         UnInit. The content of the memory is lost.
+  * @param  pAlgo: entry points of the algorithm
+  * @param  pDevice: device description of the algorithm
+  * @param  Address: start of the images, in the device
+  * @param  Size: size of the dense, firmware and sparse images, 0 runs the
+  *         full-device image alone
+  * @param  Clock: clk of Init, and HCLK (Hz) when pAlgo->Clock is NULL
+  * @retval Status, BENCH_OK or the BENCH_FAIL_x flags of the failed steps;
+  *         the results are in Bench_Report
+  */
+uint32_t Bench_Run(const Bench_AlgoTypeDef *pAlgo, const struct FlashDevice *pDevice,
+                   uint32_t Address, uint32_t Size, uint32_t Clock)
+{
+  Bench_ReportTypeDef *report = &Bench_Report;
+  uint32_t end = pDevice->DevAdr + pDevice->szDev;
+  uint32_t hclk, image;
+
+  memset(report, 0, sizeof(Bench_ReportTypeDef));
+  report->Version  = BENCH_REPORT_VERSION;
+  report->PageSize = (pDevice->szPage < BENCH_PAGE_MAX) ? pDevice->szPage : BENCH_PAGE_MAX;
+
+  if ((Address < pDevice->DevAdr) || (Address >= end))
+  {
+    report->Status = BENCH_FAIL_INIT;
+    return report->Status;
+  }
+  if (Size > (end - Address))
+  {
+    Size = end - Address;
+  }
+
+  /* The external loaders set the system clock up in Init, the timer starts
+     once the clock is final */
+  if ((pAlgo->Init(Address, Clock, BENCH_FNC_VERIFY) != 0) || (pAlgo->UnInit(BENCH_FNC_VERIFY) != 0))
+  {
+    report->Status = BENCH_FAIL_INIT;
+    return report->Status;
+  }
+  hclk = (pAlgo->Clock != NULL) ? pAlgo->Clock() : Clock;
+  report->Clock = Bench_TimerStart(hclk);
+
+  if (Size == 0U)
+  {
+    Bench_Image(pAlgo, pDevice, BENCH_FULL, pDevice->DevAdr, pDevice->szDev, Clock,
+                report->Clock, &report->Result[BENCH_FULL]);
+  }
+  else
+  {
+    for (image = BENCH_DENSE; image <= BENCH_SPARSE; image++)
+    {
+      Bench_Image(pAlgo, pDevice, image, Address, Size, Clock,
+                  report->Clock, &report->Result[image]);
+    }
+
+    /* One sector rewritten in place, over the images above */
+    Bench_Image(pAlgo, pDevice, BENCH_DELTA, Bench_SectorStart(pDevice, Address),
+                Bench_SectorSize(pDevice, Address), Clock, report->Clock, &report->Result[BENCH_DELTA]);
+  }
+
+  BENCH_TIM2_CR1 = 0;
+  BENCH_RCC_APB1ENR1 &= ~BENCH_RCC_TIM2EN;
+
+  for (image = 0; image < BENCH_IMAGES; image++)
+  {
+    report->Status |= report->Result[image].Status;
+  }
+
+  return report->Status;
+}
+
+/**
+  * @}
+  */
+
+#endif /* FLASH_BENCHMARK */
@@ -0,0 +1,119 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Programming benchmark of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4Bench.h
+  * @brief   Header file of STM32L4Bench.c, include it after FlashOS.h
+  ******************************************************************************
+  */
+
+
+#ifndef __STM32L4BENCH_H
+#define __STM32L4BENCH_H
+#include "stdint.h"
+#include <stddef.h>
+
+/* Uncomment this line to add the benchmark (Benchmark entry) to the
+   algorithms, it erases and programs the memory */
+/* #define FLASH_BENCHMARK */
+
+/* Benchmark status, BENCH_OK or the failed steps */
+#define BENCH_OK                0x00U
+#define BENCH_FAIL_INIT         0x01U   /* Init or UnInit                      */
+#define BENCH_FAIL_ERASE        0x02U
+#define BENCH_FAIL_PROGRAM      0x04U
+#define BENCH_FAIL_VERIFY       0x08U   /* read back differs from the image    */
+
+/* Images of the corpus, rebuilt from their seed: only one page is held in RAM */
+#define BENCH_DENSE             0U      /* random data                         */
+#define BENCH_FIRMWARE          1U      /* code-like data, last eighth erased  */
+#define BENCH_SPARSE            2U      /* 90 % of the pages erased            */
+#define BENCH_DELTA             3U      /* one sector of random data           */
+#define BENCH_FULL              4U      /* random data over the whole device   */
+#define BENCH_IMAGES            5U
+
+/* Bytes per ProgramPage call, at most: the largest page of the algorithms
+   (16 kB, FLASH_LARGE_PAGE). The benchmark holds one page in RAM, a build
+   with less RAM defines it smaller, larger pages are then split. */
+#ifndef BENCH_PAGE_MAX
+#define BENCH_PAGE_MAX          0x4000U
+#endif
+#define BENCH_REPORT_VERSION    1U
+
+/* Exported types ------------------------------------------------------------*/
+
+/* FlashOS entry points of the benchmarked algorithm */
+typedef struct
+{
+  int           (*Init)       (unsigned long adr, unsigned long clk, unsigned long fnc);
+  int           (*UnInit)     (unsigned long fnc);
+  int           (*EraseSector)(unsigned long adr);
+  int           (*ProgramPage)(unsigned long adr, unsigned long sz, unsigned char *buf);
+  unsigned long (*Verify)     (unsigned long adr, unsigned long sz, unsigned char *buf);  /* NULL: read back */
+  uint32_t      (*Commands)   (void);   /* memory commands since Init, NULL when not counted */
+  uint32_t      (*Clock)      (void);   /* HCLK after Init (Hz), NULL: clk of Benchmark */
+} Bench_AlgoTypeDef;
+
+/* Result of an image, the times include Init and UnInit like a download */
+typedef struct
+{
+  uint32_t Address;           /* 0 when the image was not run          */
+  uint32_t Size;              /* bytes                                 */
+  uint32_t Status;            /* BENCH_x                               */
+  uint32_t EraseTime;         /* us                                    */
+  uint32_t ProgramTime;
+  uint32_t VerifyTime;
+  uint32_t EraseCalls;        /* EraseSector calls                     */
+  uint32_t ProgramCalls;      /* ProgramPage calls                     */
+  uint32_t VerifyCalls;       /* Verify calls, or pages read back      */
+  uint32_t Commands;          /* memory commands, 0 when not counted   */
+  uint32_t ProgramRate;       /* bytes per second of the programming   */
+  uint32_t TotalRate;         /* bytes per second, erase to verify     */
+} Bench_ResultTypeDef;
+
+/* Report read from the debugger, a fixed array of 32-bit words */
+typedef struct
+{
+  uint32_t Version;           /* BENCH_REPORT_VERSION                  */
+  uint32_t Clock;             /* TIM2 clock of the measures (Hz)       */
+  uint32_t PageSize;          /* bytes per ProgramPage call            */
+  uint32_t Status;            /* BENCH_x of all the images             */
+  Bench_ResultTypeDef Result[BENCH_IMAGES];
+} Bench_ReportTypeDef;
+
+extern Bench_ReportTypeDef Bench_Report;
+
+/* Exported functions --------------------------------------------------------*/
+uint32_t Bench_Run(const Bench_AlgoTypeDef *pAlgo, const struct FlashDevice *pDevice,
+                   uint32_t Address, uint32_t Size, uint32_t Clock);
+
+#endif
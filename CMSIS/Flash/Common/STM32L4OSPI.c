@@ -0,0 +1,416 @@
+/**
+  ******************************************************************************
+  * @file    STM32L4OSPI.c
+  * @author  MCD Application Team
+  * @brief   This file defines the operations of the external loader for
+  *          MX25LM51245G OSPI memory of STM32L4R9I-DK, STM32L4P5G-DK and
+  *          STM32L4R9I-EVAL, wired as described by OSPI_NOR_Board.
+  *           
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+#include "STM32L4OSPI.h"
+#include "STM32L4Tick.h"
+#include <string.h>
+
+
+
+
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup STM32L4_OSPI_Private_Functions Private Functions
+  * @{
+  */
+
+/** @defgroup STM32L4_OSPI_Exported_Functions Exported Functions
+  * @{
+  */
+
+ 
+/* Time spent waiting for the memory by the last operations */
+WaitTime_TypeDef WaitTime;
+
+/* Operations on the memory since Init, and commands counted by the BSP at
+   Init */
+BusCount_TypeDef BusCount;
+static uint32_t  BusCount_Base = 0;
+
+/**
+  * @brief  Record the commands sent to the memory since Init.
+  * @param  None
+  * @retval None
+  */
+static void BusCount_Commands(void)
+{
+  BusCount.Commands = BSP_OSPI_NOR_GetCommandCount() - BusCount_Base;
+}
+
+/**
+  * @brief  Record the wait of the last sector erase.
+  * @param  None
+  * @retval None
+  */
+static void SectorErase_WaitTime(void)
+{
+  WaitTime.SectorErase = BSP_OSPI_NOR_GetWaitTime();
+  if (WaitTime.SectorErase > WaitTime.SectorEraseMax)
+  {
+    WaitTime.SectorEraseMax = WaitTime.SectorErase;
+  }
+}
+
+/**
+  * @brief   Size of the next erase of a range: a 64 KB block when the range
+  *          covers the whole aligned block, a 4 KB sector otherwise.
+  * @param   Address   : next address to erase, 4 KB aligned
+  * @param   EndAddress: end of the range, excluded
+  * @retval  ERASE_BLOCK_SIZE or ERASE_SECTOR_SIZE
+  */
+static uint32_t SectorErase_Size(uint32_t Address, uint32_t EndAddress)
+{
+  if (((Address % ERASE_BLOCK_SIZE) == 0U) && ((EndAddress - Address) >= ERASE_BLOCK_SIZE))
+    return ERASE_BLOCK_SIZE;
+
+  return ERASE_SECTOR_SIZE;
+}
+
+/**
+  * @brief   Send the erase command of a 4 KB sector or a 64 KB block, the
+  *          erase runs when the function returns.
+  * @param   Address: sector or block address
+  * @param   Size   : ERASE_BLOCK_SIZE or ERASE_SECTOR_SIZE
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+static int SectorErase_Start(uint32_t Address, uint32_t Size)
+{
+  BusCount.Erases++;
+
+  if (Size == ERASE_BLOCK_SIZE)
+    return (BSP_OSPI_NOR_Erase_Block_Start(Address) == OSPI_NOR_OK) ? 1 : 0;
+
+  return (BSP_OSPI_NOR_Erase_Sector(Address / ERASE_SECTOR_SIZE) == OSPI_NOR_OK) ? 1 : 0;
+}
+
+
+/**
+  * @brief  System initialization.
+  * @param  None
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+int Init_OSPI()
+{   int32_t result=0;
+
+
+  /* Zero Init structs */
+ 
+  SystemInit(); 
+	   HAL_Init();  
+	  /* Configure the system clock  */
+   SystemClock_Config();
+  memset(&WaitTime, 0, sizeof(WaitTime));
+  memset(&BusCount, 0, sizeof(BusCount));
+  BusCount_Base = BSP_OSPI_NOR_GetCommandCount();
+	/*De-Initializes the OSPI interface.*/
+	BSP_OSPI_NOR_DeInit();
+/*Initialaize OSPI*/
+   if(BSP_OSPI_NOR_Init() !=0)
+    return 0;
+/*Configure the OSPI in memory-mapped mode*/
+   result=BSP_OSPI_NOR_EnableMemoryMappedMode();  
+
+	 if(result==0)
+    return 1; 
+
+   return 0;
+}
+
+/**
+  * @brief   erase memory.
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+
+ int MassErase (void){
+ /*Leave the memory-mapped mode, the memory stays in octal mode*/
+	 if (BSP_OSPI_NOR_DisableMemoryMappedMode() != OSPI_NOR_OK)
+	   return 1;
+	
+	 /*Erases the entire OSPI memory*/
+	 BusCount.Erases++;
+	 if (BSP_OSPI_NOR_Erase_Chip() != OSPI_NOR_OK)
+	   return 1;
+	 WaitTime.ChipErase = BSP_OSPI_NOR_GetWaitTime();
+	 BusCount_Commands();
+
+  /*Reads current status of the OSPI memory*/
+	 if (BSP_OSPI_NOR_GetStatus() != OSPI_NOR_OK)
+	   return 1;
+
+	 return 0;
+ 
+ }
+ 
+ /**
+  * @brief   Program memory.
+  * @param   Address: page address
+  * @param   Size   : size of data
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+ int Write (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  int result;
+
+    Address = Address & 0x0fffffff;
+
+  /* The interface and the memory are configured once by Init_OSPI, a page
+     only needs the indirect mode */
+  if (BSP_OSPI_NOR_DisableMemoryMappedMode() != OSPI_NOR_OK)
+    return 0;
+
+  /* One page program command per memory page spanned */
+  if (Size != 0U)
+  {
+    BusCount.PagePrograms += ((Address + Size - 1U) / MX25LM51245G_PAGE_SIZE) - (Address / MX25LM51245G_PAGE_SIZE) + 1U;
+    BusCount.BytesProgrammed += Size;
+  }
+
+	 /*Writes data to the OSPI memory*/
+    result = (BSP_OSPI_NOR_Write(buffer,Address, Size) == OSPI_NOR_OK) ? 1 : 0;
+
+  BusCount_Commands();
+   return result;
+}
+
+
+/**
+  * @brief   Check the device of FlashDev.c, fixed when the algorithm is
+  *          built, against the memory found by Init_OSPI.
+  * @param   Size      : device size, from the start of the memory
+  * @param   SectorSize: smallest sector of the device
+  * @retval  1      : The memory holds the device
+  * @retval  0      : Smaller memory, or sectors it cannot erase
+  */
+int CheckDevice_OSPI(uint32_t Size, uint32_t SectorSize)
+{
+  OSPI_NOR_Info info;
+
+  if (BSP_OSPI_NOR_GetInfo(&info) != OSPI_NOR_OK)
+    return 0;
+
+  if ((Size > info.FlashSize) || ((SectorSize % ERASE_SECTOR_SIZE) != 0U))
+    return 0;
+
+  return 1;
+}
+
+/**
+  * @brief   Blank check, the memory is read in memory-mapped mode 32 bits
+  *          at a time and the check stops at the first 32-byte line which
+  *          differs from the erased pattern.
+  * @param   Address: start address, in the memory-mapped area
+  * @param   Size   : size of the area
+  * @param   Pattern: content of the erased memory
+  * @retval  1      : Area blank
+  * @retval  0      : Area not blank or operation failed
+  */
+int BlankCheck_OSPI(uint32_t Address, uint32_t Size, uint8_t Pattern)
+{
+  const volatile uint32_t *word;
+  uint32_t blank, n;
+
+  /* Write and erase leave the interface in indirect mode, nothing is done
+     when it is still memory-mapped */
+  if (BSP_OSPI_NOR_EnableMemoryMappedMode() != OSPI_NOR_OK)
+    return 0;
+
+  /* Leading bytes up to the first word */
+  while (((Address & 3U) != 0U) && (Size != 0U))
+  {
+    if (*(const volatile uint8_t *)Address != Pattern)
+      return 0;
+    Address++;
+    Size--;
+  }
+
+  blank = Pattern * 0x01010101U;
+  word  = (const volatile uint32_t *)Address;
+
+  /* One test per 32-byte line, the prefetch of the memory-mapped mode
+     keeps streaming while the line is compared */
+  for (n = Size / 32U; n != 0U; n--)
+  {
+    if (((word[0] ^ blank) | (word[1] ^ blank) | (word[2] ^ blank) | (word[3] ^ blank) |
+         (word[4] ^ blank) | (word[5] ^ blank) | (word[6] ^ blank) | (word[7] ^ blank)) != 0U)
+      return 0;
+    word += 8;
+  }
+
+  for (n = (Size % 32U) / 4U; n != 0U; n--)
+  {
+    if (*word++ != blank)
+      return 0;
+  }
+
+  /* Trailing bytes */
+  Address = (uint32_t)word;
+  for (n = Size & 3U; n != 0U; n--)
+  {
+    if (*(const volatile uint8_t *)Address++ != Pattern)
+      return 0;
+  }
+
+  return 1;
+}
+
+/**
+  * @brief   Sector erase of the 4 KB sectors covering the range, with a
+  *          64 KB block erase for each whole aligned block.
+  * @param   EraseStartAddress :  erase start address
+  * @param   EraseEndAddress   :  erase end address, excluded
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+ int SectorErase (uint32_t EraseStartAddress ,uint32_t EraseEndAddress)
+{
+  uint32_t size;
+
+  EraseEndAddress    = (EraseStartAddress & 0x0FFFFFFF) + (EraseEndAddress - EraseStartAddress);
+  EraseStartAddress &= 0x0FFFFFFF;
+  EraseStartAddress -= EraseStartAddress % ERASE_SECTOR_SIZE;
+  EraseEndAddress   += (ERASE_SECTOR_SIZE - (EraseEndAddress % ERASE_SECTOR_SIZE)) % ERASE_SECTOR_SIZE;
+
+  /*Leave the memory-mapped mode, the memory stays in octal mode*/
+  if (BSP_OSPI_NOR_DisableMemoryMappedMode() != OSPI_NOR_OK)
+    return 0;
+
+  while (EraseStartAddress < EraseEndAddress)
+  {
+    size = SectorErase_Size(EraseStartAddress, EraseEndAddress);
+    if (SectorErase_Start(EraseStartAddress, size) == 0)
+      return 0;
+
+    /*Waits for the end of the erase*/
+    if (BSP_OSPI_NOR_WaitForReady((size == ERASE_BLOCK_SIZE) ? MX25LM51245G_BLOCK_ERASE_MAX_TIME :
+                                                              MX25LM51245G_SECTOR_ERASE_MAX_TIME) != OSPI_NOR_OK)
+      return 0;
+    SectorErase_WaitTime();
+
+    /*Reads current status of the OSPI memory*/
+    if (BSP_OSPI_NOR_GetStatus() != OSPI_NOR_OK)
+      return 0;
+
+    EraseStartAddress += size;
+  }
+
+  /*Configure the OSPI in memory-mapped mode, once for the whole range*/
+  if (BSP_OSPI_NOR_EnableMemoryMappedMode() != OSPI_NOR_OK)
+    return 0;
+
+  BusCount_Commands();
+  return 1;
+}
+
+/**
+  * @brief   End of a session: wait for the last page program and configure
+  *          the OSPI in memory-mapped mode.
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+int UnInit_OSPI(void)
+{
+  /*Configure the OSPI in memory-mapped mode, after the page program*/
+  if (BSP_OSPI_NOR_EnableMemoryMappedMode() != OSPI_NOR_OK)
+    return 0;
+
+  BusCount_Commands();
+  return 1;
+}
+
+/**
+  * @brief  System Clock Configuration
+  *         The system Clock is configured as follows :
+  *            System Clock source            = PLL (MSI)
+  *            SYSCLK(Hz)                     = 2000000 * PLL_N
+  *            HCLK(Hz)                       = 2000000 * PLL_N
+  *            AHB Prescaler                  = 1
+  *            APB1 Prescaler                 = 1
+  *            APB2 Prescaler                 = 1
+  *            MSI Frequency(Hz)              = 4000000
+  *            PLL_M                          = 1
+  *            PLL_N                          = OSPI_NOR_Board.PllN (55 or 60)
+  *            PLL_Q                          = 2
+  *            PLL_R                          = 2
+  *            PLL_P                          = 7
+  *            Flash Latency(WS)              = 5
+  * @param  None
+  * @retval None
+  */
+void SystemClock_Config(void)
+{
+  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+
+  /* Enable voltage range 1 boost mode for frequency above 80 Mhz */
+  __HAL_RCC_PWR_CLK_ENABLE();
+  HAL_PWREx_ControlVoltageScaling(PWR_REGULATOR_VOLTAGE_SCALE1_BOOST);
+  __HAL_RCC_PWR_CLK_DISABLE();
+
+  /* Enable MSI Oscillator and activate PLL with MSI as source */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_MSI;
+  RCC_OscInitStruct.MSIState = RCC_MSI_ON;
+  RCC_OscInitStruct.MSICalibrationValue = RCC_MSICALIBRATION_DEFAULT;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_MSI;
+  RCC_OscInitStruct.MSIClockRange = RCC_MSIRANGE_6;
+  RCC_OscInitStruct.PLL.PLLM = 1;
+  RCC_OscInitStruct.PLL.PLLN = OSPI_NOR_Board.PllN;
+  RCC_OscInitStruct.PLL.PLLR = 2;
+  RCC_OscInitStruct.PLL.PLLQ = 2;
+  RCC_OscInitStruct.PLL.PLLP = 7;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    while(1);
+  }
+  
+  /* To avoid undershoot due to maximum frequency, select PLL as system clock source */
+  /* with AHB prescaler divider 2 as first step */
+  RCC_ClkInitStruct.ClockType = (RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2);
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV2;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;  
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;  
+  if(HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_3) != HAL_OK)
+  {
+     while(1);
+  }
+
+  /* AHB prescaler divider at 1 as second step */
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  if(HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5) != HAL_OK)
+  {
+     while(1);
+  }
+}
+
+
+
+
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file    STM32L4OSPI.h
+  * @author  MCD Application Team
+  * @brief   Header file of STM32L4OSPI.c
+  *           
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+
+#ifndef __STM32L4OSPI_H
+#define __STM32L4OSPI_H
+#include "stdint.h"
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l4xx_hal.h"
+#include "STM32L4OSPIBoard.h"
+#include "STM32L4Sfdp.h"
+#include "./mx25lm51245g/mx25lm51245g.h"
+
+#define TIMEOUT 5000U
+
+/* Uncomment this line to drive the OctoSPI with the register-level driver
+   (stm32l4xx_ospi_nor_lean.c) instead of the HAL driver, without SFDP
+   configuration and clock calibration. The *_Lean targets define it and
+   leave the HAL OSPI and DMA drivers out of the build. */
+/* #define OSPI_NOR_LEAN */
+
+#define ERASE_BLOCK_SIZE        0x10000U   /* MX25LM51245G_BLOCK_SIZE                   */
+#define ERASE_SECTOR_SIZE       0x1000U    /* MX25LM51245G_SECTOR_SIZE                  */
+#define ERASE_SUSPEND_LATENCY   25U        /* us, tESL: suspend command to suspend ready */
+#define ERASE_SUSPEND_TIMEOUT   1U         /* ms, ERASE_SUSPEND_LATENCY with margin      */
+
+
+/* Time spent waiting for the memory, in us. Reset by Init, read from the
+   debugger to profile the erase operations */
+typedef struct
+{
+  uint32_t ChipErase;         /* last chip erase                  */
+  uint32_t SectorErase;       /* last 4 KB sector or 64 KB block erase */
+  uint32_t SectorEraseMax;    /* longest of them since Init       */
+} WaitTime_TypeDef;
+
+extern WaitTime_TypeDef WaitTime;
+
+/* Operations on the memory since Init, read from the debugger with WaitTime
+   to compare the bus activity of downloads */
+typedef struct
+{
+  uint32_t Commands;          /* commands sent, a status polling counts once */
+  uint32_t PagePrograms;      /* page program commands            */
+  uint32_t BytesProgrammed;
+  uint32_t Erases;            /* sector, block and chip erases    */
+} BusCount_TypeDef;
+
+extern BusCount_TypeDef BusCount;
+
+/* OctoSPI GPIOs of the board, the pins of a port share the pull and the
+   alternate function */
+typedef struct
+{
+  GPIO_TypeDef *Port;         /* NULL ends the table              */
+  uint32_t      Pins;
+  uint32_t      Pull;
+  uint32_t      Alternate;
+} OSPI_NOR_GpioTypeDef;
+
+#define OSPI_NOR_GPIO_MAX       8U
+
+/* Index of a GPIO port, from GPIOA */
+#define OSPI_NOR_GPIO_INDEX(port)  (((uint32_t)(port) - GPIOA_BASE) / (GPIOB_BASE - GPIOA_BASE))
+
+/* Board wiring of the MX25LM51245G, the only difference between the loaders */
+typedef struct
+{
+  OCTOSPI_TypeDef     *Instance;        /* OCTOSPI1 or OCTOSPI2                       */
+  uint32_t             ClockPrescaler;  /* slowest OctoSPI clock = SYSCLK / ClockPrescaler */
+  uint32_t             PllN;            /* SYSCLK = 4 MHz MSI * PllN / 2              */
+  uint8_t              Dtr;             /* 1: octal DTR (DOPI) tried before octal STR */
+  OSPIM_CfgTypeDef     Ospim;           /* IO Manager, ClkPort 0 keeps the reset mapping */
+  OSPI_NOR_GpioTypeDef Gpio[OSPI_NOR_GPIO_MAX + 1U];
+  GPIO_TypeDef        *CsPort;          /* input, no pull after DeInit                */
+  uint32_t             CsPin;
+  GPIO_TypeDef        *IdleLowPort;     /* output low after DeInit                    */
+  uint32_t             IdleLowPin;
+} OSPI_NOR_BoardTypeDef;
+
+extern const OSPI_NOR_BoardTypeDef OSPI_NOR_Board;
+
+/* Private function prototypes -----------------------------------------------*/
+int Init_OSPI(void);
+ int Write (uint32_t Address, uint32_t Size, uint8_t* buffer);
+ int SectorErase (uint32_t EraseStartAddress ,uint32_t EraseEndAddress);
+ int MassErase ( void);
+int BlankCheck_OSPI(uint32_t Address, uint32_t Size, uint8_t Pattern);
+int CheckDevice_OSPI(uint32_t Size, uint32_t SectorSize);
+void SystemClock_Config(void);
+int UnInit_OSPI(void);
+
+/* BSP extensions, not declared by the board BSP header ----------------------*/
+uint8_t  BSP_OSPI_NOR_Erase_Block_Start(uint32_t BlockAddress);
+uint8_t  BSP_OSPI_NOR_WaitForReady(uint32_t Timeout);
+uint32_t BSP_OSPI_NOR_GetWaitTime(void);
+uint32_t BSP_OSPI_NOR_GetCommandCount(void);
+uint8_t  BSP_OSPI_NOR_DisableMemoryMappedMode(void);
+#if !defined OSPI_NOR_LEAN
+extern OSPI_HandleTypeDef OSPINORHandle;
+uint8_t  BSP_OSPI_NOR_GetSFDP(SFDP_InfoTypeDef *pInfo);
+#endif
+
+#endif
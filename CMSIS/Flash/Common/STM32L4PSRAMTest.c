@@ -0,0 +1,407 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Self-test of the ST STM32L4 PSRAM loaders
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4PSRAMTest.c
+  * @brief   This file provides the self-test of the PSRAM loaders: integrity
+  *          tests of the memory and bandwidth of its access paths.
+  ******************************************************************************
+  */
+
+#include "STM32L4PSRAMTest.h"
+#include "STM32L4Tick.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define PSRAM_TEST_WORD(adr)    (*(__IO uint32_t *)(adr))
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Transfer buffers of the sweeps, word aligned for the DMA paths */
+static uint32_t TestTxBuffer[PSRAM_TEST_BLOCK_SIZE / 4U];
+static uint32_t TestRxBuffer[PSRAM_TEST_BLOCK_SIZE / 4U];
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup STM32L4_Loader_PSRAM_Test_Private_Functions Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Record the first failure of the integrity tests.
+  * @param  pReport: test report
+  * @param  Test: PSRAM_TEST_x flag of the failed test
+  * @param  Address: failing address
+  * @param  Expected: value written
+  * @param  Read: value read back
+  * @retval None
+  */
+static void PSRAM_Test_Fail(PSRAM_Test_ReportTypeDef *pReport, uint32_t Test,
+                            uint32_t Address, uint32_t Expected, uint32_t Read)
+{
+  if (pReport->Status == PSRAM_TEST_OK)
+  {
+    pReport->FailAddress  = Address;
+    pReport->FailExpected = Expected;
+    pReport->FailRead     = Read;
+  }
+  pReport->Status |= Test;
+}
+
+/**
+  * @brief  Walking ones on the data bus, at the base address.
+  * @param  Base: memory-mapped address of the memory
+  * @param  pReport: test report
+  * @retval None
+  */
+static void PSRAM_Test_DataBus(uint32_t Base, PSRAM_Test_ReportTypeDef *pReport)
+{
+  uint32_t pattern, read;
+
+  for (pattern = 1U; pattern != 0U; pattern <<= 1)
+  {
+    PSRAM_TEST_WORD(Base) = pattern;
+    read = PSRAM_TEST_WORD(Base);
+    if (read != pattern)
+    {
+      PSRAM_Test_Fail(pReport, PSRAM_TEST_DATA_BUS, Base, pattern, read);
+      return;
+    }
+  }
+}
+
+/**
+  * @brief  Address lines stuck or shorted: one word at each power of two
+  *         offset, each of them must be written alone.
+  * @param  Base: memory-mapped address of the memory
+  * @param  Size: size of the tested area, in bytes
+  * @param  pReport: test report
+  * @retval None
+  */
+static void PSRAM_Test_AddressBus(uint32_t Base, uint32_t Size, PSRAM_Test_ReportTypeDef *pReport)
+{
+  uint32_t offset, test, read;
+
+  for (offset = 4U; offset < Size; offset <<= 1)
+  {
+    PSRAM_TEST_WORD(Base + offset) = 0xAAAAAAAAU;
+  }
+  PSRAM_TEST_WORD(Base) = 0x55555555U;
+
+  /* Address lines stuck high */
+  for (offset = 4U; offset < Size; offset <<= 1)
+  {
+    read = PSRAM_TEST_WORD(Base + offset);
+    if (read != 0xAAAAAAAAU)
+    {
+      PSRAM_Test_Fail(pReport, PSRAM_TEST_ADDRESS_BUS, Base + offset, 0xAAAAAAAAU, read);
+      return;
+    }
+  }
+
+  /* Address lines stuck low or shorted */
+  for (test = 4U; test < Size; test <<= 1)
+  {
+    PSRAM_TEST_WORD(Base + test) = 0x55555555U;
+
+    read = PSRAM_TEST_WORD(Base);
+    if (read != 0x55555555U)
+    {
+      PSRAM_Test_Fail(pReport, PSRAM_TEST_ADDRESS_BUS, Base, 0x55555555U, read);
+      return;
+    }
+
+    for (offset = 4U; offset < Size; offset <<= 1)
+    {
+      read = PSRAM_TEST_WORD(Base + offset);
+      if ((offset != test) && (read != 0xAAAAAAAAU))
+      {
+        PSRAM_Test_Fail(pReport, PSRAM_TEST_ADDRESS_BUS, Base + offset, 0xAAAAAAAAU, read);
+        return;
+      }
+    }
+
+    PSRAM_TEST_WORD(Base + test) = 0xAAAAAAAAU;
+  }
+}
+
+/**
+  * @brief  March C- over the tested area, with all-zero and all-one words:
+  *         up(w0) up(r0,w1) up(r1,w0) down(r0,w1) down(r1,w0) down(r0).
+  * @param  Base: memory-mapped address of the memory
+  * @param  Size: size of the tested area, in bytes
+  * @param  pReport: test report
+  * @retval None
+  */
+static void PSRAM_Test_March(uint32_t Base, uint32_t Size, PSRAM_Test_ReportTypeDef *pReport)
+{
+  static const uint32_t expect[5] = { 0x00000000U, 0xFFFFFFFFU, 0x00000000U, 0xFFFFFFFFU, 0x00000000U };
+  uint32_t element, i, adr, read;
+  uint32_t words = Size / 4U;
+
+  for (i = 0U; i < words; i++)
+  {
+    PSRAM_TEST_WORD(Base + (i * 4U)) = 0x00000000U;
+  }
+
+  for (element = 0U; element < 5U; element++)
+  {
+    for (i = 0U; i < words; i++)
+    {
+      /* The first two read-write elements go up, the others go down */
+      adr = (element < 2U) ? (Base + (i * 4U)) : (Base + Size - 4U - (i * 4U));
+
+      read = PSRAM_TEST_WORD(adr);
+      if (read != expect[element])
+      {
+        PSRAM_Test_Fail(pReport, PSRAM_TEST_MARCH, adr, expect[element], read);
+        return;
+      }
+      if (element < 4U)
+      {
+        PSRAM_TEST_WORD(adr) = ~expect[element];
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Start the timer of the sweeps: TIM2, 32-bit, at the timer clock.
+  *         The DWT cycle counter stops while the core sleeps in WFE during
+  *         the DMA transfers (unless DBGMCU DBG_SLEEP is set).
+  * @retval Timer clock (Hz)
+  */
+static uint32_t PSRAM_Test_TimerStart(void)
+{
+  __HAL_RCC_TIM2_CLK_ENABLE();
+  TIM2->CR1 = 0;
+  TIM2->PSC = 0;
+  TIM2->ARR = 0xFFFFFFFFU;
+  TIM2->EGR = TIM_EGR_UG;
+  TIM2->SR  = 0;
+  TIM2->CR1 = TIM_CR1_CEN;
+
+  return Tick_TimerClock();
+}
+
+/**
+  * @brief  Bytes per second of a timed sweep.
+  * @param  Bytes: bytes moved
+  * @param  Ticks: timer ticks elapsed
+  * @param  Clock: timer clock (Hz)
+  * @retval Bandwidth, in bytes per second
+  */
+static uint32_t PSRAM_Test_Bandwidth(uint32_t Bytes, uint32_t Ticks, uint32_t Clock)
+{
+  if (Ticks == 0U)
+  {
+    Ticks = 1U;
+  }
+  return (uint32_t)(((uint64_t)Bytes * Clock) / Ticks);
+}
+
+/**
+  * @brief  Next block of the random sweeps, xorshift32.
+  * @param  pSeed: generator state, not 0
+  * @param  Blocks: number of blocks of the tested area
+  * @retval Block index
+  */
+static uint32_t PSRAM_Test_Random(uint32_t *pSeed, uint32_t Blocks)
+{
+  uint32_t x = *pSeed;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *pSeed = x;
+
+  return x % Blocks;
+}
+
+/**
+  * @brief  Timed sequential and random sweeps of one access path. The data
+  *         read back is checked outside of the timed loops.
+  * @param  pPath: access path
+  * @param  Path: PSRAM_TEST_x index of the path
+  * @param  Base: memory-mapped address of the memory
+  * @param  Size: size of the tested area, in bytes
+  * @param  Clock: timer clock (Hz)
+  * @param  pReport: test report
+  * @retval None
+  */
+static void PSRAM_Test_Sweep(const PSRAM_Test_PathTypeDef *pPath, uint32_t Path, uint32_t Base,
+                             uint32_t Size, uint32_t Clock, PSRAM_Test_ReportTypeDef *pReport)
+{
+  PSRAM_Test_BandwidthTypeDef *bw = &pReport->Bandwidth[Path];
+  uint32_t blocks = Size / PSRAM_TEST_BLOCK_SIZE;
+  uint32_t count  = PSRAM_TEST_SWEEP_SIZE / PSRAM_TEST_BLOCK_SIZE;
+  uint32_t bytes, start, seed, block, i;
+
+  if ((pPath->Write == NULL) || (pPath->Read == NULL) || (blocks == 0U))
+  {
+    return;
+  }
+  if (count > blocks)
+  {
+    count = blocks;
+  }
+  bytes = count * PSRAM_TEST_BLOCK_SIZE;
+
+  for (i = 0U; i < (PSRAM_TEST_BLOCK_SIZE / 4U); i++)
+  {
+    TestTxBuffer[i] = (i * 0x9E3779B9U) ^ (Path << 24);
+  }
+
+  /* Sequential write and read */
+  start = TIM2->CNT;
+  for (block = 0U; block < count; block++)
+  {
+    if (pPath->Write(Base + (block * PSRAM_TEST_BLOCK_SIZE), PSRAM_TEST_BLOCK_SIZE, (uint8_t *)TestTxBuffer) != 1)
+    {
+      pReport->Status |= PSRAM_TEST_PATH;
+      return;
+    }
+  }
+  bw->SeqWrite = PSRAM_Test_Bandwidth(bytes, TIM2->CNT - start, Clock);
+
+  start = TIM2->CNT;
+  for (block = 0U; block < count; block++)
+  {
+    if (pPath->Read(Base + (block * PSRAM_TEST_BLOCK_SIZE), PSRAM_TEST_BLOCK_SIZE, (uint8_t *)TestRxBuffer) != 1)
+    {
+      pReport->Status |= PSRAM_TEST_PATH;
+      return;
+    }
+  }
+  bw->SeqRead = PSRAM_Test_Bandwidth(bytes, TIM2->CNT - start, Clock);
+
+  if (memcmp(TestTxBuffer, TestRxBuffer, PSRAM_TEST_BLOCK_SIZE) != 0)
+  {
+    pReport->Status |= PSRAM_TEST_PATH;
+    return;
+  }
+
+  /* Random write and read, over the whole tested area */
+  seed  = 0x2545F491U;
+  start = TIM2->CNT;
+  for (i = 0U; i < count; i++)
+  {
+    block = PSRAM_Test_Random(&seed, blocks);
+    if (pPath->Write(Base + (block * PSRAM_TEST_BLOCK_SIZE), PSRAM_TEST_BLOCK_SIZE, (uint8_t *)TestTxBuffer) != 1)
+    {
+      pReport->Status |= PSRAM_TEST_PATH;
+      return;
+    }
+  }
+  bw->RandomWrite = PSRAM_Test_Bandwidth(bytes, TIM2->CNT - start, Clock);
+
+  /* The same blocks, all of them hold the pattern */
+  seed  = 0x2545F491U;
+  start = TIM2->CNT;
+  for (i = 0U; i < count; i++)
+  {
+    block = PSRAM_Test_Random(&seed, blocks);
+    if (pPath->Read(Base + (block * PSRAM_TEST_BLOCK_SIZE), PSRAM_TEST_BLOCK_SIZE, (uint8_t *)TestRxBuffer) != 1)
+    {
+      pReport->Status |= PSRAM_TEST_PATH;
+      return;
+    }
+  }
+  bw->RandomRead = PSRAM_Test_Bandwidth(bytes, TIM2->CNT - start, Clock);
+
+  if (memcmp(TestTxBuffer, TestRxBuffer, PSRAM_TEST_BLOCK_SIZE) != 0)
+  {
+    pReport->Status |= PSRAM_TEST_PATH;
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup STM32L4_Loader_PSRAM_Test_Exported_Functions Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Run the integrity tests, then measure the bandwidth of each access
+  *         path. The integrity tests access the memory with the core, it must
+  *         be memory-mapped when this function is called: the paths restore
+  *         the mode they need themselves.
+  * @param  pPaths: PSRAM_TEST_PATHS access paths, indexed by PSRAM_TEST_x
+  * @param  Base: memory-mapped address of the tested area
+  * @param  Size: size of the tested area, in bytes (multiple of 4)
+  * @param  pReport: test report, filled by this function
+  * @retval Status, PSRAM_TEST_OK or the PSRAM_TEST_x flags of the failed tests
+  */
+uint32_t PSRAM_Test_Run(const PSRAM_Test_PathTypeDef *pPaths, uint32_t Base, uint32_t Size,
+                        PSRAM_Test_ReportTypeDef *pReport)
+{
+  uint32_t clock, path;
+
+  memset(pReport, 0, sizeof(PSRAM_Test_ReportTypeDef));
+  Size &= ~3U;
+  pReport->Size  = Size;
+  pReport->Clock = HAL_RCC_GetHCLKFreq();
+
+  if (Size < 4U)
+  {
+    return pReport->Status;
+  }
+
+  PSRAM_Test_DataBus(Base, pReport);
+  PSRAM_Test_AddressBus(Base, Size, pReport);
+  PSRAM_Test_March(Base, Size, pReport);
+
+  /* A memory that fails the integrity tests gives meaningless bandwidths */
+  if (pReport->Status != PSRAM_TEST_OK)
+  {
+    return pReport->Status;
+  }
+
+  clock = PSRAM_Test_TimerStart();
+
+  /* The memory-mapped path first, the others may leave the mode */
+  PSRAM_Test_Sweep(&pPaths[PSRAM_TEST_MAPPED], PSRAM_TEST_MAPPED, Base, Size, clock, pReport);
+  for (path = 0U; path < PSRAM_TEST_MAPPED; path++)
+  {
+    PSRAM_Test_Sweep(&pPaths[path], path, Base, Size, clock, pReport);
+  }
+
+  TIM2->CR1 = 0;
+  __HAL_RCC_TIM2_CLK_DISABLE();
+
+  return pReport->Status;
+}
+
+/**
+  * @}
+  */
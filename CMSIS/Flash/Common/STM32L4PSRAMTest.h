@@ -0,0 +1,98 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Self-test of the ST STM32L4 PSRAM loaders
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4PSRAMTest.h
+  * @brief   Header file of STM32L4PSRAMTest.c
+  ******************************************************************************
+  */
+
+
+#ifndef __STM32L4PSRAMTEST_H
+#define __STM32L4PSRAMTEST_H
+#include "stdint.h"
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l4xx_hal.h"
+#include <string.h>
+
+/* Self-test status, PSRAM_TEST_OK or the failed tests */
+#define PSRAM_TEST_OK           0x00U
+#define PSRAM_TEST_DATA_BUS     0x01U   /* walking ones                        */
+#define PSRAM_TEST_ADDRESS_BUS  0x02U   /* address lines stuck or shorted      */
+#define PSRAM_TEST_MARCH        0x04U   /* March C- over the tested area       */
+#define PSRAM_TEST_PATH         0x08U   /* an access path failed or read wrong */
+
+/* Access paths, the bandwidth is measured for each of them */
+#define PSRAM_TEST_POLLING      0U
+#define PSRAM_TEST_DMA          1U
+#define PSRAM_TEST_MAPPED       2U
+#define PSRAM_TEST_PATHS        3U
+
+#define PSRAM_TEST_BLOCK_SIZE   1024U     /* bytes per transfer of the sweeps */
+#define PSRAM_TEST_SWEEP_SIZE   0x40000U  /* bytes moved by each timed sweep  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Transfers Size bytes between the memory at Address and pData, returns 1
+   on success like the loader Write function */
+typedef int (*PSRAM_Test_XferFuncTypeDef)(uint32_t Address, uint32_t Size, uint8_t *pData);
+
+typedef struct
+{
+  PSRAM_Test_XferFuncTypeDef Write;   /* NULL when the path does not exist */
+  PSRAM_Test_XferFuncTypeDef Read;
+} PSRAM_Test_PathTypeDef;
+
+typedef struct
+{
+  uint32_t SeqWrite;          /* bytes per second, 0 when not measured */
+  uint32_t SeqRead;
+  uint32_t RandomWrite;
+  uint32_t RandomRead;
+} PSRAM_Test_BandwidthTypeDef;
+
+typedef struct
+{
+  uint32_t Status;            /* PSRAM_TEST_x                          */
+  uint32_t FailAddress;       /* first failure of the integrity tests  */
+  uint32_t FailExpected;
+  uint32_t FailRead;
+  uint32_t Size;              /* bytes tested                          */
+  uint32_t Clock;             /* HCLK frequency of the measures (Hz)   */
+  PSRAM_Test_BandwidthTypeDef Bandwidth[PSRAM_TEST_PATHS];
+} PSRAM_Test_ReportTypeDef;
+
+/* Exported functions --------------------------------------------------------*/
+uint32_t PSRAM_Test_Run(const PSRAM_Test_PathTypeDef *pPaths, uint32_t Base, uint32_t Size,
+                        PSRAM_Test_ReportTypeDef *pReport);
+
+#endif
@@ -0,0 +1,457 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 ARM Ltd.
+#
+# This software is provided 'as-is', without any express or implied warranty.
+# In no event will the authors be held liable for any damages arising from
+# the use of this software. Permission is granted to anyone to use this
+# software for any purpose, including commercial applications, and to alter
+# it and redistribute it freely, subject to the following restrictions:
+#
+# 1. The origin of this software must not be misrepresented; you must not
+#    claim that you wrote the original software. If you use this software in
+#    a product, an acknowledgment in the product documentation would be
+#    appreciated but is not required.
+#
+# 2. Altered source versions must be plainly marked as such, and must not be
+#    misrepresented as being the original software.
+#
+# 3. This notice may not be removed or altered from any source distribution.
+#
+#
+# $Date:        19. October 2026
+# $Revision:    V1.0.0
+#
+# Project:      Programming plan generator of the ST STM32L4 Flash algorithms
+#
+"""Plan the programming of an image with a flash algorithm.
+
+The algorithms only see one page at a time. This tool reads the image (ELF,
+Intel HEX or binary) and the FlashDevice of a FlashDev.c variant, and plans
+the download before it starts:
+
+  - the sectors to erase, merged in ranges (EraseChip when all are erased)
+  - the program spans: rows holding only the erased value are dropped, the
+    spans are aligned to the row and split at the programming pages
+  - the CRC of each erased sector once programmed, to skip the sectors that
+    already hold it or to check them after the download
+  - the payload of each span, run-length compressed when it is smaller
+  - the buffer of ProgramScatter (STM32L4Scatter.c), to program all the
+    spans in one call of the algorithm
+
+    STM32L4Plan.py ../STM32L4xx/FlashDev.c -D FLASH_MEM -D STM32L4x_1024 app.elf
+    STM32L4Plan.py ../N25Q128A_STM32L476G-DISCO/FlashDev.c -D FLASH_MEM app.hex -o plan.json
+    STM32L4Plan.py ../STM32L4Rx/FlashDev.c -D FLASH_MEM -D STM32L4Rx_2048_DB app.elf --scatter app.sg
+
+The CRC is CRC-32/MPEG-2 (polynomial 0x04C11DB7, initial 0xFFFFFFFF, no
+reflection, no final XOR): the default of the CRC unit of the STM32L4 fed
+with bytes. The run-length encoding is PackBits: a control byte n, then
+n+1 literal bytes when n < 128, or one byte repeated 257-n times.
+"""
+
+import argparse
+import base64
+import json
+import os
+import re
+import struct
+import sys
+
+SECTOR_END = 0xFFFFFFFF
+
+DEVICE_TYPES = {0: "UNKNOWN", 1: "ONCHIP", 2: "EXT8BIT", 3: "EXT16BIT",
+                4: "EXT32BIT", 5: "EXTSPI"}
+
+
+# FlashDev.c ------------------------------------------------------------------
+
+def strip_comments(text):
+    """Remove the C comments, keeping the strings."""
+    pattern = re.compile(r'"(\\.|[^"\\])*"|/\*.*?\*/|//[^\n]*', re.S)
+    return pattern.sub(lambda m: m.group(0) if m.group(0)[0] == '"' else " ", text)
+
+
+def find_include(base, name):
+    """Path of an include of the Keil sources ("..\\FlashOS.H")."""
+    path = os.path.join(os.path.dirname(base), *name.replace("\\", "/").split("/"))
+    if os.path.exists(path):
+        return path
+    folder = os.path.dirname(path)
+    for entry in os.listdir(folder) if os.path.isdir(folder) else []:
+        if entry.lower() == os.path.basename(path).lower():
+            return os.path.join(folder, entry)
+    raise SystemExit("error: %s: include %s not found" % (base, name))
+
+
+def condition(expr, defines):
+    """Value of an #if expression made of defined(), !, && and ||."""
+    expr = re.sub(r"defined\s*\(?\s*(\w+)\s*\)?",
+                  lambda m: " True " if m.group(1) in defines else " False ", expr)
+    expr = re.sub(r"\b[A-Za-z_]\w*\b",
+                  lambda m: m.group(0) if m.group(0) in ("True", "False")
+                  else " (%s) " % defines.get(m.group(0), "0"), expr)
+    expr = expr.replace("&&", " and ").replace("||", " or ")
+    expr = re.sub(r"!(?!=)", " not ", expr)
+    expr = re.sub(r"\b(0x[0-9A-Fa-f]+|\d+)[uUlL]+\b", r"\1", expr)
+    try:
+        return bool(eval(expr, {"__builtins__": {}}))
+    except Exception:
+        raise SystemExit("error: unsupported #if %s" % expr)
+
+
+def preprocess(path, defines):
+    """Active lines of a source file, the #define are added to defines."""
+    text = strip_comments(open(path, encoding="latin-1").read())
+    text = text.replace("\\\n", " ")
+    output = []
+    stack = []                                  # (active, taken) per #if
+    for line in text.splitlines():
+        active = all(level[0] for level in stack)
+        directive = re.match(r"\s*#\s*(\w+)\s*(.*)", line)
+        if not directive:
+            if active:
+                output.append(line)
+            continue
+        name, rest = directive.group(1), directive.group(2).strip()
+        if name in ("ifdef", "ifndef", "if"):
+            if name == "ifdef":
+                value = rest in defines
+            elif name == "ifndef":
+                value = rest not in defines
+            else:
+                value = active and condition(rest, defines)
+            stack.append([value, value])
+        elif name == "elif":
+            value = not stack[-1][1] and condition(rest, defines)
+            stack[-1] = [value, stack[-1][1] or value]
+        elif name == "else":
+            stack[-1] = [not stack[-1][1], True]
+        elif name == "endif":
+            stack.pop()
+        elif not active:
+            continue
+        elif name == "define":
+            macro = re.match(r"(\w+)(\(.*?\))?\s*(.*)", rest)
+            if not macro.group(2):              # function-like macros are not used
+                defines[macro.group(1)] = macro.group(3).strip()
+        elif name == "undef":
+            defines.pop(rest, None)
+        elif name == "include":
+            include = re.match(r'"(.+)"', rest)
+            if include:
+                output.extend(preprocess(find_include(path, include.group(1)), defines))
+    return output
+
+
+def expand(text, defines, depth=0):
+    """Replace the macros of an expression."""
+    if depth > 16:
+        return text
+    result = re.sub(r'"(\\.|[^"\\])*"|\b[A-Za-z_]\w*\b',
+                    lambda m: m.group(0) if m.group(0)[0] == '"'
+                    else " %s " % defines.get(m.group(0), m.group(0)), text)
+    return result if result == text else expand(result, defines, depth + 1)
+
+
+def split_items(text):
+    """Split an initializer at its top-level commas."""
+    items, level, current, string = [], 0, "", False
+    for i, char in enumerate(text):
+        if char == '"' and (i == 0 or text[i - 1] != "\\"):
+            string = not string
+        if not string:
+            if char in "({":
+                level += 1
+            elif char in ")}":
+                level -= 1
+            elif char == "," and level == 0:
+                items.append(current.strip())
+                current = ""
+                continue
+        current += char
+    if current.strip():
+        items.append(current.strip())
+    return items
+
+
+def number(text):
+    """Value of an integer constant expression."""
+    text = re.sub(r"\b(0x[0-9A-Fa-f]+|\d+)[uUlL]+\b", r"\1", text)
+    if not re.fullmatch(r"[\s0-9A-Fa-fxX()+\-*/<>|&~]*", text):
+        raise SystemExit("error: FlashDevice value %r is not a constant" % text.strip())
+    return eval(text.replace("/", "//"), {"__builtins__": {}}) & 0xFFFFFFFF
+
+
+def flash_device(path, defines):
+    """FlashDevice of a FlashDev.c variant, as a dictionary."""
+    source = "\n".join(preprocess(path, defines))
+    match = re.search(r"struct\s+FlashDevice\s+const\s+FlashDevice\s*=\s*\{(.*?)\}\s*;",
+                      source, re.S)
+    if not match:
+        raise SystemExit("error: %s: no FlashDevice with these defines" % path)
+    items = split_items(expand(match.group(1), defines))
+    name = "".join(re.findall(r'"((?:\\.|[^"\\])*)"', items[1]))
+    values = [number(item) for item in items[2:]]
+    device = {
+        "name": name,
+        "type": DEVICE_TYPES.get(values[0], str(values[0])),
+        "address": values[1],
+        "size": values[2],
+        "page": values[3],
+        "empty": values[5] & 0xFF,
+        "sectors": [],
+    }
+    for i in range(8, len(values) - 1, 2):
+        if values[i] == SECTOR_END:
+            break
+        device["sectors"].append((values[i + 1], values[i]))      # (offset, size)
+    return device
+
+
+def sector_of(device, offset):
+    """(offset, size) of the sector holding an offset of the device."""
+    sectors = device["sectors"]
+    for i, (start, size) in enumerate(sectors):
+        end = sectors[i + 1][0] if i + 1 < len(sectors) else device["size"]
+        if start <= offset < end:
+            return start + (offset - start) // size * size, size
+    raise ValueError(offset)
+
+
+# Images ----------------------------------------------------------------------
+
+def load_elf(data):
+    """Bytes of the loadable segments of an ELF file, at their load address."""
+    if data[4] != 1:
+        raise SystemExit("error: only 32-bit ELF files are supported")
+    endian = "<" if data[5] == 1 else ">"
+    phoff, = struct.unpack_from(endian + "I", data, 28)
+    phentsize, phnum = struct.unpack_from(endian + "HH", data, 42)
+    image = {}
+    for i in range(phnum):
+        ptype, offset, _, paddr, filesz = struct.unpack_from(
+            endian + "IIIII", data, phoff + i * phentsize)
+        if ptype == 1 and filesz:                               # PT_LOAD
+            for j in range(filesz):
+                image[paddr + j] = data[offset + j]
+    return image
+
+
+def load_hex(text):
+    """Bytes of an Intel HEX file."""
+    image, base = {}, 0
+    for number_, line in enumerate(text.splitlines(), 1):
+        line = line.strip()
+        if not line:
+            continue
+        if line[0] != ":":
+            raise SystemExit("error: line %d is not an Intel HEX record" % number_)
+        record = bytes.fromhex(line[1:])
+        if sum(record) & 0xFF:
+            raise SystemExit("error: line %d has a wrong checksum" % number_)
+        count, address, kind = record[0], (record[1] << 8) | record[2], record[3]
+        payload = record[4:4 + count]
+        if kind == 0:
+            for j, byte in enumerate(payload):
+                image[base + address + j] = byte
+        elif kind == 1:
+            break
+        elif kind == 2:
+            base = int.from_bytes(payload, "big") << 4
+        elif kind == 4:
+            base = int.from_bytes(payload, "big") << 16
+    return image
+
+
+def load_image(path, base):
+    """Image as a dictionary address: byte."""
+    data = open(path, "rb").read()
+    if data[:4] == b"\x7fELF":
+        return load_elf(data)
+    if data[:1] == b":":
+        return load_hex(data.decode("ascii"))
+    if base is None:
+        raise SystemExit("error: give the --base address of the binary image")
+    return {base + i: byte for i, byte in enumerate(data)}
+
+
+# Plan ------------------------------------------------------------------------
+
+def crc32_mpeg2(data, crc=0xFFFFFFFF):
+    """CRC-32/MPEG-2, the default of the STM32 CRC unit."""
+    for byte in data:
+        crc ^= byte << 24
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x04C11DB7) if crc & 0x80000000 else (crc << 1)
+            crc &= 0xFFFFFFFF
+    return crc
+
+
+def packbits(data):
+    """PackBits encoding of a payload."""
+    output, i = bytearray(), 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            output += bytes([257 - run, data[i]])
+            i += run
+            continue
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        output += bytes([i - start - 1]) + data[start:i]
+    return bytes(output)
+
+
+def plan(device, image, row):
+    """Erase ranges, program spans and sector CRCs of an image."""
+    start, end = device["address"], device["address"] + device["size"]
+    inside = {address - start: byte for address, byte in image.items()
+              if start <= address < end}
+    outside = len(image) - len(inside)
+    empty, page = device["empty"], device["page"]
+
+    # Sectors holding image bytes are erased, even for erased-value bytes
+    sectors = {}
+    for offset in inside:
+        sector = sector_of(device, offset)
+        sectors.setdefault(sector, None)
+    sectors = sorted(sectors)
+
+    erase = []
+    for offset, size in sectors:
+        if erase and erase[-1][0] + erase[-1][1] == offset:
+            erase[-1] = (erase[-1][0], erase[-1][1] + size, erase[-1][2] + 1)
+        else:
+            erase.append((offset, size, 1))
+
+    crcs = []
+    for offset, size in sectors:
+        content = bytes(inside.get(offset + i, empty) for i in range(size))
+        crcs.append((offset, size, crc32_mpeg2(content)))
+
+    # Rows holding only the erased value are left to the erase
+    rows = sorted({offset // row * row for offset, byte in inside.items() if byte != empty})
+    spans = []
+    for offset in rows:
+        if spans and spans[-1][1] == offset and offset % page:
+            spans[-1][1] = offset + row
+        else:
+            spans.append([offset, offset + row])
+    pages_total = len({offset // page for offset in inside})
+    pages_kept = len({offset // page for offset in rows})
+
+    program = []
+    for first, last in spans:
+        data = bytes(inside.get(offset, empty) for offset in range(first, last))
+        packed = packbits(data)
+        program.append({
+            "address": start + first,
+            "size": len(data),
+            "encoding": "packbits" if len(packed) < len(data) else "raw",
+            "payload": packed if len(packed) < len(data) else data,
+            "data": data,
+        })
+
+    return {
+        "image": len(inside),
+        "outside": outside,
+        "erase": [{"address": start + o, "size": s, "sectors": n} for o, s, n in erase],
+        "erase_chip": len(erase) == 1 and erase[0][1] == device["size"],
+        "program": program,
+        "sectors": [{"address": start + o, "size": s, "crc": c} for o, s, c in crcs],
+        "pages": pages_total,
+        "pages_dropped": pages_total - pages_kept,
+    }
+
+
+def scatter(program):
+    """Buffer of ProgramScatter: the descriptors, then the data of the spans."""
+    offset = 12 * len(program)
+    table, data = bytearray(), bytearray()
+    for entry in program:
+        table += struct.pack("<III", entry["address"], entry["size"], offset + len(data))
+        data += entry["data"] + bytes(-len(entry["data"]) % 4)  # data word aligned
+    return bytes(table + data)
+
+
+def report(device, result, row):
+    """Print the plan."""
+    print("%s (%s), %08X..%08X, page %u, row %u" % (
+        device["name"], device["type"], device["address"],
+        device["address"] + device["size"] - 1, device["page"], row))
+    if result["outside"]:
+        print("%u bytes of the image are outside the device, not planned" % result["outside"])
+
+    print("\nerase%s" % (" (EraseChip)" if result["erase_chip"] else ""))
+    for entry in result["erase"]:
+        print("  %08X %8u  %u sectors" % (entry["address"], entry["size"], entry["sectors"]))
+
+    print("\nprogram")
+    for entry in result["program"]:
+        print("  %08X %8u  %-8s %u" % (entry["address"], entry["size"], entry["encoding"],
+                                        len(entry["payload"])))
+
+    print("\nsector CRC")
+    for entry in result["sectors"]:
+        print("  %08X %8u  %08X" % (entry["address"], entry["size"], entry["crc"]))
+
+    programmed = sum(entry["size"] for entry in result["program"])
+    transferred = sum(len(entry["payload"]) for entry in result["program"])
+    print("\nimage %u bytes, %u pages, %u all-erased pages dropped" % (
+        result["image"], result["pages"], result["pages_dropped"]))
+    print("erase %u sectors in %u ranges" % (
+        sum(entry["sectors"] for entry in result["erase"]), len(result["erase"])))
+    print("program %u bytes in %u spans" % (programmed, len(result["program"])))
+    print("transfer %u bytes (%.1f %% of the programmed bytes)" % (
+        transferred, 100.0 * transferred / programmed if programmed else 0.0))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("flashdev", help="FlashDev.c of the algorithm")
+    parser.add_argument("image", help="ELF, Intel HEX or binary image")
+    parser.add_argument("-D", dest="defines", action="append", default=[],
+                        help="define of the algorithm target, e.g. FLASH_MEM")
+    parser.add_argument("--base", type=lambda s: int(s, 0), help="address of a binary image")
+    parser.add_argument("--row", type=lambda s: int(s, 0),
+                        help="programming row in bytes (default: 8 on-chip, 256 external)")
+    parser.add_argument("-o", "--output", help="write the plan as JSON")
+    parser.add_argument("--scatter", help="write the buffer of ProgramScatter")
+    args = parser.parse_args()
+
+    defines = {}
+    for define in args.defines:
+        name, _, value = define.partition("=")
+        defines[name] = value or "1"
+
+    device = flash_device(args.flashdev, defines)
+    row = args.row or (8 if device["type"] == "ONCHIP" else 256)
+    if row <= 0 or device["page"] % row:
+        raise SystemExit("error: the row must divide the page (%u bytes)" % device["page"])
+
+    result = plan(device, load_image(args.image, args.base), row)
+    report(device, result, row)
+
+    if args.scatter:
+        buffer = scatter(result["program"])
+        with open(args.scatter, "wb") as output:
+            output.write(buffer)
+        print("\nProgramScatter (cnt %u, sz %u)" % (len(result["program"]), len(buffer)))
+
+    if args.output:
+        for entry in result["program"]:
+            del entry["data"]
+            entry["payload"] = base64.b64encode(entry["payload"]).decode("ascii")
+        with open(args.output, "w") as output:
+            json.dump({"device": {key: device[key] for key in
+                                  ("name", "type", "address", "size", "page", "empty")},
+                       "row": row, "crc": "CRC-32/MPEG-2", **result}, output, indent=2)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,119 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Scatter-gather programming of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4Scatter.c
+  * @brief   This file provides the scatter-gather programming of the
+  *          algorithms: the regions of a descriptor list, downloaded in one
+  *          buffer, are programmed in one call of the algorithm.
+  ******************************************************************************
+  */
+
+#include "STM32L4Scatter.h"
+
+/** @defgroup STM32L4_Loader_Scatter_Exported_Functions Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Program the regions of a descriptor list.
+  * @note   The whole list is checked before the first region is programmed,
+  *         a malformed buffer leaves the memory unchanged. The data of each
+  *         region starts on a word, as STM32L4Plan.py lays it out.
+  * @param  ProgramPage: ProgramPage of the algorithm
+  * @param  Count: number of descriptors at the start of the buffer
+  * @param  Size: size of the buffer (bytes)
+  * @param  pBuffer: descriptors and data
+  * @param  Page: programming page of the device, ProgramPage never crosses it
+  * @param  Align: alignment of the region address and length (1 - none)
+  * @retval 0 - OK, 1 - Failed
+  */
+uint32_t Scatter_Program(Scatter_ProgramTypeDef ProgramPage, uint32_t Count, uint32_t Size,
+                         uint8_t *pBuffer, uint32_t Page, uint32_t Align)
+{
+  const Scatter_DescTypeDef *desc = (const Scatter_DescTypeDef *)pBuffer;
+  uint32_t address;
+  uint32_t length;
+  uint32_t offset;
+  uint32_t n;
+  uint32_t i;
+
+  if ((Count == 0U) || (Count > (Size / sizeof(Scatter_DescTypeDef))) ||
+      (Page == 0U) || (Align == 0U))
+  {
+    return 1U;
+  }
+
+  for (i = 0U; i < Count; i++)
+  {
+    /* The data lies in the buffer, after the descriptors, word aligned */
+    if ((desc[i].Offset < (Count * sizeof(Scatter_DescTypeDef))) ||
+        (desc[i].Offset > Size) || (desc[i].Length > (Size - desc[i].Offset)) ||
+        ((desc[i].Address % Align) != 0U) || ((desc[i].Length % Align) != 0U) ||
+        ((desc[i].Offset % 4U) != 0U))
+    {
+      return 1U;
+    }
+  }
+
+  for (i = 0U; i < Count; i++)
+  {
+    address = desc[i].Address;
+    length  = desc[i].Length;
+    offset  = desc[i].Offset;
+
+    while (length != 0U)
+    {
+      /* Up to the end of the page, like the calls of the debugger */
+      n = Page - (address % Page);
+      if (n > length)
+      {
+        n = length;
+      }
+
+      if (ProgramPage(address, n, &pBuffer[offset]) != 0)
+      {
+        return 1U;
+      }
+
+      address += n;
+      offset  += n;
+      length  -= n;
+    }
+  }
+
+  return 0U;
+}
+
+/**
+  * @}
+  */
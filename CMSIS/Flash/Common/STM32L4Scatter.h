@@ -0,0 +1,66 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Scatter-gather programming of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4Scatter.h
+  * @brief   Header file of STM32L4Scatter.c
+  ******************************************************************************
+  */
+
+
+#ifndef __STM32L4SCATTER_H
+#define __STM32L4SCATTER_H
+#include "stdint.h"
+
+/* Buffer of ProgramScatter, downloaded at once (STM32L4Plan.py --scatter):
+     Count descriptors, then the data of the regions at their Offset,
+     a multiple of 4
+   The buffer is word aligned, like the page buffer of the debugger. */
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Region to program */
+typedef struct
+{
+  uint32_t Address;           /* memory address of the region          */
+  uint32_t Length;            /* bytes                                 */
+  uint32_t Offset;            /* of the data, from the start of buffer */
+} Scatter_DescTypeDef;
+
+/* ProgramPage of the algorithm, 0 - OK */
+typedef int (*Scatter_ProgramTypeDef)(unsigned long adr, unsigned long sz, unsigned char *buf);
+
+/* Exported functions --------------------------------------------------------*/
+uint32_t Scatter_Program(Scatter_ProgramTypeDef ProgramPage, uint32_t Count, uint32_t Size,
+                         uint8_t *pBuffer, uint32_t Page, uint32_t Align);
+
+#endif
@@ -0,0 +1,289 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      SFDP decoder of the ST STM32L4 external loaders
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4Sfdp.c
+  * @brief   This file decodes the Serial Flash Discoverable Parameters
+  *          (JESD216, revisions A to C) of the QSPI/OSPI NOR memories.
+  ******************************************************************************
+  */
+
+#include "STM32L4Sfdp.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define SFDP_FIELD(dw, pos, len)   (((dw) >> (pos)) & ((1U << (len)) - 1U))
+#define SFDP_DWORD(p)              ((uint32_t)(p)[0] | ((uint32_t)(p)[1] << 8) | \
+                                    ((uint32_t)(p)[2] << 16) | ((uint32_t)(p)[3] << 24))
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup STM32L4_Loader_SFDP_Private_Functions Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Decode a fast read field: wait states (4:0), mode clocks (7:5)
+  *         and instruction (15:8), at Pos in the DWORD.
+  * @param  pRead: read mode to fill
+  * @param  Dword: DWORD of the table
+  * @param  Pos: bit position of the field
+  * @retval None
+  */
+static void SFDP_DecodeRead(SFDP_ReadTypeDef *pRead, uint32_t Dword, uint32_t Pos)
+{
+  pRead->Supported   = 1;
+  pRead->DummyCycles = (uint8_t)SFDP_FIELD(Dword, Pos, 5);
+  pRead->ModeClocks  = (uint8_t)SFDP_FIELD(Dword, Pos + 5U, 3);
+  pRead->Instruction = (uint8_t)SFDP_FIELD(Dword, Pos + 8U, 8);
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup STM32L4_Loader_SFDP_Exported_Functions Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Read and decode the Basic Flash Parameter Table of the memory.
+  * @param  ReadFunc: function reading the SFDP area of the memory
+  * @param  pInfo: parameters of the memory
+  * @retval SFDP_OK, SFDP_ERROR on a read error, SFDP_NOT_SUPPORTED when the
+  *         memory has no SFDP or a table this driver cannot use
+  */
+uint8_t SFDP_ReadInfo(SFDP_ReadFuncTypeDef ReadFunc, SFDP_InfoTypeDef *pInfo)
+{
+  uint8_t  header[8];
+  uint8_t  table[SFDP_BFPT_DWORDS_MAX * 4U];
+  uint32_t dw[SFDP_BFPT_DWORDS_MAX];
+  uint32_t length, address, i;
+
+  memset(pInfo, 0, sizeof(SFDP_InfoTypeDef));
+
+  /* SFDP header */
+  if (ReadFunc(0, header, sizeof(header)) != SFDP_OK)
+  {
+    return SFDP_ERROR;
+  }
+
+  if ((SFDP_DWORD(header) != SFDP_SIGNATURE) || (header[5] != 1U))
+  {
+    return SFDP_NOT_SUPPORTED;
+  }
+
+  /* The first parameter header is the one of the Basic Flash Parameter Table */
+  if (ReadFunc(8, header, sizeof(header)) != SFDP_OK)
+  {
+    return SFDP_ERROR;
+  }
+
+  if ((((uint32_t)header[7] << 8) | header[0]) != SFDP_BFPT_ID)
+  {
+    return SFDP_NOT_SUPPORTED;
+  }
+
+  pInfo->MinorRevision = header[1];
+  pInfo->MajorRevision = header[2];
+  length  = header[3];
+  address = (uint32_t)header[4] | ((uint32_t)header[5] << 8) | ((uint32_t)header[6] << 16);
+
+  /* JESD216 defines 9 DWORDs, the later revisions extend the table */
+  if (length < 9U)
+  {
+    return SFDP_NOT_SUPPORTED;
+  }
+  if (length > SFDP_BFPT_DWORDS_MAX)
+  {
+    length = SFDP_BFPT_DWORDS_MAX;
+  }
+  pInfo->Dwords = (uint8_t)length;
+
+  if (ReadFunc(address, table, length * 4U) != SFDP_OK)
+  {
+    return SFDP_ERROR;
+  }
+
+  memset(dw, 0, sizeof(dw));
+  for (i = 0; i < length; i++)
+  {
+    dw[i] = SFDP_DWORD(&table[i * 4U]);
+  }
+
+  /* DWORD 2: density in bits, 2^N above 2 Gbits */
+  if ((dw[1] & 0x80000000U) == 0U)
+  {
+    pInfo->FlashSize = (dw[1] >> 3) + 1U;
+  }
+  else if ((dw[1] & 0x7FFFFFFFU) < 35U)
+  {
+    pInfo->FlashSize = 1U << ((dw[1] & 0x7FFFFFFFU) - 3U);
+  }
+  else
+  {
+    /* Beyond the 4 GB the 32-bit addresses cover */
+    return SFDP_NOT_SUPPORTED;
+  }
+
+  /* DWORD 1: address bytes and the fast read modes supported */
+  pInfo->AddressBytes = (uint8_t)SFDP_FIELD(dw[0], 17, 2);
+
+  pInfo->Read[SFDP_READ_1_1_1].Supported   = 1;
+  pInfo->Read[SFDP_READ_1_1_1].Instruction = 0x0BU;
+  pInfo->Read[SFDP_READ_1_1_1].DummyCycles = 8U;
+
+  if (SFDP_FIELD(dw[0], 22, 1) != 0U)
+  {
+    SFDP_DecodeRead(&pInfo->Read[SFDP_READ_1_1_4], dw[2], 16);
+  }
+  if (SFDP_FIELD(dw[0], 21, 1) != 0U)
+  {
+    SFDP_DecodeRead(&pInfo->Read[SFDP_READ_1_4_4], dw[2], 0);
+  }
+  if (SFDP_FIELD(dw[0], 16, 1) != 0U)
+  {
+    SFDP_DecodeRead(&pInfo->Read[SFDP_READ_1_1_2], dw[3], 0);
+  }
+  if (SFDP_FIELD(dw[0], 20, 1) != 0U)
+  {
+    SFDP_DecodeRead(&pInfo->Read[SFDP_READ_1_2_2], dw[3], 16);
+  }
+  /* DWORD 5 and 7: 4-4-4 */
+  if (SFDP_FIELD(dw[4], 4, 1) != 0U)
+  {
+    SFDP_DecodeRead(&pInfo->Read[SFDP_READ_4_4_4], dw[6], 16);
+  }
+
+  /* DWORD 8 and 9: erase types, size 2^N */
+  for (i = 0; i < SFDP_ERASE_TYPES; i++)
+  {
+    uint32_t field = SFDP_FIELD(dw[7 + (i / 2U)], (i % 2U) * 16U, 16);
+
+    if ((field & 0xFFU) != 0U)
+    {
+      pInfo->Erase[i].Size        = 1U << (field & 0xFFU);
+      pInfo->Erase[i].Instruction = (uint8_t)(field >> 8);
+    }
+  }
+
+  /* DWORD 11 (JESD216A): page size 2^N, 256 bytes before */
+  pInfo->PageSize = 256U;
+  if (length >= 11U)
+  {
+    pInfo->PageSize = 1U << SFDP_FIELD(dw[10], 4, 4);
+  }
+
+  /* DWORD 12 and 13 (JESD216A): erase suspend and resume, bit 31 of
+     DWORD 12 set when not supported */
+  if ((length >= 13U) && (SFDP_FIELD(dw[11], 31, 1) == 0U))
+  {
+    pInfo->EraseSuspend = (uint8_t)SFDP_FIELD(dw[12], 24, 8);
+    pInfo->EraseResume  = (uint8_t)SFDP_FIELD(dw[12], 16, 8);
+  }
+
+  /* DWORD 15 and 16 (JESD216A): quad enable and 4-byte address entry */
+  if (length >= 16U)
+  {
+    pInfo->QuadEnable        = (uint8_t)SFDP_FIELD(dw[14], 20, 3);
+    pInfo->Enter4ByteAddress = (uint8_t)SFDP_FIELD(dw[15], 24, 8);
+  }
+  else
+  {
+    pInfo->QuadEnable = SFDP_QE_UNKNOWN;
+  }
+
+  /* DWORD 20 (JESD216C): maximum speed of 8D-8D-8D with data strobe,
+     0000b and 1111b: not supported */
+  if (length >= 20U)
+  {
+    uint32_t speed = SFDP_FIELD(dw[19], 28, 4);
+
+    pInfo->OctalDtr = ((speed != 0U) && (speed != 0xFU)) ? 1U : 0U;
+  }
+
+  return SFDP_OK;
+}
+
+/**
+  * @brief  Return the fastest read mode supported by the memory.
+  * @param  pInfo: parameters of the memory
+  * @param  Modes: SFDP_READ_MODE() mask of the modes usable by the driver
+  * @retval SFDP_READ_x mode, SFDP_READ_1_1_1 when no other applies
+  */
+uint8_t SFDP_GetReadMode(const SFDP_InfoTypeDef *pInfo, uint32_t Modes)
+{
+  uint8_t mode;
+
+  /* The quad modes need the quad enable requirements of JESD216A */
+  if ((pInfo->QuadEnable == SFDP_QE_UNKNOWN) || (pInfo->QuadEnable > SFDP_QE_SR2_BIT1_31H))
+  {
+    Modes &= ~(SFDP_READ_MODE(SFDP_READ_1_1_4) | SFDP_READ_MODE(SFDP_READ_1_4_4) |
+               SFDP_READ_MODE(SFDP_READ_4_4_4));
+  }
+
+  for (mode = SFDP_READ_MODES - 1U; mode > SFDP_READ_1_1_1; mode--)
+  {
+    if (((Modes & SFDP_READ_MODE(mode)) != 0U) && (pInfo->Read[mode].Supported != 0U))
+    {
+      break;
+    }
+  }
+
+  return mode;
+}
+
+/**
+  * @brief  Return the largest erase type not larger than Size.
+  * @param  pInfo: parameters of the memory
+  * @param  Size: size of the area to erase, in bytes
+  * @retval Erase type, NULL when all the erase types are larger
+  */
+const SFDP_EraseTypeDef *SFDP_GetEraseType(const SFDP_InfoTypeDef *pInfo, uint32_t Size)
+{
+  const SFDP_EraseTypeDef *erase = NULL;
+  uint32_t i;
+
+  for (i = 0; i < SFDP_ERASE_TYPES; i++)
+  {
+    if ((pInfo->Erase[i].Size != 0U) && (pInfo->Erase[i].Size <= Size) &&
+        ((erase == NULL) || (pInfo->Erase[i].Size > erase->Size)))
+    {
+      erase = &pInfo->Erase[i];
+    }
+  }
+
+  return erase;
+}
+
+/**
+  * @}
+  */
@@ -0,0 +1,132 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      SFDP decoder of the ST STM32L4 external loaders
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4Sfdp.h
+  * @brief   Header file of STM32L4Sfdp.c
+  ******************************************************************************
+  */
+
+
+#ifndef __STM32L4SFDP_H
+#define __STM32L4SFDP_H
+#include "stdint.h"
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+
+/* SFDP status */
+#define SFDP_OK                 ((uint8_t)0x00)
+#define SFDP_ERROR              ((uint8_t)0x01)
+#define SFDP_NOT_SUPPORTED      ((uint8_t)0x02)
+
+/* Read SFDP command, 1-1-1 with a 3-byte address in every memory */
+#define SFDP_READ_CMD           0x5AU
+#define SFDP_DUMMY_CYCLES       8U
+
+#define SFDP_SIGNATURE          0x50444653U   /* "SFDP" */
+#define SFDP_BFPT_ID            0xFF00U       /* Basic Flash Parameter Table */
+#define SFDP_BFPT_DWORDS_MAX    20U           /* up to JESD216C            */
+
+/* Read modes (instruction-address-data lines), slowest first */
+#define SFDP_READ_1_1_1         0U
+#define SFDP_READ_1_1_2         1U
+#define SFDP_READ_1_2_2         2U
+#define SFDP_READ_1_1_4         3U
+#define SFDP_READ_1_4_4         4U
+#define SFDP_READ_4_4_4         5U
+#define SFDP_READ_MODES         6U
+
+#define SFDP_READ_MODE(mode)    (1U << (mode))
+
+/* Address bytes, DWORD 1 bits 18:17 */
+#define SFDP_ADDRESS_3          0U
+#define SFDP_ADDRESS_3_OR_4     1U
+#define SFDP_ADDRESS_4          2U
+
+/* Enter 4-byte address mode methods, DWORD 16 bits 31:24 */
+#define SFDP_4B_ENTER_B7        0x01U   /* issue instruction B7h              */
+#define SFDP_4B_ENTER_WREN_B7   0x02U   /* issue write enable 06h, then B7h   */
+
+/* Quad enable requirements, DWORD 15 bits 22:20 */
+#define SFDP_QE_NONE            0U   /* no QE bit                              */
+#define SFDP_QE_SR2_BIT1_NORD   1U   /* SR2 bit 1, 2 bytes 01h, no SR2 read    */
+#define SFDP_QE_SR1_BIT6        2U   /* SR1 bit 6, 1 byte 01h                  */
+#define SFDP_QE_SR2_BIT7        3U   /* SR2 bit 7, read 3Fh, write 3Eh         */
+#define SFDP_QE_SR2_BIT1        4U   /* SR2 bit 1, read 35h, 2 bytes 01h (1 byte keeps SR2) */
+#define SFDP_QE_SR2_BIT1_35H    5U   /* SR2 bit 1, read 35h, 2 bytes 01h (1 byte clears SR2) */
+#define SFDP_QE_SR2_BIT1_31H    6U   /* SR2 bit 1, read 35h, write 31h         */
+#define SFDP_QE_UNKNOWN         0xFFU /* JESD216 table, no DWORD 15          */
+
+#define SFDP_ERASE_TYPES        4U
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint8_t  Supported;
+  uint8_t  Instruction;
+  uint8_t  ModeClocks;        /* clocks of the mode bits               */
+  uint8_t  DummyCycles;       /* wait states after the mode bits       */
+} SFDP_ReadTypeDef;
+
+typedef struct
+{
+  uint32_t Size;              /* bytes, 0 when the type is not defined */
+  uint8_t  Instruction;
+} SFDP_EraseTypeDef;
+
+typedef struct
+{
+  uint8_t  MajorRevision;
+  uint8_t  MinorRevision;     /* of the Basic Flash Parameter Table    */
+  uint8_t  Dwords;            /* DWORDs of the table, the fields of the
+                                 missing ones keep their default      */
+  uint32_t FlashSize;         /* bytes                                 */
+  uint32_t PageSize;          /* bytes                                 */
+  uint8_t  AddressBytes;      /* SFDP_ADDRESS_x                        */
+  uint8_t  Enter4ByteAddress; /* SFDP_4B_ENTER_x methods               */
+  uint8_t  QuadEnable;        /* SFDP_QE_x                             */
+  uint8_t  OctalDtr;          /* 8D-8D-8D supported (JESD216C)         */
+  uint8_t  EraseSuspend;      /* erase suspend instruction, 0: none    */
+  uint8_t  EraseResume;       /* erase resume instruction              */
+  SFDP_ReadTypeDef  Read[SFDP_READ_MODES];
+  SFDP_EraseTypeDef Erase[SFDP_ERASE_TYPES];
+} SFDP_InfoTypeDef;
+
+/* Reads SFDP bytes with the Read SFDP command, returns SFDP_OK on success */
+typedef uint8_t (*SFDP_ReadFuncTypeDef)(uint32_t Address, uint8_t *pData, uint32_t Size);
+
+/* Exported functions --------------------------------------------------------*/
+uint8_t SFDP_ReadInfo(SFDP_ReadFuncTypeDef ReadFunc, SFDP_InfoTypeDef *pInfo);
+uint8_t SFDP_GetReadMode(const SFDP_InfoTypeDef *pInfo, uint32_t Modes);
+const SFDP_EraseTypeDef *SFDP_GetEraseType(const SFDP_InfoTypeDef *pInfo, uint32_t Size);
+
+#endif
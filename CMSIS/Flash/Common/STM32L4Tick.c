@@ -0,0 +1,181 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      HAL time base of the ST STM32L4 external loaders
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4Tick.c
+  * @brief   This file provides the HAL time base of the external loaders,
+  *          counted from the DWT cycle counter.
+  ******************************************************************************
+  */
+
+#include "STM32L4Tick.h"
+
+/* DWT->CYCCNT at the last update of uwTick */
+static uint32_t TickCycles;
+/* Cycles elapsed since the last update and not yet counted in uwTick */
+static uint32_t TickRemainder;
+/* Updates of TIM6 since Tick_WakeupStart */
+static uint32_t TickWakeupOverflow;
+
+/** @defgroup STM32L4_Loader_Tick_Exported_Functions Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Start the cycle counter used as time base.
+  * @note   Called by HAL_Init and after every system clock change by
+  *         HAL_RCC_ClockConfig, the tick keeps counting across the calls.
+  * @param  TickPriority: not used, no interrupt is involved
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
+{
+  (void)TickPriority;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  TickCycles    = DWT->CYCCNT;
+  TickRemainder = 0;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Provide the tick value in millisecond.
+  * @note   The 32-bit cycle counter wraps after 2^32 / SystemCoreClock
+  *         (35 s at 120 MHz): the HAL timeout loops call this function far
+  *         more often. The counter stops while the core sleeps in WFE
+  *         (unless DBGMCU DBG_SLEEP is set), such waits are timed by their
+  *         own timer.
+  * @param  None
+  * @retval tick value
+  */
+uint32_t HAL_GetTick(void)
+{
+  uint32_t cycles = DWT->CYCCNT;
+  uint32_t cycles_per_ms = SystemCoreClock / 1000U;
+
+  TickRemainder += cycles - TickCycles;
+  TickCycles     = cycles;
+
+  if (TickRemainder >= cycles_per_ms)
+  {
+    uwTick        += TickRemainder / cycles_per_ms;
+    TickRemainder %= cycles_per_ms;
+  }
+
+  return uwTick;
+}
+
+/**
+  * @brief  Busy wait for at least the given time.
+  * @param  Delay: delay in us
+  * @retval None
+  */
+void Tick_DelayUs(uint32_t Delay)
+{
+  uint32_t start  = DWT->CYCCNT;
+  uint32_t cycles = Delay * (SystemCoreClock / 1000000U);
+
+  while ((DWT->CYCCNT - start) < cycles)
+  {
+  }
+
+  /* Keep the millisecond tick within one counter wrap of the cycle count */
+  (void)HAL_GetTick();
+}
+
+/**
+  * @brief  Start the timer that times and ends a sleep in WFE.
+  * @note   TIM6 runs free at 1 MHz and updates every 65.536 ms: its update
+  *         interrupt stays disabled in the NVIC, it only wakes the core up
+  *         from WFE (SEVONPEND), no handler runs. The cycle counter of
+  *         HAL_GetTick stops while the core sleeps in WFE (unless DBGMCU
+  *         DBG_SLEEP is set). The prescaler follows the timer clock, not
+  *         SystemCoreClock, which differ when APB1 is divided.
+  * @param  None
+  * @retval None
+  */
+void Tick_WakeupStart(void)
+{
+  __HAL_RCC_TIM6_CLK_ENABLE();
+  TIM6->CR1  = 0;
+  TIM6->PSC  = (Tick_TimerClock() / 1000000U) - 1U;
+  TIM6->ARR  = 0xFFFFU;
+  TIM6->EGR  = TIM_EGR_UG;
+  TIM6->SR   = 0;
+  TIM6->DIER = TIM_DIER_UIE;
+  TIM6->CR1  = TIM_CR1_CEN;
+
+  TickWakeupOverflow = 0;
+
+  NVIC_DisableIRQ(TIM6_DAC_IRQn);
+  NVIC_ClearPendingIRQ(TIM6_DAC_IRQn);
+  SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+}
+
+/**
+  * @brief  Time elapsed since Tick_WakeupStart, sleep included.
+  * @note   Called in the wait loop before each WFE: an update pends the
+  *         interrupt again, the core wakes up at least every 65.536 ms.
+  * @param  None
+  * @retval elapsed time in ms
+  */
+uint32_t Tick_WakeupElapsed(void)
+{
+  if ((TIM6->SR & TIM_SR_UIF) != 0U)
+  {
+    TIM6->SR = 0;
+    TickWakeupOverflow++;
+  }
+  NVIC_ClearPendingIRQ(TIM6_DAC_IRQn);
+
+  return ((TickWakeupOverflow << 16) + TIM6->CNT) / 1000U;
+}
+
+/**
+  * @brief  Stop the timer of Tick_WakeupStart.
+  * @param  None
+  * @retval None
+  */
+void Tick_WakeupStop(void)
+{
+  TIM6->CR1  = 0;
+  TIM6->DIER = 0;
+  TIM6->SR   = 0;
+  NVIC_ClearPendingIRQ(TIM6_DAC_IRQn);
+}
+
+/**
+  * @}
+  */
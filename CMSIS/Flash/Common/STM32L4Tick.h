@@ -0,0 +1,76 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      HAL time base of the ST STM32L4 external loaders
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4Tick.h
+  * @brief   Header file of STM32L4Tick.c
+  ******************************************************************************
+  */
+
+
+#ifndef __STM32L4TICK_H
+#define __STM32L4TICK_H
+#include "stdint.h"
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l4xx_hal.h"
+
+/* The flash loaders run with interrupts disabled: the HAL time base
+   (HAL_InitTick, HAL_GetTick) is derived from the DWT cycle counter instead
+   of the SysTick interrupt, HAL_Delay is the HAL default implementation.
+   The cycle counter stops while the core sleeps in WFE: a wait that sleeps
+   is timed by TIM6 (Tick_Wakeup*, the WaitFor* functions of the BSP), which
+   also wakes the core up, never by HAL_GetTick. TIM6 is prescaled from
+   Tick_TimerClock(), whatever the APB1 divider. */
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Clock of the APB1 timers (TIM2, TIM6).
+  * @note   The timers run at PCLK1, or at twice PCLK1 when APB1 is divided.
+  * @param  None
+  * @retval Timer clock, in Hz
+  */
+__STATIC_INLINE uint32_t Tick_TimerClock(void)
+{
+  if ((RCC->CFGR & RCC_CFGR_PPRE1) == RCC_HCLK_DIV1)
+  {
+    return HAL_RCC_GetPCLK1Freq();
+  }
+  return 2U * HAL_RCC_GetPCLK1Freq();
+}
+
+void Tick_DelayUs(uint32_t Delay);
+void Tick_WakeupStart(void);
+uint32_t Tick_WakeupElapsed(void);
+void Tick_WakeupStop(void);
+
+#endif
@@ -0,0 +1,222 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      ITM trace of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4Trace.c
+  * @brief   This file provides the ITM trace of the algorithms: one record
+  *          per erase, program or verify operation, with its address, size,
+  *          duration and result, sent over SWO without stopping the core.
+  ******************************************************************************
+  */
+
+#include "STM32L4Trace.h"
+
+#if defined FLASH_TRACE
+
+/* Private constants ---------------------------------------------------------*/
+
+/* The on-chip algorithms do not use the device header, the core debug
+   registers are accessed through their addresses */
+#define TRACE_ITM_STIM(port)    (*(volatile uint32_t *)(0xE0000000U + (4U * (port))))
+#define TRACE_ITM_TER           (*(volatile uint32_t *)0xE0000E00U)
+#define TRACE_ITM_TCR           (*(volatile uint32_t *)0xE0000E80U)
+#define TRACE_ITM_TCR_ITMENA    0x00000001U
+
+#define TRACE_DWT_CTRL          (*(volatile uint32_t *)0xE0001000U)
+#define TRACE_DWT_CYCCNT        (*(volatile uint32_t *)0xE0001004U)
+#define TRACE_DWT_CYCCNTENA     0x00000001U
+#define TRACE_DEMCR             (*(volatile uint32_t *)0xE000EDFCU)
+#define TRACE_DEMCR_TRCENA      0x01000000U
+
+#define TRACE_DBGMCU_CR         (*(volatile uint32_t *)0xE0042004U)
+#define TRACE_DBGMCU_DBG_SLEEP  0x00000001U
+
+/* Private types -------------------------------------------------------------*/
+
+/* Operation in progress */
+typedef struct
+{
+  uint32_t Op;
+  uint32_t Address;
+  uint32_t Size;
+  uint32_t Start;               /* DWT->CYCCNT at TRACE_BEGIN */
+} Trace_OpTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static Trace_OpTypeDef TraceOps[TRACE_DEPTH];
+static uint32_t TraceDepth;
+static uint32_t TraceSequence;
+
+/* DBGMCU_CR and DEMCR before the outermost operation, restored after it */
+static uint32_t TraceDbgmcu;
+static uint32_t TraceDemcr;
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup STM32L4_Loader_Trace_Private_Functions Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Send a word on the stimulus port, when the debugger enabled it.
+  * @param  Data: word
+  * @retval None
+  */
+static void Trace_Send(uint32_t Data)
+{
+  while ((TRACE_ITM_STIM(TRACE_PORT) & 1U) == 0U)
+  {
+  }
+  TRACE_ITM_STIM(TRACE_PORT) = Data;
+}
+
+/**
+  * @brief  Send a record.
+  * @param  Op: TRACE_x operation
+  * @param  Depth: nesting level of the operation
+  * @param  Address: address of the operation
+  * @param  Size: size of the operation
+  * @param  Cycles: duration (core cycles)
+  * @param  Result: returned value
+  * @retval None
+  */
+static void Trace_Record(uint32_t Op, uint32_t Depth, uint32_t Address, uint32_t Size,
+                         uint32_t Cycles, uint32_t Result)
+{
+  /* Nothing is sent while the SWO trace is not set up, the algorithm never
+     waits on a stopped FIFO */
+  if (((TRACE_ITM_TCR & TRACE_ITM_TCR_ITMENA) == 0U) ||
+      ((TRACE_ITM_TER & (1U << TRACE_PORT)) == 0U))
+  {
+    return;
+  }
+
+  Trace_Send((TRACE_SYNC << 24) | ((TraceSequence & 0xFFU) << 16) | (Depth << 8) | Op);
+  Trace_Send(Address);
+  Trace_Send(Size);
+  Trace_Send(Cycles);
+  Trace_Send(Result);
+
+  TraceSequence++;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup STM32L4_Loader_Trace_Exported_Functions Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Start timing an operation.
+  * @note   The DWT cycle counter stops while the core sleeps in WFE, unless
+  *         DBGMCU DBG_SLEEP keeps the HCLK of the core in Sleep mode: it is
+  *         set for the outermost operation, so the records include the
+  *         sleeps. Trace_End restores DBG_SLEEP and TRCENA after it.
+  * @param  Op: TRACE_x operation
+  * @param  Address: address of the operation
+  * @param  Size: size of the operation
+  * @retval None
+  */
+void Trace_Begin(uint32_t Op, uint32_t Address, uint32_t Size)
+{
+  Trace_OpTypeDef *op;
+
+  if (TraceDepth == 0U)
+  {
+    TraceDbgmcu = TRACE_DBGMCU_CR & TRACE_DBGMCU_DBG_SLEEP;
+    TraceDemcr  = TRACE_DEMCR & TRACE_DEMCR_TRCENA;
+
+    TRACE_DBGMCU_CR  |= TRACE_DBGMCU_DBG_SLEEP;
+    TRACE_DEMCR      |= TRACE_DEMCR_TRCENA;
+    TRACE_DWT_CTRL   |= TRACE_DWT_CYCCNTENA;
+  }
+
+  if (TraceDepth < TRACE_DEPTH)
+  {
+    op = &TraceOps[TraceDepth];
+    op->Op      = Op;
+    op->Address = Address;
+    op->Size    = Size;
+    op->Start   = TRACE_DWT_CYCCNT;
+  }
+  TraceDepth++;
+}
+
+/**
+  * @brief  Send the record of the operation started by the last Trace_Begin.
+  * @param  Result: returned value of the operation
+  * @retval Result
+  */
+uint32_t Trace_End(uint32_t Result)
+{
+  uint32_t cycles = TRACE_DWT_CYCCNT;
+  Trace_OpTypeDef *op;
+
+  if (TraceDepth == 0U)
+  {
+    return Result;
+  }
+
+  TraceDepth--;
+  if (TraceDepth < TRACE_DEPTH)
+  {
+    op = &TraceOps[TraceDepth];
+    Trace_Record(op->Op, TraceDepth, op->Address, op->Size, cycles - op->Start, Result);
+  }
+
+  /* The debug settings of the debugger, once the outermost operation ends */
+  if (TraceDepth == 0U)
+  {
+    TRACE_DBGMCU_CR = (TRACE_DBGMCU_CR & ~TRACE_DBGMCU_DBG_SLEEP) | TraceDbgmcu;
+    TRACE_DEMCR     = (TRACE_DEMCR & ~TRACE_DEMCR_TRCENA) | TraceDemcr;
+  }
+
+  return Result;
+}
+
+/**
+  * @brief  Send the HCLK frequency, the decoder converts the cycles with it.
+  * @param  Hclk: HCLK frequency (Hz)
+  * @retval None
+  */
+void Trace_Clock(uint32_t Hclk)
+{
+  Trace_Record(TRACE_CLOCK, TraceDepth, 0U, Hclk, 0U, 0U);
+}
+
+/**
+  * @}
+  */
+
+#endif /* FLASH_TRACE */
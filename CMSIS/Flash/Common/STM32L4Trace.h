@@ -0,0 +1,89 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      ITM trace of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4Trace.h
+  * @brief   Header file of STM32L4Trace.c
+  ******************************************************************************
+  */
+
+
+#ifndef __STM32L4TRACE_H
+#define __STM32L4TRACE_H
+#include "stdint.h"
+
+/* Uncomment this line to emit an ITM record for each operation of the
+   algorithms, the debugger enables the SWO trace (EnableTraceSWO) */
+/* #define FLASH_TRACE */
+
+/* Record of an operation, five 32-bit writes to the stimulus port:
+     Header   TRACE_SYNC << 24 | sequence << 16 | depth << 8 | operation
+     Address  adr of the operation
+     Size     sz of the operation (fnc for Init and UnInit, HCLK for Clock)
+     Cycles   duration in core cycles
+     Result   returned value: 0 - OK, or (adr+sz) - OK for Verify
+   Nested operations (e.g. the internal Flash of the composite algorithm)
+   have a depth above 0. The sequence counts the records, modulo 256. */
+#define TRACE_PORT              1U      /* ITM stimulus port, port 0 is left to printf */
+#define TRACE_SYNC              0xA5U
+#define TRACE_DEPTH             4U      /* nested operations timed, at most */
+
+/* Operations */
+#define TRACE_CLOCK             0U      /* HCLK frequency in Size, after Init */
+#define TRACE_INIT              1U
+#define TRACE_UNINIT            2U
+#define TRACE_BLANK_CHECK       3U
+#define TRACE_ERASE_CHIP        4U
+#define TRACE_ERASE_SECTOR      5U
+#define TRACE_PROGRAM           6U
+#define TRACE_VERIFY            7U
+
+/* Exported macros -----------------------------------------------------------*/
+
+/* An operation starts with TRACE_BEGIN and returns TRACE_END(result), the
+   macros leave the algorithms unchanged when FLASH_TRACE is not defined */
+#if defined FLASH_TRACE
+  #define TRACE_BEGIN(op, adr, sz)  Trace_Begin((op), (uint32_t)(adr), (uint32_t)(sz))
+  #define TRACE_END(result)         Trace_End((uint32_t)(result))
+  #define TRACE_HCLK(hclk)          Trace_Clock((uint32_t)(hclk))
+#else
+  #define TRACE_BEGIN(op, adr, sz)  ((void)0)
+  #define TRACE_END(result)         (result)
+  #define TRACE_HCLK(hclk)          ((void)0)
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+void     Trace_Begin(uint32_t Op, uint32_t Address, uint32_t Size);
+uint32_t Trace_End(uint32_t Result);
+void     Trace_Clock(uint32_t Hclk);
+
+#endif
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 ARM Ltd.
+#
+# This software is provided 'as-is', without any express or implied warranty.
+# In no event will the authors be held liable for any damages arising from
+# the use of this software. Permission is granted to anyone to use this
+# software for any purpose, including commercial applications, and to alter
+# it and redistribute it freely, subject to the following restrictions:
+#
+# 1. The origin of this software must not be misrepresented; you must not
+#    claim that you wrote the original software. If you use this software in
+#    a product, an acknowledgment in the product documentation would be
+#    appreciated but is not required.
+#
+# 2. Altered source versions must be plainly marked as such, and must not be
+#    misrepresented as being the original software.
+#
+# 3. This notice may not be removed or altered from any source distribution.
+#
+#
+# $Date:        19. October 2026
+# $Revision:    V1.0.0
+#
+# Project:      ITM trace decoder of the ST STM32L4 Flash algorithms
+#
+"""Decode the ITM records of the flash algorithms (STM32L4Trace.c).
+
+The input is the raw SWO byte stream, as written by the trace capture of
+the debug probe (for example OpenOCD "tpiu config ... uart off <file>" or
+orbuculum). Each record becomes one line of the timeline, with its
+duration and throughput; a summary per operation is printed at the end.
+
+    STM32L4TraceDecode.py swo.bin
+    STM32L4TraceDecode.py --follow swo.bin      (live, until Ctrl-C)
+"""
+
+import argparse
+import sys
+import time
+
+TRACE_PORT = 1
+TRACE_SYNC = 0xA5
+TRACE_WORDS = 5
+
+OPERATIONS = {
+    0: "Clock",
+    1: "Init",
+    2: "UnInit",
+    3: "BlankCheck",
+    4: "EraseChip",
+    5: "EraseSector",
+    6: "ProgramPage",
+    7: "Verify",
+}
+TRACE_CLOCK = 0
+TRACE_INIT = 1
+TRACE_UNINIT = 2
+TRACE_VERIFY = 7
+
+
+def itm_words(chunks, port):
+    """Yield the 32-bit words written to a stimulus port, from the SWO bytes."""
+    data = bytearray()
+    for chunk in chunks:
+        data += chunk
+        i = 0
+        while i < len(data):
+            header = data[i]
+            if header in (0x00, 0x80):              # synchronization
+                i += 1
+                continue
+            if header == 0x70:                      # overflow
+                sys.stderr.write("warning: ITM overflow, records lost\n")
+                i += 1
+                continue
+            if (header & 0x0F) == 0x00:             # timestamp, extension
+                n = 1
+                if header & 0x80:
+                    while i + n < len(data) and data[i + n] & 0x80:
+                        n += 1
+                    n += 1
+                if i + n > len(data):
+                    break
+                i += n
+                continue
+            size = {1: 1, 2: 2, 3: 4}.get(header & 0x03)
+            if size is None:                        # reserved, skip the byte
+                i += 1
+                continue
+            if i + 1 + size > len(data):
+                break
+            payload = data[i + 1:i + 1 + size]
+            i += 1 + size
+            if (header & 0x04) == 0 and (header >> 3) == port and size == 4:
+                yield int.from_bytes(payload, "little")
+        del data[:i]
+
+
+def records(words):
+    """Group the words in records, resynchronizing on the header word."""
+    pending = []
+    for word in words:
+        if not pending and (word >> 24) != TRACE_SYNC:
+            continue
+        pending.append(word)
+        if len(pending) == TRACE_WORDS:
+            header, address, size, cycles, result = pending
+            pending = []
+            yield {
+                "sequence": (header >> 16) & 0xFF,
+                "depth": (header >> 8) & 0xFF,
+                "op": header & 0xFF,
+                "address": address,
+                "size": size,
+                "cycles": cycles,
+                "result": result,
+            }
+
+
+def read_chunks(path, follow):
+    """Yield the bytes of the capture, waiting for more in follow mode."""
+    stream = sys.stdin.buffer if path == "-" else open(path, "rb")
+    with stream:
+        while True:
+            chunk = stream.read(4096)
+            if chunk:
+                yield chunk
+            elif follow:
+                time.sleep(0.1)
+            else:
+                return
+
+
+def status(record):
+    """OK when the operation succeeded."""
+    if record["op"] == TRACE_VERIFY:
+        return record["result"] == (record["address"] + record["size"]) & 0xFFFFFFFF
+    return record["result"] == 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", help="raw SWO capture file, - for stdin")
+    parser.add_argument("--follow", action="store_true", help="wait for new data")
+    parser.add_argument("--port", type=int, default=TRACE_PORT, help="ITM stimulus port")
+    parser.add_argument("--clock", type=float, default=0.0,
+                        help="HCLK (Hz) until the first Clock record")
+    parser.add_argument("--quiet", action="store_true", help="summary only")
+    args = parser.parse_args()
+
+    hclk = args.clock
+    elapsed = 0.0
+    sequence = None
+    lost = 0
+    summary = {}
+
+    try:
+        for rec in records(itm_words(read_chunks(args.capture, args.follow), args.port)):
+            if sequence is not None:
+                lost += (rec["sequence"] - sequence - 1) & 0xFF
+            sequence = rec["sequence"]
+
+            if rec["op"] == TRACE_CLOCK:
+                hclk = float(rec["size"])
+                if not args.quiet:
+                    print("%12s  clock %.3f MHz" % ("", hclk / 1e6))
+                continue
+
+            us = rec["cycles"] * 1e6 / hclk if hclk else 0.0
+            if rec["depth"] == 0:
+                elapsed += us
+
+            name = OPERATIONS.get(rec["op"], "op%d" % rec["op"])
+            counts_bytes = rec["op"] not in (TRACE_INIT, TRACE_UNINIT)
+            rate = rec["size"] / us * 1e6 / 1024 if us and counts_bytes else 0.0
+
+            entry = summary.setdefault((rec["depth"], name), [0, 0.0, 0, 0.0, 0])
+            entry[0] += 1
+            entry[1] += us
+            entry[2] += rec["size"] if counts_bytes else 0
+            entry[3] = max(entry[3], us)
+            entry[4] += 0 if status(rec) else 1
+
+            if not args.quiet:
+                print("%12.1f  %s%-12s %08X %8u  %10.1f us %9.1f KB/s  %s" % (
+                    elapsed, "  " * rec["depth"], name, rec["address"], rec["size"],
+                    us, rate, "OK" if status(rec) else "FAILED (%08X)" % rec["result"]))
+                sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+
+    print("\n%-16s %6s %12s %12s %12s %10s %6s" % (
+        "operation", "count", "total us", "average us", "max us", "KB/s", "failed"))
+    for (depth, name), (count, total, size, worst, failed) in sorted(summary.items()):
+        print("%-16s %6u %12.1f %12.1f %12.1f %10.1f %6u" % (
+            "  " * depth + name, count, total, total / count, worst,
+            size / total * 1e6 / 1024 if total and size else 0.0, failed))
+    if lost:
+        print("\n%u records lost" % lost)
+    if not hclk:
+        print("\nno Clock record: the times are 0, give --clock")
+
+
+if __name__ == "__main__":
+    main()
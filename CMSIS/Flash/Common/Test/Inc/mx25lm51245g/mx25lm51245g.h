@@ -0,0 +1,100 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Host tests of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    mx25lm51245g.h
+  * @brief   Definitions of the MX25LM51245G component used by the loaders,
+  *          the values of the ST component driver.
+  ******************************************************************************
+  */
+
+
+#ifndef MX25LM51245G_H
+#define MX25LM51245G_H
+#include "stdint.h"
+
+/* Sizes ---------------------------------------------------------------------*/
+#define MX25LM51245G_FLASH_SIZE               0x4000000U  /* 512 Mbits => 64 MBytes */
+#define MX25LM51245G_BLOCK_SIZE               0x10000U    /* 1024 blocks of 64 KBytes */
+#define MX25LM51245G_SECTOR_SIZE              0x1000U     /* 16384 sectors of 4 KBytes */
+#define MX25LM51245G_PAGE_SIZE                0x100U      /* 262144 pages of 256 bytes */
+
+#define MX25LM51245G_DUMMY_CYCLES_READ_OCTAL_66M  6U
+
+/* Maximum times (ms) --------------------------------------------------------*/
+#define MX25LM51245G_CHIP_ERASE_MAX_TIME      300000U
+#define MX25LM51245G_BLOCK_ERASE_MAX_TIME     2000U
+#define MX25LM51245G_SECTOR_ERASE_MAX_TIME    400U
+#define MX25LM51245G_WRITE_REG_MAX_TIME       40U
+
+/* Commands ------------------------------------------------------------------*/
+/* SPI mode */
+#define WRITE_ENABLE_CMD                      0x06U
+#define READ_STATUS_REG_CMD                   0x05U
+#define WRITE_CFG_REG_2_CMD                   0x72U
+#define READ_CFG_REG_2_CMD                    0x71U
+#define RESET_ENABLE_CMD                      0x66U
+#define RESET_MEMORY_CMD                      0x99U
+
+/* Octal mode: the instruction and its complement */
+#define OCTAL_IO_READ_CMD                     0xEC13U
+#define OCTAL_IO_DTR_READ_CMD                 0xEE11U
+#define OCTAL_PAGE_PROG_CMD                   0x12EDU
+#define OCTAL_WRITE_ENABLE_CMD                0x06F9U
+#define OCTAL_READ_STATUS_REG_CMD             0x05FAU
+#define OCTAL_READ_SECURITY_REG_CMD           0x2BD4U
+#define OCTAL_WRITE_CFG_REG_2_CMD             0x728DU
+#define OCTAL_READ_CFG_REG_2_CMD              0x718EU
+#define OCTAL_SECTOR_ERASE_CMD                0x21DEU
+#define OCTAL_BLOCK_ERASE_CMD                 0xDC23U
+#define OCTAL_CHIP_ERASE_CMD                  0x609FU
+#define OCTAL_PROG_ERASE_SUSPEND_CMD          0xB04FU
+#define OCTAL_PROG_ERASE_RESUME_CMD           0x30CFU
+#define OCTAL_ENTER_DEEP_POWER_DOWN_CMD       0xB946U
+#define OCTAL_NO_OPERATION_CMD                0x00FFU
+
+/* Registers -----------------------------------------------------------------*/
+#define MX25LM51245G_SR_WIP                   0x01U   /* Write in progress */
+#define MX25LM51245G_SR_WEL                   0x02U   /* Write enable latch */
+
+#define MX25LM51245G_SECR_PSB                 0x04U   /* Program suspend bit */
+#define MX25LM51245G_SECR_ESB                 0x08U   /* Erase suspend bit */
+#define MX25LM51245G_SECR_P_FAIL              0x20U   /* Program fail flag */
+#define MX25LM51245G_SECR_E_FAIL              0x40U   /* Erase fail flag */
+
+#define MX25LM51245G_CR2_REG1_ADDR            0x00000000U
+#define MX25LM51245G_CR2_SOPI                 0x01U   /* STR octal */
+#define MX25LM51245G_CR2_DOPI                 0x02U   /* DTR octal */
+#define MX25LM51245G_CR2_REG3_ADDR            0x00000300U
+#define MX25LM51245G_CR2_DC_66M               0x07U   /* 6 dummy cycles */
+
+#endif
@@ -0,0 +1,90 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Host tests of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    n25q128a.h
+  * @brief   Definitions of the N25Q128A component used by the loader, the
+  *          values of the ST component driver.
+  ******************************************************************************
+  */
+
+
+#ifndef __N25Q128A_H
+#define __N25Q128A_H
+#include "stdint.h"
+
+/* Sizes ---------------------------------------------------------------------*/
+#define N25Q128A_FLASH_SIZE                   0x1000000U  /* 128 MBits => 16 MBytes */
+#define N25Q128A_SECTOR_SIZE                  0x10000U    /* 256 sectors of 64 KBytes */
+#define N25Q128A_SUBSECTOR_SIZE               0x1000U     /* 4096 subsectors of 4 KBytes */
+#define N25Q128A_PAGE_SIZE                    0x100U      /* 65536 pages of 256 bytes */
+
+#define N25Q128A_DUMMY_CYCLES_READ_QUAD       10U
+
+/* Maximum times (ms) --------------------------------------------------------*/
+#define N25Q128A_BULK_ERASE_MAX_TIME          250000U
+#define N25Q128A_SECTOR_ERASE_MAX_TIME        3000U
+#define N25Q128A_SUBSECTOR_ERASE_MAX_TIME     800U
+
+/* Commands ------------------------------------------------------------------*/
+#define RESET_ENABLE_CMD                      0x66U
+#define RESET_MEMORY_CMD                      0x99U
+#define WRITE_ENABLE_CMD                      0x06U
+#define READ_STATUS_REG_CMD                   0x05U
+#define WRITE_STATUS_REG_CMD                  0x01U
+#define READ_FLAG_STATUS_REG_CMD              0x70U
+#define READ_VOL_CFG_REG_CMD                  0x85U
+#define WRITE_VOL_CFG_REG_CMD                 0x81U
+#define PAGE_PROG_CMD                         0x02U
+#define EXT_QUAD_IN_FAST_PROG_CMD             0x12U
+#define QUAD_INOUT_FAST_READ_CMD              0xEBU
+#define SUBSECTOR_ERASE_CMD                   0x20U
+#define SECTOR_ERASE_CMD                      0xD8U
+#define BULK_ERASE_CMD                        0xC7U
+#define PROG_ERASE_SUSPEND_CMD                0x75U
+#define PROG_ERASE_RESUME_CMD                 0x7AU
+
+/* Registers -----------------------------------------------------------------*/
+#define N25Q128A_SR_WIP                       0x01U   /* Write in progress */
+#define N25Q128A_SR_WREN                      0x02U   /* Write enable latch */
+
+#define N25Q128A_VCR_NB_DUMMY                 0xF0U   /* Number of dummy clock cycles */
+
+#define N25Q128A_FSR_PRERR                    0x02U   /* Protection error */
+#define N25Q128A_FSR_PGSUS                    0x04U   /* Program operation suspended */
+#define N25Q128A_FSR_VPPERR                   0x08U   /* Invalid voltage during program or erase */
+#define N25Q128A_FSR_PGERR                    0x10U   /* Program error */
+#define N25Q128A_FSR_ERERR                    0x20U   /* Erase error */
+#define N25Q128A_FSR_ERSUS                    0x40U   /* Erase operation suspended */
+#define N25Q128A_FSR_READY                    0x80U   /* Ready or command in progress */
+
+#endif
@@ -0,0 +1,81 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Host tests of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    stm32l4r9i_discovery_ospi_nor.h
+  * @brief   Interface of the OSPI NOR driver (stm32l4xx_ospi_nor.c), as
+  *          declared by the BSP of the STM32L4R9I-DK.
+  ******************************************************************************
+  */
+
+
+#ifndef __STM32L4R9I_DISCOVERY_OSPI_NOR_H
+#define __STM32L4R9I_DISCOVERY_OSPI_NOR_H
+#include "stdint.h"
+
+#include "stm32l4xx_hal.h"
+#include "./mx25lm51245g/mx25lm51245g.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define OSPI_NOR_OK                 ((uint8_t)0x00)
+#define OSPI_NOR_ERROR              ((uint8_t)0x01)
+#define OSPI_NOR_BUSY               ((uint8_t)0x02)
+#define OSPI_NOR_NOT_SUPPORTED      ((uint8_t)0x04)
+#define OSPI_NOR_SUSPENDED          ((uint8_t)0x08)
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t FlashSize;
+  uint32_t EraseSectorSize;
+  uint32_t EraseSectorsNumber;
+  uint32_t ProgPageSize;
+  uint32_t ProgPagesNumber;
+} OSPI_NOR_Info;
+
+/* Exported functions --------------------------------------------------------*/
+uint8_t BSP_OSPI_NOR_Init                  (void);
+uint8_t BSP_OSPI_NOR_DeInit                (void);
+uint8_t BSP_OSPI_NOR_Read                  (uint8_t* pData, uint32_t ReadAddr, uint32_t Size);
+uint8_t BSP_OSPI_NOR_Write                 (uint8_t* pData, uint32_t WriteAddr, uint32_t Size);
+uint8_t BSP_OSPI_NOR_Erase_Block           (uint32_t BlockAddress);
+uint8_t BSP_OSPI_NOR_Erase_Sector          (uint32_t Sector);
+uint8_t BSP_OSPI_NOR_Erase_Chip            (void);
+uint8_t BSP_OSPI_NOR_GetStatus             (void);
+uint8_t BSP_OSPI_NOR_GetInfo               (OSPI_NOR_Info* pInfo);
+uint8_t BSP_OSPI_NOR_EnableMemoryMappedMode(void);
+uint8_t BSP_OSPI_NOR_SuspendErase          (void);
+uint8_t BSP_OSPI_NOR_ResumeErase           (void);
+uint8_t BSP_OSPI_NOR_EnterDeepPowerDown    (void);
+uint8_t BSP_OSPI_NOR_LeaveDeepPowerDown    (void);
+
+#endif
@@ -0,0 +1,731 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Host tests of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    stm32l4xx_hal.h
+  * @brief   STM32L4 HAL of the host tests, in place of the Cube HAL: the
+  *          registers used by the loaders at their addresses (STM32L4HostHAL.c
+  *          maps them in the test process), and the OSPI, QSPI, DMA, GPIO and
+  *          RCC functions, implemented over the memory models.
+  ******************************************************************************
+  */
+
+
+#ifndef __STM32L4XX_HAL_H
+#define __STM32L4XX_HAL_H
+#include "stdint.h"
+#include <stddef.h>
+
+/* Core ----------------------------------------------------------------------*/
+#define __I                     volatile const
+#define __O                     volatile
+#define __IO                    volatile
+#define __STATIC_INLINE         static inline
+
+#define SET_BIT(REG, BIT)       ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)     ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)      ((REG) & (BIT))
+#define WRITE_REG(REG, VAL)     ((REG) = (VAL))
+#define READ_REG(REG)           ((REG))
+#define MODIFY_REG(REG, CLEARMASK, SETMASK)  WRITE_REG((REG), (((READ_REG(REG)) & (~(CLEARMASK))) | (SETMASK)))
+#define POSITION_VAL(VAL)       ((uint32_t)__builtin_ctz(VAL))
+
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+  RESET = 0U,
+  SET   = !RESET
+} FlagStatus;
+
+typedef enum
+{
+  TIM6_DAC_IRQn       = 54,
+  DMA2_Channel7_IRQn  = 69,
+  QUADSPI_IRQn        = 71,
+  OCTOSPI1_IRQn       = 71,
+  OCTOSPI2_IRQn       = 76
+} IRQn_Type;
+
+typedef struct
+{
+  __I  uint32_t CPUID;
+  __IO uint32_t ICSR;
+  __IO uint32_t VTOR;
+  __IO uint32_t AIRCR;
+  __IO uint32_t SCR;
+  __IO uint32_t CCR;
+} SCB_Type;
+
+#define SCB_BASE                0xE000ED00UL
+#define SCB                     ((SCB_Type *)SCB_BASE)
+#define SCB_SCR_SEVONPEND_Msk   (1UL << 4)
+
+/* Wait for event: the host advances the time to the next event */
+void __WFE(void);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+
+/* Peripherals ---------------------------------------------------------------*/
+typedef struct
+{
+  __IO uint32_t CR1;
+  __IO uint32_t CR2;
+  __IO uint32_t SMCR;
+  __IO uint32_t DIER;
+  __IO uint32_t SR;
+  __IO uint32_t EGR;
+  __IO uint32_t CCMR1;
+  __IO uint32_t CCMR2;
+  __IO uint32_t CCER;
+  __IO uint32_t CNT;
+  __IO uint32_t PSC;
+  __IO uint32_t ARR;
+} TIM_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR;
+  __IO uint32_t ICSCR;
+  __IO uint32_t CFGR;
+  __IO uint32_t PLLCFGR;
+  __IO uint32_t PLLSAI1CFGR;
+  __IO uint32_t PLLSAI2CFGR;
+  __IO uint32_t CIER;
+  __IO uint32_t CIFR;
+  __IO uint32_t CICR;
+  uint32_t      RESERVED0;
+  __IO uint32_t AHB1RSTR;
+  __IO uint32_t AHB2RSTR;
+  __IO uint32_t AHB3RSTR;
+  uint32_t      RESERVED1;
+  __IO uint32_t APB1RSTR1;
+  __IO uint32_t APB1RSTR2;
+  __IO uint32_t APB2RSTR;
+  uint32_t      RESERVED2;
+  __IO uint32_t AHB1ENR;
+  __IO uint32_t AHB2ENR;
+  __IO uint32_t AHB3ENR;
+  uint32_t      RESERVED3;
+  __IO uint32_t APB1ENR1;
+  __IO uint32_t APB1ENR2;
+  __IO uint32_t APB2ENR;
+} RCC_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR1;
+  __IO uint32_t CR2;
+  __IO uint32_t CR3;
+  __IO uint32_t CR4;
+  __IO uint32_t SR1;
+  __IO uint32_t SR2;
+  __IO uint32_t SCR;
+} PWR_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t MODER;
+  __IO uint32_t OTYPER;
+  __IO uint32_t OSPEEDR;
+  __IO uint32_t PUPDR;
+  __IO uint32_t IDR;
+  __IO uint32_t ODR;
+  __IO uint32_t BSRR;
+  __IO uint32_t LCKR;
+  __IO uint32_t AFR[2];
+  __IO uint32_t BRR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CCR;
+  __IO uint32_t CNDTR;
+  __IO uint32_t CPAR;
+  __IO uint32_t CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR;
+  uint32_t      RESERVED0;
+  __IO uint32_t DCR1;
+  __IO uint32_t DCR2;
+  __IO uint32_t DCR3;
+  __IO uint32_t DCR4;
+  uint32_t      RESERVED1[2];
+  __IO uint32_t SR;
+  __IO uint32_t FCR;
+} OCTOSPI_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR;
+  __IO uint32_t DCR;
+  __IO uint32_t SR;
+  __IO uint32_t FCR;
+  __IO uint32_t DLR;
+  __IO uint32_t CCR;
+  __IO uint32_t AR;
+  __IO uint32_t ABR;
+  __IO uint32_t DR;
+  __IO uint32_t PSMKR;
+  __IO uint32_t PSMAR;
+  __IO uint32_t PIR;
+  __IO uint32_t LPTR;
+} QUADSPI_TypeDef;
+
+#define PERIPH_BASE             0x40000000UL
+#define TIM2_BASE               (PERIPH_BASE + 0x0000UL)
+#define TIM6_BASE               (PERIPH_BASE + 0x1000UL)
+#define PWR_BASE                (PERIPH_BASE + 0x7000UL)
+#define DMA2_Channel7_BASE      (PERIPH_BASE + 0x20480UL)
+#define RCC_BASE                (PERIPH_BASE + 0x21000UL)
+#define GPIOA_BASE              0x48000000UL
+#define GPIOB_BASE              (GPIOA_BASE + 0x0400UL)
+#define OCTOSPI1_R_BASE         0xA0001000UL
+#define OCTOSPI2_R_BASE         0xA0001400UL
+#define QSPI_R_BASE             0xA0001000UL
+#define OCTOSPI1_BASE           0x90000000UL
+#define QSPI_BASE               0x90000000UL
+
+#define TIM2                    ((TIM_TypeDef *)TIM2_BASE)
+#define TIM6                    ((TIM_TypeDef *)TIM6_BASE)
+#define PWR                     ((PWR_TypeDef *)PWR_BASE)
+#define RCC                     ((RCC_TypeDef *)RCC_BASE)
+#define DMA2_Channel7           ((DMA_Channel_TypeDef *)DMA2_Channel7_BASE)
+#define GPIOA                   ((GPIO_TypeDef *)(GPIOA_BASE + 0x0000UL))
+#define GPIOB                   ((GPIO_TypeDef *)(GPIOA_BASE + 0x0400UL))
+#define GPIOC                   ((GPIO_TypeDef *)(GPIOA_BASE + 0x0800UL))
+#define GPIOD                   ((GPIO_TypeDef *)(GPIOA_BASE + 0x0C00UL))
+#define GPIOE                   ((GPIO_TypeDef *)(GPIOA_BASE + 0x1000UL))
+#define GPIOF                   ((GPIO_TypeDef *)(GPIOA_BASE + 0x1400UL))
+#define GPIOG                   ((GPIO_TypeDef *)(GPIOA_BASE + 0x1800UL))
+#define GPIOH                   ((GPIO_TypeDef *)(GPIOA_BASE + 0x1C00UL))
+#define GPIOI                   ((GPIO_TypeDef *)(GPIOA_BASE + 0x2000UL))
+#define OCTOSPI1                ((OCTOSPI_TypeDef *)OCTOSPI1_R_BASE)
+#define OCTOSPI2                ((OCTOSPI_TypeDef *)OCTOSPI2_R_BASE)
+#define QUADSPI                 ((QUADSPI_TypeDef *)QSPI_R_BASE)
+
+#define TIM_CR1_CEN             0x0001U
+#define TIM_DIER_UIE            0x0001U
+#define TIM_SR_UIF              0x0001U
+#define TIM_EGR_UG              0x0001U
+
+#define PWR_CR2_IOSV            (1UL << 9)
+#define RCC_AHB2ENR_GPIOAEN     (1UL << 0)
+#define RCC_APB1ENR1_TIM2EN     (1UL << 0)
+
+#define OCTOSPI_CR_DMAEN        (1UL << 2)
+#define OCTOSPI_DCR1_DEVSIZE_Pos 16U
+#define OCTOSPI_DCR1_DEVSIZE    (0x1FUL << OCTOSPI_DCR1_DEVSIZE_Pos)
+#define OCTOSPI_SR_TEF          (1UL << 0)
+#define OCTOSPI_SR_TCF          (1UL << 1)
+#define OCTOSPI_SR_SMF          (1UL << 3)
+
+#define QUADSPI_DCR_FSIZE_Pos   16U
+#define QUADSPI_DCR_FSIZE       (0x1FUL << QUADSPI_DCR_FSIZE_Pos)
+#define QUADSPI_SR_TEF          (1UL << 0)
+#define QUADSPI_SR_TCF          (1UL << 1)
+#define QUADSPI_SR_SMF          (1UL << 3)
+
+/* System --------------------------------------------------------------------*/
+extern uint32_t SystemCoreClock;
+
+void              SystemInit(void);
+HAL_StatusTypeDef HAL_Init(void);
+HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority);
+uint32_t          HAL_GetTick(void);
+void              HAL_Delay(uint32_t Delay);
+
+/* RCC -----------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t PLLState;
+  uint32_t PLLSource;
+  uint32_t PLLM;
+  uint32_t PLLN;
+  uint32_t PLLP;
+  uint32_t PLLQ;
+  uint32_t PLLR;
+} RCC_PLLInitTypeDef;
+
+typedef struct
+{
+  uint32_t OscillatorType;
+  uint32_t HSEState;
+  uint32_t LSEState;
+  uint32_t HSIState;
+  uint32_t HSICalibrationValue;
+  uint32_t LSIState;
+  uint32_t MSIState;
+  uint32_t MSICalibrationValue;
+  uint32_t MSIClockRange;
+  uint32_t HSI48State;
+  RCC_PLLInitTypeDef PLL;
+} RCC_OscInitTypeDef;
+
+typedef struct
+{
+  uint32_t ClockType;
+  uint32_t SYSCLKSource;
+  uint32_t AHBCLKDivider;
+  uint32_t APB1CLKDivider;
+  uint32_t APB2CLKDivider;
+} RCC_ClkInitTypeDef;
+
+#define RCC_OSCILLATORTYPE_MSI  0x00000010U
+#define RCC_MSI_ON              0x00000001U
+#define RCC_MSICALIBRATION_DEFAULT 0U
+#define RCC_MSIRANGE_6          0x00000060U   /* 4 MHz */
+#define RCC_PLL_ON              0x00000002U
+#define RCC_PLLSOURCE_MSI       0x00000001U
+#define RCC_CLOCKTYPE_SYSCLK    0x00000001U
+#define RCC_CLOCKTYPE_HCLK      0x00000002U
+#define RCC_CLOCKTYPE_PCLK1     0x00000004U
+#define RCC_CLOCKTYPE_PCLK2     0x00000008U
+#define RCC_SYSCLKSOURCE_PLLCLK 0x00000003U
+#define RCC_SYSCLK_DIV1         1U            /* the divider */
+#define RCC_SYSCLK_DIV2         2U
+#define RCC_HCLK_DIV1           0x00000000U   /* RCC_CFGR_PPRE1 */
+#define RCC_HCLK_DIV2           0x00000400U
+#define RCC_HCLK_DIV4           0x00000500U
+#define RCC_CFGR_PPRE1          0x00000700U
+#define FLASH_LATENCY_3         3U
+#define FLASH_LATENCY_4         4U
+#define FLASH_LATENCY_5         5U
+#define PWR_REGULATOR_VOLTAGE_SCALE1_BOOST 0U
+
+#define __HAL_RCC_PWR_CLK_ENABLE()        ((void)0)
+#define __HAL_RCC_PWR_CLK_DISABLE()       ((void)0)
+#define __HAL_RCC_TIM6_CLK_ENABLE()       ((void)0)
+#define __HAL_RCC_DMA2_CLK_ENABLE()       ((void)0)
+#define __HAL_RCC_DMAMUX1_CLK_ENABLE()    ((void)0)
+#define __HAL_RCC_GPIOE_CLK_ENABLE()      SET_BIT(RCC->AHB2ENR, RCC_AHB2ENR_GPIOAEN << 4)
+#define __HAL_RCC_OSPIM_CLK_ENABLE()      ((void)0)
+#define __HAL_RCC_OSPI1_CLK_ENABLE()      ((void)0)
+#define __HAL_RCC_OSPI1_CLK_DISABLE()     ((void)0)
+#define __HAL_RCC_OSPI1_FORCE_RESET()     ((void)0)
+#define __HAL_RCC_OSPI1_RELEASE_RESET()   ((void)0)
+#define __HAL_RCC_OSPI2_CLK_ENABLE()      ((void)0)
+#define __HAL_RCC_OSPI2_CLK_DISABLE()     ((void)0)
+#define __HAL_RCC_OSPI2_FORCE_RESET()     ((void)0)
+#define __HAL_RCC_OSPI2_RELEASE_RESET()   ((void)0)
+#define __HAL_RCC_QSPI_CLK_ENABLE()       ((void)0)
+#define __HAL_RCC_QSPI_CLK_DISABLE()      ((void)0)
+#define __HAL_RCC_QSPI_FORCE_RESET()      ((void)0)
+#define __HAL_RCC_QSPI_RELEASE_RESET()    ((void)0)
+
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct);
+HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t FLatency);
+uint32_t          HAL_RCC_GetSysClockFreq(void);
+uint32_t          HAL_RCC_GetPCLK1Freq(void);
+HAL_StatusTypeDef HAL_PWREx_ControlVoltageScaling(uint32_t VoltageScaling);
+
+/* GPIO ----------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0U,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+#define GPIO_PIN_0              0x0001U
+#define GPIO_PIN_1              0x0002U
+#define GPIO_PIN_2              0x0004U
+#define GPIO_PIN_3              0x0008U
+#define GPIO_PIN_4              0x0010U
+#define GPIO_PIN_5              0x0020U
+#define GPIO_PIN_6              0x0040U
+#define GPIO_PIN_7              0x0080U
+#define GPIO_PIN_8              0x0100U
+#define GPIO_PIN_9              0x0200U
+#define GPIO_PIN_10             0x0400U
+#define GPIO_PIN_11             0x0800U
+#define GPIO_PIN_12             0x1000U
+#define GPIO_PIN_13             0x2000U
+#define GPIO_PIN_14             0x4000U
+#define GPIO_PIN_15             0x8000U
+#define GPIO_MODE_INPUT         0x00000000U
+#define GPIO_MODE_OUTPUT_PP     0x00000001U
+#define GPIO_MODE_AF_PP         0x00000002U
+#define GPIO_NOPULL             0x00000000U
+#define GPIO_PULLUP             0x00000001U
+#define GPIO_SPEED_FREQ_LOW     0x00000000U
+#define GPIO_SPEED_FREQ_VERY_HIGH 0x00000003U
+#define GPIO_AF5_OCTOSPIM_P2    0x05U
+#define GPIO_AF10_QUADSPI       0x0AU
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+
+/* DMA -----------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Request;
+  uint32_t Direction;
+  uint32_t PeriphInc;
+  uint32_t MemInc;
+  uint32_t PeriphDataAlignment;
+  uint32_t MemDataAlignment;
+  uint32_t Mode;
+  uint32_t Priority;
+} DMA_InitTypeDef;
+
+typedef enum
+{
+  HAL_DMA_STATE_RESET = 0x00U,
+  HAL_DMA_STATE_READY = 0x01U,
+  HAL_DMA_STATE_BUSY  = 0x02U
+} HAL_DMA_StateTypeDef;
+
+typedef struct
+{
+  DMA_Channel_TypeDef *Instance;
+  DMA_InitTypeDef      Init;
+  HAL_DMA_StateTypeDef State;
+  void                *Parent;
+} DMA_HandleTypeDef;
+
+#define DMA_REQUEST_OCTOSPI1    40U
+#define DMA_REQUEST_OCTOSPI2    41U
+#define DMA_MEMORY_TO_PERIPH    0x00000010U
+#define DMA_PINC_DISABLE        0x00000000U
+#define DMA_MINC_ENABLE         0x00000080U
+#define DMA_PDATAALIGN_BYTE     0x00000000U
+#define DMA_MDATAALIGN_BYTE     0x00000000U
+#define DMA_NORMAL              0x00000000U
+#define DMA_PRIORITY_HIGH       0x00002000U
+
+#define __HAL_LINKDMA(__HANDLE__, __PPP_DMA_FIELD__, __DMA_HANDLE__) \
+  do { (__HANDLE__)->__PPP_DMA_FIELD__ = &(__DMA_HANDLE__); (__DMA_HANDLE__).Parent = (__HANDLE__); } while (0)
+
+HAL_StatusTypeDef    HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef    HAL_DMA_DeInit(DMA_HandleTypeDef *hdma);
+void                 HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma);
+HAL_DMA_StateTypeDef HAL_DMA_GetState(DMA_HandleTypeDef *hdma);
+
+/* OSPI ----------------------------------------------------------------------*/
+/* The values of the phase fields are the lines and the bytes of the phase,
+   which STM32L4HostHAL.c hands over to the memory model */
+typedef struct
+{
+  uint32_t FifoThreshold;
+  uint32_t DualQuad;
+  uint32_t MemoryType;
+  uint32_t DeviceSize;
+  uint32_t ChipSelectHighTime;
+  uint32_t FreeRunningClock;
+  uint32_t ClockMode;
+  uint32_t ClockPrescaler;
+  uint32_t SampleShifting;
+  uint32_t DelayHoldQuarterCycle;
+  uint32_t ChipSelectBoundary;
+  uint32_t DelayBlockBypass;
+} OSPI_InitTypeDef;
+
+typedef struct
+{
+  uint32_t OperationType;
+  uint32_t FlashId;
+  uint32_t Instruction;
+  uint32_t InstructionMode;
+  uint32_t InstructionSize;
+  uint32_t InstructionDtrMode;
+  uint32_t Address;
+  uint32_t AddressMode;
+  uint32_t AddressSize;
+  uint32_t AddressDtrMode;
+  uint32_t AlternateBytes;
+  uint32_t AlternateBytesMode;
+  uint32_t AlternateBytesSize;
+  uint32_t AlternateBytesDtrMode;
+  uint32_t DataMode;
+  uint32_t NbData;
+  uint32_t DataDtrMode;
+  uint32_t DummyCycles;
+  uint32_t DQSMode;
+  uint32_t SIOOMode;
+} OSPI_RegularCmdTypeDef;
+
+typedef struct
+{
+  uint32_t Match;
+  uint32_t Mask;
+  uint32_t MatchMode;
+  uint32_t AutomaticStop;
+  uint32_t Interval;
+} OSPI_AutoPollingTypeDef;
+
+typedef struct
+{
+  uint32_t TimeOutActivation;
+  uint32_t TimeOutPeriod;
+} OSPI_MemoryMappedTypeDef;
+
+typedef struct
+{
+  uint32_t ClkPort;
+  uint32_t DQSPort;
+  uint32_t NCSPort;
+  uint32_t IOLowPort;
+  uint32_t IOHighPort;
+} OSPIM_CfgTypeDef;
+
+typedef struct
+{
+  OCTOSPI_TypeDef        *Instance;
+  OSPI_InitTypeDef        Init;
+  uint8_t                *pBuffPtr;
+  uint32_t                XferSize;
+  DMA_HandleTypeDef      *hdma;
+  uint32_t                State;
+  uint32_t                ErrorCode;
+  OSPI_RegularCmdTypeDef  Command;      /* host: command of the next transfer */
+  OSPI_RegularCmdTypeDef  ReadCfg;      /* host: read of the memory-mapped mode */
+} OSPI_HandleTypeDef;
+
+#define HAL_OSPI_STATE_RESET            0x00000000U
+#define HAL_OSPI_STATE_READY            0x00000002U
+#define HAL_OSPI_STATE_CMD_CFG          0x00000004U
+#define HAL_OSPI_STATE_BUSY_CMD         0x00000008U
+#define HAL_OSPI_STATE_BUSY_TX          0x00000018U
+#define HAL_OSPI_STATE_BUSY_AUTO_POLLING 0x00000048U
+#define HAL_OSPI_STATE_BUSY_MEM_MAPPED  0x00000088U
+#define HAL_OSPI_ERROR_NONE             0x00000000U
+#define HAL_OSPI_ERROR_TIMEOUT          0x00000001U
+#define HAL_OSPI_TIMEOUT_DEFAULT_VALUE  5000U
+
+#define HAL_OSPI_DUALQUAD_DISABLE       0U
+#define HAL_OSPI_MEMTYPE_MICRON         0U
+#define HAL_OSPI_MEMTYPE_MACRONIX       1U
+#define HAL_OSPI_FREERUNCLK_DISABLE     0U
+#define HAL_OSPI_CLOCK_MODE_0           0U
+#define HAL_OSPI_SAMPLE_SHIFTING_NONE   0U
+#define HAL_OSPI_SAMPLE_SHIFTING_HALFCYCLE 1U
+#define HAL_OSPI_DHQC_DISABLE           0U
+#define HAL_OSPI_DHQC_ENABLE            1U
+#define HAL_OSPI_DELAY_BLOCK_USED       0U
+#define HAL_OSPI_DELAY_BLOCK_BYPASSED   1U
+
+#define HAL_OSPI_OPTYPE_COMMON_CFG      0U
+#define HAL_OSPI_OPTYPE_READ_CFG        1U
+#define HAL_OSPI_OPTYPE_WRITE_CFG       2U
+#define HAL_OSPI_FLASH_ID_1             0U
+#define HAL_OSPI_INSTRUCTION_NONE       0U
+#define HAL_OSPI_INSTRUCTION_1_LINE     1U
+#define HAL_OSPI_INSTRUCTION_2_LINES    2U
+#define HAL_OSPI_INSTRUCTION_4_LINES    4U
+#define HAL_OSPI_INSTRUCTION_8_LINES    8U
+#define HAL_OSPI_INSTRUCTION_8_BITS     1U
+#define HAL_OSPI_INSTRUCTION_16_BITS    2U
+#define HAL_OSPI_INSTRUCTION_DTR_DISABLE 0U
+#define HAL_OSPI_INSTRUCTION_DTR_ENABLE 1U
+#define HAL_OSPI_ADDRESS_NONE           0U
+#define HAL_OSPI_ADDRESS_1_LINE         1U
+#define HAL_OSPI_ADDRESS_2_LINES        2U
+#define HAL_OSPI_ADDRESS_4_LINES        4U
+#define HAL_OSPI_ADDRESS_8_LINES        8U
+#define HAL_OSPI_ADDRESS_8_BITS         1U
+#define HAL_OSPI_ADDRESS_16_BITS        2U
+#define HAL_OSPI_ADDRESS_24_BITS        3U
+#define HAL_OSPI_ADDRESS_32_BITS        4U
+#define HAL_OSPI_ADDRESS_DTR_DISABLE    0U
+#define HAL_OSPI_ADDRESS_DTR_ENABLE     1U
+#define HAL_OSPI_ALTERNATE_BYTES_NONE   0U
+#define HAL_OSPI_DATA_NONE              0U
+#define HAL_OSPI_DATA_1_LINE            1U
+#define HAL_OSPI_DATA_2_LINES           2U
+#define HAL_OSPI_DATA_4_LINES           4U
+#define HAL_OSPI_DATA_8_LINES           8U
+#define HAL_OSPI_DATA_DTR_DISABLE       0U
+#define HAL_OSPI_DATA_DTR_ENABLE        1U
+#define HAL_OSPI_DQS_DISABLE            0U
+#define HAL_OSPI_DQS_ENABLE             1U
+#define HAL_OSPI_SIOO_INST_EVERY_CMD    0U
+#define HAL_OSPI_MATCH_MODE_AND         0U
+#define HAL_OSPI_AUTOMATIC_STOP_ENABLE  1U
+#define HAL_OSPI_TIMEOUT_COUNTER_DISABLE 0U
+#define HAL_OSPIM_IOPORT_2_LOW          0x00000002U
+#define HAL_OSPIM_IOPORT_2_HIGH         0x00010002U
+
+#define HAL_OSPI_FLAG_TE                OCTOSPI_SR_TEF
+#define HAL_OSPI_FLAG_TC                OCTOSPI_SR_TCF
+#define HAL_OSPI_FLAG_SM                OCTOSPI_SR_SMF
+
+#define __HAL_OSPI_GET_FLAG(__HANDLE__, __FLAG__) \
+  ((READ_BIT((__HANDLE__)->Instance->SR, (__FLAG__)) != 0U) ? SET : RESET)
+
+HAL_StatusTypeDef HAL_OSPI_Init(OSPI_HandleTypeDef *hospi);
+HAL_StatusTypeDef HAL_OSPI_DeInit(OSPI_HandleTypeDef *hospi);
+HAL_StatusTypeDef HAL_OSPIM_Config(OSPI_HandleTypeDef *hospi, OSPIM_CfgTypeDef *cfg, uint32_t Timeout);
+HAL_StatusTypeDef HAL_OSPI_Command(OSPI_HandleTypeDef *hospi, OSPI_RegularCmdTypeDef *cmd, uint32_t Timeout);
+HAL_StatusTypeDef HAL_OSPI_Transmit(OSPI_HandleTypeDef *hospi, uint8_t *pData, uint32_t Timeout);
+HAL_StatusTypeDef HAL_OSPI_Receive(OSPI_HandleTypeDef *hospi, uint8_t *pData, uint32_t Timeout);
+HAL_StatusTypeDef HAL_OSPI_Transmit_DMA(OSPI_HandleTypeDef *hospi, uint8_t *pData);
+HAL_StatusTypeDef HAL_OSPI_AutoPolling(OSPI_HandleTypeDef *hospi, OSPI_AutoPollingTypeDef *cfg, uint32_t Timeout);
+HAL_StatusTypeDef HAL_OSPI_AutoPolling_IT(OSPI_HandleTypeDef *hospi, OSPI_AutoPollingTypeDef *cfg);
+HAL_StatusTypeDef HAL_OSPI_MemoryMapped(OSPI_HandleTypeDef *hospi, OSPI_MemoryMappedTypeDef *cfg);
+HAL_StatusTypeDef HAL_OSPI_Abort(OSPI_HandleTypeDef *hospi);
+void              HAL_OSPI_IRQHandler(OSPI_HandleTypeDef *hospi);
+uint32_t          HAL_OSPI_GetState(OSPI_HandleTypeDef *hospi);
+
+/* QSPI ----------------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t ClockPrescaler;
+  uint32_t FifoThreshold;
+  uint32_t SampleShifting;
+  uint32_t FlashSize;
+  uint32_t ChipSelectHighTime;
+  uint32_t ClockMode;
+  uint32_t FlashID;
+  uint32_t DualFlash;
+} QSPI_InitTypeDef;
+
+typedef struct
+{
+  uint32_t Instruction;
+  uint32_t Address;
+  uint32_t AlternateBytes;
+  uint32_t AddressSize;
+  uint32_t AlternateBytesSize;
+  uint32_t DummyCycles;
+  uint32_t InstructionMode;
+  uint32_t AddressMode;
+  uint32_t AlternateByteMode;
+  uint32_t DataMode;
+  uint32_t NbData;
+  uint32_t DdrMode;
+  uint32_t DdrHoldHalfCycle;
+  uint32_t SIOOMode;
+} QSPI_CommandTypeDef;
+
+typedef struct
+{
+  uint32_t Match;
+  uint32_t Mask;
+  uint32_t Interval;
+  uint32_t StatusBytesSize;
+  uint32_t MatchMode;
+  uint32_t AutomaticStop;
+} QSPI_AutoPollingTypeDef;
+
+typedef struct
+{
+  uint32_t TimeOutPeriod;
+  uint32_t TimeOutActivation;
+} QSPI_MemoryMappedTypeDef;
+
+typedef struct
+{
+  QUADSPI_TypeDef        *Instance;
+  QSPI_InitTypeDef        Init;
+  uint32_t                State;
+  uint32_t                ErrorCode;
+  QSPI_CommandTypeDef     Command;      /* host: command of the next transfer */
+} QSPI_HandleTypeDef;
+
+#define HAL_QSPI_STATE_RESET            0x00U
+#define HAL_QSPI_STATE_READY            0x01U
+#define HAL_QSPI_STATE_BUSY_AUTO_POLLING 0x48U
+#define HAL_QSPI_STATE_BUSY_MEM_MAPPED  0x88U
+#define HAL_QSPI_ERROR_NONE             0x00U
+#define HAL_QPSI_TIMEOUT_DEFAULT_VALUE  5000U
+
+#define QSPI_SAMPLE_SHIFTING_NONE       0U
+#define QSPI_SAMPLE_SHIFTING_HALFCYCLE  1U
+#define QSPI_CS_HIGH_TIME_1_CYCLE       1U
+#define QSPI_CLOCK_MODE_0               0U
+#define QSPI_INSTRUCTION_NONE           0U
+#define QSPI_INSTRUCTION_1_LINE         1U
+#define QSPI_INSTRUCTION_2_LINES        2U
+#define QSPI_INSTRUCTION_4_LINES        4U
+#define QSPI_ADDRESS_NONE               0U
+#define QSPI_ADDRESS_1_LINE             1U
+#define QSPI_ADDRESS_2_LINES            2U
+#define QSPI_ADDRESS_4_LINES            4U
+#define QSPI_ADDRESS_8_BITS             1U
+#define QSPI_ADDRESS_16_BITS            2U
+#define QSPI_ADDRESS_24_BITS            3U
+#define QSPI_ADDRESS_32_BITS            4U
+#define QSPI_ALTERNATE_BYTES_NONE       0U
+#define QSPI_ALTERNATE_BYTES_1_LINE     1U
+#define QSPI_ALTERNATE_BYTES_2_LINES    2U
+#define QSPI_ALTERNATE_BYTES_4_LINES    4U
+#define QSPI_ALTERNATE_BYTES_8_BITS     1U
+#define QSPI_DATA_NONE                  0U
+#define QSPI_DATA_1_LINE                1U
+#define QSPI_DATA_2_LINES               2U
+#define QSPI_DATA_4_LINES               4U
+#define QSPI_DDR_MODE_DISABLE           0U
+#define QSPI_DDR_HHC_ANALOG_DELAY       0U
+#define QSPI_SIOO_INST_EVERY_CMD        0U
+#define QSPI_MATCH_MODE_AND             0U
+#define QSPI_AUTOMATIC_STOP_ENABLE      1U
+#define QSPI_TIMEOUT_COUNTER_DISABLE    0U
+
+#define QSPI_FLAG_TE                    QUADSPI_SR_TEF
+#define QSPI_FLAG_TC                    QUADSPI_SR_TCF
+#define QSPI_FLAG_SM                    QUADSPI_SR_SMF
+
+#define __HAL_QSPI_GET_FLAG(__HANDLE__, __FLAG__) \
+  ((READ_BIT((__HANDLE__)->Instance->SR, (__FLAG__)) != 0U) ? SET : RESET)
+
+HAL_StatusTypeDef HAL_QSPI_Init(QSPI_HandleTypeDef *hqspi);
+HAL_StatusTypeDef HAL_QSPI_DeInit(QSPI_HandleTypeDef *hqspi);
+HAL_StatusTypeDef HAL_QSPI_Command(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd, uint32_t Timeout);
+HAL_StatusTypeDef HAL_QSPI_Transmit(QSPI_HandleTypeDef *hqspi, uint8_t *pData, uint32_t Timeout);
+HAL_StatusTypeDef HAL_QSPI_Receive(QSPI_HandleTypeDef *hqspi, uint8_t *pData, uint32_t Timeout);
+HAL_StatusTypeDef HAL_QSPI_AutoPolling(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd, QSPI_AutoPollingTypeDef *cfg, uint32_t Timeout);
+HAL_StatusTypeDef HAL_QSPI_AutoPolling_IT(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd, QSPI_AutoPollingTypeDef *cfg);
+HAL_StatusTypeDef HAL_QSPI_MemoryMapped(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd, QSPI_MemoryMappedTypeDef *cfg);
+HAL_StatusTypeDef HAL_QSPI_Abort(QSPI_HandleTypeDef *hqspi);
+void              HAL_QSPI_IRQHandler(QSPI_HandleTypeDef *hqspi);
+uint32_t          HAL_QSPI_GetState(QSPI_HandleTypeDef *hqspi);
+
+#endif
@@ -0,0 +1,1098 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Host tests of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4HostHAL.c
+  * @brief   HAL of the host tests: the OSPI, QSPI, DMA, GPIO and RCC
+  *          functions over the memory model, in virtual time. A command
+  *          takes the time of its cycles on the bus, the automatic polling
+  *          reads the status at its interval, WFE advances the time to the
+  *          next event (end of a DMA transfer, status match, TIM6 update).
+  *          TIM2 counts HCLK and TIM6 its prescaled clock from the virtual
+  *          time. The memory-mapped reads fault on a page basis: each 4 kB
+  *          page is read once per memory-mapped session, in the time of a
+  *          read command of 4 kB; the CPU and the AHB take no time.
+  ******************************************************************************
+  */
+
+
+#define _GNU_SOURCE
+#include "stm32l4xx_hal.h"
+#include "STM32L4HostHAL.h"
+#include "STM32L4Tick.h"
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define HOST_PAGE               0x1000U
+
+/* Memory of the peripherals, mapped at their addresses */
+static const struct {
+  uintptr_t Base;
+  size_t    Size;
+} Host_Regions[] = {
+  { 0x40000000UL, 0x30000UL },          /* APB1, APB2, AHB1: TIM, PWR, DMA, RCC */
+  { 0x48000000UL, 0x03000UL },          /* GPIOA to GPIOI                       */
+  { 0xA0001000UL, 0x01000UL },          /* OCTOSPI1, OCTOSPI2, QUADSPI          */
+  { 0xE0000000UL, 0x10000UL }           /* ITM, DWT, SCB                        */
+};
+
+/* Bus of the memory */
+typedef struct {
+  uint32_t Prescaler;                   /* of the kernel clock                  */
+  uint32_t Csht;                        /* CS high cycles                       */
+  uint8_t  Quad;                        /* QUADSPI: clock HCLK/(Prescaler+1)    */
+} Host_BusTypeDef;
+
+/* Automatic polling */
+typedef struct {
+  uint8_t           Active;
+  uint8_t           Irq;                /* _IT: the SM flag at the match        */
+  NOR_CmdTypeDef    Cmd;
+  uint32_t          Bytes;
+  uint32_t          Match;
+  uint32_t          Mask;
+  uint64_t          Start;
+  uint64_t          Period;
+  uint64_t          Duration;
+  uint64_t          Index;              /* next poll                            */
+  __IO uint32_t    *Sr;
+} Host_PollTypeDef;
+
+/* Transmission by DMA */
+typedef struct {
+  uint8_t           Active;
+  uint64_t          End;
+  NOR_CmdTypeDef    Cmd;
+  uint32_t          Size;
+  uint8_t           Data[0x10000];
+  __IO uint32_t    *Sr;
+} Host_DmaTypeDef;
+
+/* Timers */
+typedef struct {
+  double            Tim2Ticks;
+  uint64_t          Tim2Last;
+  uint8_t           Tim6Running;
+  uint64_t          Tim6Base;
+  uint64_t          Tim6Wraps;
+} Host_TimTypeDef;
+
+/* Memory-mapped mode */
+typedef struct {
+  uint8_t           Active;
+  const char       *Reason;             /* read command wrong, NULL when right  */
+  NOR_CmdTypeDef    Cmd;
+  uint8_t          *Window;             /* 0x90000000                           */
+  uint8_t           Read[0x4000000 / HOST_PAGE / 8];
+} Host_MapTypeDef;
+
+Host_TypeDef            Host;
+uint32_t                SystemCoreClock = 4000000U;
+
+static Host_BusTypeDef  Host_Bus;
+static Host_PollTypeDef Host_Poll;
+static Host_DmaTypeDef  Host_Dma;
+static Host_TimTypeDef  Host_Tim;
+static Host_MapTypeDef  Host_Map;
+static uint8_t         *Host_Array;
+static uint32_t         Host_Size;
+static uint8_t          Host_Boost;
+static uint32_t         Host_PllM = 1U, Host_PllN = 8U, Host_PllR = 2U;
+static uint32_t         Host_Msi  = 4000000U;
+
+/* Private functions ---------------------------------------------------------*/
+
+static void Host_Fatal (const char *Format, ...) __attribute__((noreturn));
+
+static void Host_Fatal (const char *Format, ...) {
+  va_list args;
+
+  fprintf(stderr, "host: %12.3f ms: ", (double)Host.Now / 1e6);
+  va_start(args, Format);
+  vfprintf(stderr, Format, args);
+  va_end(args);
+  fputc('\n', stderr);
+  _exit(1);
+}
+
+/* Clock of the memory bus, Hz */
+static uint32_t Host_BusClock (void) {
+  if (Host_Bus.Quad != 0U) {
+    return (SystemCoreClock / (Host_Bus.Prescaler + 1U));
+  }
+  return (Host.SysClock / ((Host_Bus.Prescaler != 0U) ? Host_Bus.Prescaler : 1U));
+}
+
+/* Cycles of a phase */
+static uint32_t Host_Cycles (uint32_t Bytes, uint32_t Lines, uint32_t Dtr) {
+  uint32_t cycles;
+
+  if ((Lines == 0U) || (Bytes == 0U)) {
+    return (0U);
+  }
+  cycles = ((Bytes * 8U) + Lines - 1U) / Lines;
+  return ((Dtr != 0U) ? ((cycles + 1U) / 2U) : cycles);
+}
+
+/* Time of a command on the bus, ns */
+static uint64_t Host_BusTime (const NOR_CmdTypeDef *Cmd, uint32_t Size) {
+  uint64_t cycles;
+
+  cycles  = Host_Cycles(Cmd->InstructionBytes, Cmd->InstructionLines, Cmd->InstructionDtr);
+  cycles += Host_Cycles(Cmd->AddressBytes,     Cmd->AddressLines,     Cmd->AddressDtr);
+  cycles += Host_Cycles(Cmd->AlternateBytes,   Cmd->AlternateLines,   Cmd->AlternateDtr);
+  cycles += Cmd->DummyCycles;
+  cycles += Host_Cycles(Size,                  Cmd->DataLines,        Cmd->DataDtr);
+  cycles += Host_Bus.Csht + 2U;
+
+  return ((cycles * 1000000000ULL) / Cmd->Clock);
+}
+
+/* PCLK1, HCLK divided by RCC_CFGR_PPRE1 */
+static uint32_t Host_Pclk1 (void) {
+  uint32_t ppre1 = RCC->CFGR & RCC_CFGR_PPRE1;
+
+  return ((ppre1 < RCC_HCLK_DIV2) ? SystemCoreClock : (SystemCoreClock >> (((ppre1 >> 8) & 3U) + 1U)));
+}
+
+/* Counters of TIM2 (HCLK, free running) and TIM6 (prescaled, update flag),
+   TIM6 runs at twice PCLK1 when APB1 is divided */
+static uint64_t Host_Tim6Tick (void) {
+  uint32_t clock = ((RCC->CFGR & RCC_CFGR_PPRE1) == RCC_HCLK_DIV1) ? Host_Pclk1() : (2U * Host_Pclk1());
+
+  return (((uint64_t)(TIM6->PSC + 1U) * 1000000000ULL) / clock);
+}
+
+static void Host_SyncTimers (void) {
+  uint64_t tick;
+  uint64_t ticks;
+  uint64_t wraps;
+
+  Host_Tim.Tim2Ticks += ((double)(Host.Now - Host_Tim.Tim2Last) * SystemCoreClock) / 1e9;
+  Host_Tim.Tim2Last   = Host.Now;
+  TIM2->CNT = (uint32_t)(uint64_t)Host_Tim.Tim2Ticks;
+
+  tick = Host_Tim6Tick();
+  if ((TIM6->EGR & TIM_EGR_UG) != 0U) {
+    TIM6->EGR = 0U;
+    TIM6->CNT = 0U;
+    Host_Tim.Tim6Running = 0U;
+  }
+  if ((TIM6->CR1 & TIM_CR1_CEN) == 0U) {
+    Host_Tim.Tim6Running = 0U;
+    return;
+  }
+  if (Host_Tim.Tim6Running == 0U) {
+    Host_Tim.Tim6Running = 1U;
+    Host_Tim.Tim6Base    = Host.Now - ((uint64_t)TIM6->CNT * tick);
+    Host_Tim.Tim6Wraps   = 0U;
+  }
+  ticks = (Host.Now - Host_Tim.Tim6Base) / tick;
+  wraps = ticks / ((uint64_t)TIM6->ARR + 1U);
+  TIM6->CNT = (uint32_t)(ticks % ((uint64_t)TIM6->ARR + 1U));
+  if (wraps > Host_Tim.Tim6Wraps) {
+    Host_Tim.Tim6Wraps = wraps;
+    TIM6->SR |= TIM_SR_UIF;
+  }
+}
+
+/* Time of the next TIM6 update, NOR_NEVER when it does not wake up */
+static uint64_t Host_Tim6Next (void) {
+  if ((Host_Tim.Tim6Running == 0U) || ((TIM6->DIER & TIM_DIER_UIE) == 0U)) {
+    return (NOR_NEVER);
+  }
+  return (Host_Tim.Tim6Base +
+          ((Host_Tim.Tim6Wraps + 1U) * ((uint64_t)TIM6->ARR + 1U) * Host_Tim6Tick()));
+}
+
+/* Moves the time forward, the model and the timers follow */
+static void Host_Advance (uint64_t Time) {
+  if (Time > Host.Now) {
+    Host.Now = Time;
+  }
+  NOR_Sync(&Host.Model, Host.Now);
+  Host_SyncTimers();
+}
+
+static void Host_DmaEnd (void) {
+  Host_Dma.Active = 0U;
+  NOR_Transfer(&Host.Model, &Host_Dma.Cmd, Host_Dma.Data, Host_Dma.Size, 1U, 0U);
+  *Host_Dma.Sr |= OCTOSPI_SR_TCF;
+}
+
+/* Runs the polls ending at Until at the latest, 1 at the match. The status
+   does not change before the next event of the model, the polls up to it
+   are skipped. */
+static uint8_t Host_PollRun (uint64_t Until) {
+  uint8_t  data[4];
+  uint32_t value;
+  uint64_t end;
+  uint64_t next;
+  uint64_t k;
+  uint32_t i;
+
+  while (Host_Poll.Active != 0U) {
+    end = Host_Poll.Start + (Host_Poll.Index * Host_Poll.Period) + Host_Poll.Duration;
+    if (end > Until) {
+      return (0U);
+    }
+    Host_Advance(end);
+    NOR_Transfer(&Host.Model, &Host_Poll.Cmd, data, Host_Poll.Bytes, 0U, 1U);
+    value = 0U;
+    for (i = 0U; i < Host_Poll.Bytes; i++) {
+      value |= (uint32_t)data[i] << (8U * i);
+    }
+    if ((value & Host_Poll.Mask) == Host_Poll.Match) {
+      Host_Poll.Active = 0U;
+      return (1U);
+    }
+    Host_Poll.Index++;
+
+    next = NOR_NextEvent(&Host.Model);
+    if (next == NOR_NEVER) {
+      if (Until == NOR_NEVER) {
+        return (0U);
+      }
+      next = Until + 1U;
+    }
+    if (next > end) {
+      k = ((next - Host_Poll.Start - Host_Poll.Duration) + Host_Poll.Period - 1U) / Host_Poll.Period;
+      if (k > Host_Poll.Index) {
+        Host.Model.Stats.Polls += (uint32_t)(k - Host_Poll.Index);
+        Host_Poll.Index = k;
+      }
+    }
+  }
+  return (0U);
+}
+
+/* Moves the time to Time, the DMA transfer and the polling run meanwhile */
+static void Host_SetTime (uint64_t Time) {
+  if ((Host_Dma.Active != 0U) && (Host_Dma.End <= Time)) {
+    Host_Advance(Host_Dma.End);
+    Host_DmaEnd();
+  }
+  if ((Host_Poll.Active != 0U) && (Host_Poll.Irq != 0U)) {
+    if (Host_PollRun(Time) != 0U) {
+      *Host_Poll.Sr |= OCTOSPI_SR_SMF;
+    }
+  }
+  Host_Advance(Time);
+}
+
+/* Entry of each HAL function: the registers written since the last call
+   take effect */
+static void Host_Enter (void) {
+  if (++Host.Calls > HOST_CALL_LIMIT) {
+    Host_Fatal("%u HAL calls in a step, the loader waits endlessly", Host.Calls);
+  }
+  Host_Advance(Host.Now);
+}
+
+/* Command executed on the bus now */
+static void Host_Execute (const NOR_CmdTypeDef *Cmd, uint8_t *Data, uint32_t Size, uint8_t Write) {
+  Host_SetTime(Host.Now + Host_BusTime(Cmd, Size));
+  NOR_Transfer(&Host.Model, Cmd, Data, Size, Write, 0U);
+}
+
+static void Host_PollStart (const NOR_CmdTypeDef *Cmd, uint32_t Bytes, uint32_t Match,
+                            uint32_t Mask, uint32_t Interval, uint8_t Irq, __IO uint32_t *Sr) {
+  Host_Poll.Cmd      = *Cmd;
+  Host_Poll.Bytes    = (Bytes > 4U) ? 4U : Bytes;
+  Host_Poll.Match    = Match;
+  Host_Poll.Mask     = Mask;
+  Host_Poll.Irq      = Irq;
+  Host_Poll.Sr       = Sr;
+  Host_Poll.Start    = Host.Now;
+  Host_Poll.Duration = Host_BusTime(Cmd, Host_Poll.Bytes);
+  Host_Poll.Period   = Host_Poll.Duration + (((uint64_t)Interval * 1000000000ULL) / Cmd->Clock);
+  Host_Poll.Index    = 0U;
+  Host_Poll.Active   = 1U;
+}
+
+/* Blocking polling, HAL_OK at the match, HAL_ERROR at the timeout (ms) */
+static HAL_StatusTypeDef Host_PollWait (uint32_t Timeout) {
+  uint64_t until = Host.Now + ((uint64_t)Timeout * 1000000ULL);
+
+  if (Host_PollRun(until) != 0U) {
+    Host_Advance(Host.Now);
+    return (HAL_OK);
+  }
+  Host_Poll.Active = 0U;
+  Host_Advance(until);
+  return (HAL_ERROR);
+}
+
+/* Memory-mapped mode */
+static void Host_MapStart (const NOR_CmdTypeDef *Cmd) {
+  Host_Map.Cmd    = *Cmd;
+  Host_Map.Reason = Host.Model.Device->CheckRead(&Host.Model, Cmd);
+  Host_Map.Active = 1U;
+}
+
+static void Host_MapStop (void) {
+  if (Host_Map.Window != NULL) {
+    mprotect(Host_Map.Window, Host_Size, PROT_NONE);
+  }
+  memset(Host_Map.Read, 0, sizeof(Host_Map.Read));
+  Host_Map.Active = 0U;
+}
+
+/* Read of the memory-mapped Flash: the page becomes readable */
+static void Host_Fault (int Signal, siginfo_t *Info, void *Context) {
+  uintptr_t address = (uintptr_t)Info->si_addr;
+  uint32_t  page;
+
+  (void)Signal;
+  (void)Context;
+
+  if ((address < HOST_FLASH_BASE) || (address >= (HOST_FLASH_BASE + Host_Size))) {
+    Host_Fatal("segmentation fault at %p", Info->si_addr);
+  }
+  page = (uint32_t)(address - HOST_FLASH_BASE) / HOST_PAGE;
+  if (Host_Map.Active == 0U) {
+    Host_Fatal("read at 0x%08lX outside the memory-mapped mode", (unsigned long)address);
+  }
+  if (Host_Map.Reason != NULL) {
+    Host_Fatal("memory-mapped read at 0x%08lX, wrong read command: %s", (unsigned long)address, Host_Map.Reason);
+  }
+  if ((Host_Map.Read[page / 8U] & (1U << (page % 8U))) != 0U) {
+    Host_Fatal("write at 0x%08lX in the memory-mapped Flash", (unsigned long)address);
+  }
+  NOR_Sync(&Host.Model, Host.Now);
+  if (NOR_Busy(&Host.Model)) {
+    Host_Fatal("memory-mapped read at 0x%08lX while the memory is busy", (unsigned long)address);
+  }
+
+  Host_Map.Read[page / 8U] |= (uint8_t)(1U << (page % 8U));
+  mprotect(Host_Map.Window + (page * HOST_PAGE), HOST_PAGE, PROT_READ);
+  Host.MappedPages++;
+  Host.Model.Stats.BytesRead += HOST_PAGE;
+  Host_Advance(Host.Now + Host_BusTime(&Host_Map.Cmd, HOST_PAGE));
+}
+
+/* Flags of the interface waking up WFE, the TIM6 update */
+static uint8_t Host_Pending (void) {
+  if ((OCTOSPI1->SR & (OCTOSPI_SR_TEF | OCTOSPI_SR_TCF | OCTOSPI_SR_SMF)) != 0U) {
+    return (1U);
+  }
+  return (((TIM6->SR & TIM_SR_UIF) != 0U) && ((TIM6->DIER & TIM_DIER_UIE) != 0U)) ? 1U : 0U;
+}
+
+/* Command of the OSPI HAL, the fields of the phases present only */
+static void Host_OspiCmd (const OSPI_RegularCmdTypeDef *c, NOR_CmdTypeDef *Cmd) {
+  memset(Cmd, 0, sizeof(NOR_CmdTypeDef));
+  if (c->InstructionMode != HAL_OSPI_INSTRUCTION_NONE) {
+    Cmd->Instruction      = c->Instruction;
+    Cmd->InstructionLines = (uint8_t)c->InstructionMode;
+    Cmd->InstructionBytes = (uint8_t)c->InstructionSize;
+    Cmd->InstructionDtr   = (uint8_t)c->InstructionDtrMode;
+  }
+  if (c->AddressMode != HAL_OSPI_ADDRESS_NONE) {
+    Cmd->Address          = c->Address;
+    Cmd->AddressLines     = (uint8_t)c->AddressMode;
+    Cmd->AddressBytes     = (uint8_t)c->AddressSize;
+    Cmd->AddressDtr       = (uint8_t)c->AddressDtrMode;
+  }
+  if (c->AlternateBytesMode != HAL_OSPI_ALTERNATE_BYTES_NONE) {
+    Cmd->Alternate        = c->AlternateBytes;
+    Cmd->AlternateLines   = (uint8_t)c->AlternateBytesMode;
+    Cmd->AlternateBytes   = (uint8_t)c->AlternateBytesSize;
+    Cmd->AlternateDtr     = (uint8_t)c->AlternateBytesDtrMode;
+  }
+  if (c->DataMode != HAL_OSPI_DATA_NONE) {
+    Cmd->DataLines        = (uint8_t)c->DataMode;
+    Cmd->DataDtr          = (uint8_t)c->DataDtrMode;
+  }
+  Cmd->DummyCycles        = c->DummyCycles;
+  Cmd->Dqs                = (uint8_t)c->DQSMode;
+  Cmd->Clock              = Host_BusClock();
+}
+
+/* Command of the QSPI HAL */
+static void Host_QspiCmd (const QSPI_CommandTypeDef *c, NOR_CmdTypeDef *Cmd) {
+  memset(Cmd, 0, sizeof(NOR_CmdTypeDef));
+  if (c->InstructionMode != QSPI_INSTRUCTION_NONE) {
+    Cmd->Instruction      = c->Instruction;
+    Cmd->InstructionLines = (uint8_t)c->InstructionMode;
+    Cmd->InstructionBytes = 1U;
+    Cmd->InstructionDtr   = (uint8_t)c->DdrMode;
+  }
+  if (c->AddressMode != QSPI_ADDRESS_NONE) {
+    Cmd->Address          = c->Address;
+    Cmd->AddressLines     = (uint8_t)c->AddressMode;
+    Cmd->AddressBytes     = (uint8_t)c->AddressSize;
+    Cmd->AddressDtr       = (uint8_t)c->DdrMode;
+  }
+  if (c->AlternateByteMode != QSPI_ALTERNATE_BYTES_NONE) {
+    Cmd->Alternate        = c->AlternateBytes;
+    Cmd->AlternateLines   = (uint8_t)c->AlternateByteMode;
+    Cmd->AlternateBytes   = (uint8_t)c->AlternateBytesSize;
+    Cmd->AlternateDtr     = (uint8_t)c->DdrMode;
+  }
+  if (c->DataMode != QSPI_DATA_NONE) {
+    Cmd->DataLines        = (uint8_t)c->DataMode;
+    Cmd->DataDtr          = (uint8_t)c->DdrMode;
+  }
+  Cmd->DummyCycles        = c->DummyCycles;
+  Cmd->Clock              = Host_BusClock();
+}
+
+/* Exported functions: host ---------------------------------------------------*/
+
+/**
+  * @brief  Maps the peripherals and the Flash, the model of Device with the
+  *         timings Timing (NULL: the defaults of the device). Called again,
+  *         the memory is erased and the peripherals reset.
+  */
+void Host_Init (const NOR_DeviceTypeDef *Device, const NOR_TimingTypeDef *Timing) {
+  static uint8_t   mapped;
+  struct sigaction action;
+  uint32_t         i;
+  void            *p;
+  int              fd;
+
+  if (mapped == 0U) {
+    for (i = 0U; i < (sizeof(Host_Regions) / sizeof(Host_Regions[0])); i++) {
+      p = mmap((void *)Host_Regions[i].Base, Host_Regions[i].Size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+      if (p != (void *)Host_Regions[i].Base) {
+        Host_Fatal("cannot map the peripherals at 0x%08lX", (unsigned long)Host_Regions[i].Base);
+      }
+    }
+
+    /* The array, shared by the model and the memory-mapped window */
+    Host_Size = Device->Size;
+    fd = memfd_create("nor", 0);
+    if ((fd < 0) || (ftruncate(fd, Host_Size) != 0)) {
+      Host_Fatal("cannot create the array");
+    }
+    Host_Array = mmap(NULL, Host_Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    p = mmap((void *)HOST_FLASH_BASE, Host_Size, PROT_NONE, MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0);
+    if ((Host_Array == MAP_FAILED) || (p != (void *)HOST_FLASH_BASE)) {
+      Host_Fatal("cannot map the Flash at 0x%08lX", HOST_FLASH_BASE);
+    }
+    Host_Map.Window = p;
+    close(fd);
+
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = Host_Fault;
+    action.sa_flags     = SA_SIGINFO | SA_NODEFER;
+    sigaction(SIGSEGV, &action, NULL);
+    mapped = 1U;
+  } else if (Device->Size != Host_Size) {
+    Host_Fatal("one memory size per test program");
+  }
+
+  for (i = 0U; i < (sizeof(Host_Regions) / sizeof(Host_Regions[0])); i++) {
+    memset((void *)Host_Regions[i].Base, 0, Host_Regions[i].Size);
+  }
+  Host_MapStop();
+  memset(&Host_Poll, 0, sizeof(Host_Poll));
+  memset(&Host_Bus,  0, sizeof(Host_Bus));
+  Host_Dma.Active = 0U;
+  Host_Tim.Tim6Running = 0U;
+  Host_Tim.Tim2Last    = Host.Now;
+
+  Host.Errors      = 0U;
+  Host.MappedPages = 0U;
+  Host.Wfe         = 0U;
+  Host.Calls       = 0U;
+  Host.Apb1Divider = 0U;
+  SystemInit();
+  NOR_Init(&Host.Model, Device, Timing, Host_Array);
+}
+
+/**
+  * @brief  Starts a step of the test, the count of the HAL calls against
+  *         endless waits.
+  */
+void Host_Watch (void) {
+  Host.Calls = 0U;
+}
+
+/**
+  * @brief  Misuse of the HAL or of the peripherals, reported on stderr.
+  */
+void Host_Error (const char *Format, ...) {
+  va_list args;
+
+  Host.Errors++;
+  fprintf(stderr, "host: %12.3f ms: ", (double)Host.Now / 1e6);
+  va_start(args, Format);
+  vfprintf(stderr, Format, args);
+  va_end(args);
+  fputc('\n', stderr);
+}
+
+/* Exported functions: core and system ----------------------------------------*/
+
+void __WFE (void) {
+  uint64_t target;
+  uint64_t next;
+
+  Host_Enter();
+  Host.Wfe++;
+  if (Host_Pending() != 0U) {
+    return;
+  }
+
+  target = (Host_Dma.Active != 0U) ? Host_Dma.End : NOR_NEVER;
+  next   = Host_Tim6Next();
+  if (next < target) {
+    target = next;
+  }
+  if ((Host_Poll.Active != 0U) && (Host_Poll.Irq != 0U)) {
+    if (Host_PollRun(target) != 0U) {
+      *Host_Poll.Sr |= OCTOSPI_SR_SMF;
+      Host_Advance(Host.Now);
+      return;
+    }
+  }
+  if (target == NOR_NEVER) {
+    Host_Fatal("WFE without a wake-up event, the wait never ends");
+  }
+  Host_SetTime(target);
+}
+
+void NVIC_DisableIRQ (IRQn_Type IRQn) {
+  (void)IRQn;
+  Host_Enter();
+}
+
+void NVIC_ClearPendingIRQ (IRQn_Type IRQn) {
+  (void)IRQn;
+  Host_Enter();
+}
+
+void SystemInit (void) {
+  Host.SysClock   = Host_Msi;
+  SystemCoreClock = Host_Msi;
+  Host_Boost      = 0U;
+}
+
+HAL_StatusTypeDef HAL_Init (void) {
+  Host_Enter();
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_InitTick (uint32_t TickPriority) {
+  (void)TickPriority;
+  return (HAL_OK);
+}
+
+uint32_t HAL_GetTick (void) {
+  Host_Enter();
+  return ((uint32_t)(Host.Now / 1000000ULL));
+}
+
+void HAL_Delay (uint32_t Delay) {
+  Host_Enter();
+  Host_SetTime(Host.Now + ((uint64_t)Delay * 1000000ULL));
+}
+
+void Tick_DelayUs (uint32_t Delay) {
+  Host_Enter();
+  Host_SetTime(Host.Now + ((uint64_t)Delay * 1000ULL));
+}
+
+/* Exported functions: RCC and PWR ---------------------------------------------*/
+
+HAL_StatusTypeDef HAL_PWREx_ControlVoltageScaling (uint32_t VoltageScaling) {
+  Host_Enter();
+  Host_Boost = (VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE1_BOOST) ? 1U : 0U;
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_RCC_OscConfig (RCC_OscInitTypeDef *RCC_OscInitStruct) {
+  static const uint32_t msi[12] = {
+    100000U, 200000U, 400000U, 800000U, 1000000U, 2000000U,
+    4000000U, 8000000U, 16000000U, 24000000U, 32000000U, 48000000U
+  };
+
+  Host_Enter();
+  if ((RCC_OscInitStruct->OscillatorType & RCC_OSCILLATORTYPE_MSI) != 0U) {
+    Host_Msi = msi[(RCC_OscInitStruct->MSIClockRange >> 4) % 12U];
+  }
+  if (RCC_OscInitStruct->PLL.PLLState == RCC_PLL_ON) {
+    Host_PllM = RCC_OscInitStruct->PLL.PLLM;
+    Host_PllN = RCC_OscInitStruct->PLL.PLLN;
+    Host_PllR = RCC_OscInitStruct->PLL.PLLR;
+    if ((Host_PllM == 0U) || (Host_PllR == 0U)) {
+      Host_Error("PLL with a divider of 0");
+      return (HAL_ERROR);
+    }
+  }
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_RCC_ClockConfig (RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t FLatency) {
+  uint32_t sysclk = Host.SysClock;
+  uint32_t hclk;
+  uint32_t step   = (Host_Boost != 0U) ? 20000000U : 16000000U;
+
+  Host_Enter();
+  if ((RCC_ClkInitStruct->ClockType & RCC_CLOCKTYPE_SYSCLK) != 0U) {
+    sysclk = (RCC_ClkInitStruct->SYSCLKSource == RCC_SYSCLKSOURCE_PLLCLK) ?
+             ((Host_Msi / Host_PllM) * Host_PllN) / Host_PllR : Host_Msi;
+  }
+  hclk = sysclk / ((RCC_ClkInitStruct->AHBCLKDivider != 0U) ? RCC_ClkInitStruct->AHBCLKDivider : 1U);
+
+  if (hclk > ((Host_Boost != 0U) ? 120000000U : 80000000U)) {
+    Host_Error("HCLK of %u Hz above the range of the regulator", hclk);
+  }
+  if (hclk > (step * (FLatency + 1U))) {
+    Host_Error("HCLK of %u Hz with %u Flash wait states", hclk, FLatency);
+  }
+  Host.SysClock   = sysclk;
+  SystemCoreClock = hclk;
+  if ((RCC_ClkInitStruct->ClockType & RCC_CLOCKTYPE_PCLK1) != 0U) {
+    RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_PPRE1) | RCC_ClkInitStruct->APB1CLKDivider;
+  }
+  if (Host.Apb1Divider != 0U) {
+    RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_PPRE1) | Host.Apb1Divider;
+  }
+  return (HAL_OK);
+}
+
+uint32_t HAL_RCC_GetSysClockFreq (void) {
+  return (Host.SysClock);
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq (void) {
+  Host_Enter();
+  return (Host_Pclk1());
+}
+
+/* Exported functions: GPIO ---------------------------------------------------*/
+
+void HAL_GPIO_Init (GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init) {
+  uint32_t port = (uint32_t)(((uintptr_t)GPIOx - GPIOA_BASE) / (GPIOB_BASE - GPIOA_BASE));
+
+  (void)GPIO_Init;
+  Host_Enter();
+  /* Without its clock the port ignores the writes, as the MspDeInit before
+     the first Init does */
+  if ((RCC->AHB2ENR & (RCC_AHB2ENR_GPIOAEN << port)) == 0U) {
+    return;
+  }
+  if ((port == 6U) && ((PWR->CR2 & PWR_CR2_IOSV) == 0U)) {
+    Host_Error("GPIOG configured with VDDIO2 not valid (PWR_CR2_IOSV)");
+  }
+}
+
+void HAL_GPIO_DeInit (GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin) {
+  (void)GPIOx;
+  (void)GPIO_Pin;
+  Host_Enter();
+}
+
+void HAL_GPIO_WritePin (GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+  (void)GPIOx;
+  (void)GPIO_Pin;
+  (void)PinState;
+  Host_Enter();
+}
+
+/* Exported functions: DMA ----------------------------------------------------*/
+
+HAL_StatusTypeDef HAL_DMA_Init (DMA_HandleTypeDef *hdma) {
+  Host_Enter();
+  if (hdma->Instance == NULL) {
+    return (HAL_ERROR);
+  }
+  hdma->State = HAL_DMA_STATE_READY;
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_DMA_DeInit (DMA_HandleTypeDef *hdma) {
+  Host_Enter();
+  hdma->State = HAL_DMA_STATE_RESET;
+  return (HAL_OK);
+}
+
+void HAL_DMA_IRQHandler (DMA_HandleTypeDef *hdma) {
+  (void)hdma;
+  Host_Enter();
+}
+
+HAL_DMA_StateTypeDef HAL_DMA_GetState (DMA_HandleTypeDef *hdma) {
+  Host_Enter();
+  return ((Host_Dma.Active != 0U) ? HAL_DMA_STATE_BUSY : hdma->State);
+}
+
+/* Exported functions: OSPI ---------------------------------------------------*/
+
+/* The HAL applies the configuration from the reset state only */
+HAL_StatusTypeDef HAL_OSPI_Init (OSPI_HandleTypeDef *hospi) {
+  Host_Enter();
+  if ((hospi->Instance != OCTOSPI1) && (hospi->Instance != OCTOSPI2)) {
+    Host_Error("OSPI handle without instance");
+    return (HAL_ERROR);
+  }
+  if (hospi->State == HAL_OSPI_STATE_RESET) {
+    Host_Bus.Quad      = 0U;
+    Host_Bus.Prescaler = hospi->Init.ClockPrescaler;
+    Host_Bus.Csht      = hospi->Init.ChipSelectHighTime;
+    hospi->ErrorCode   = HAL_OSPI_ERROR_NONE;
+    hospi->State       = HAL_OSPI_STATE_READY;
+  }
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_OSPI_DeInit (OSPI_HandleTypeDef *hospi) {
+  Host_Enter();
+  if (hospi->Instance == NULL) {
+    return (HAL_ERROR);
+  }
+  Host_Poll.Active = 0U;
+  Host_Dma.Active  = 0U;
+  Host_MapStop();
+  hospi->Instance->SR = 0U;
+  hospi->Instance->CR = 0U;
+  hospi->State        = HAL_OSPI_STATE_RESET;
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_OSPIM_Config (OSPI_HandleTypeDef *hospi, OSPIM_CfgTypeDef *cfg, uint32_t Timeout) {
+  (void)cfg;
+  (void)Timeout;
+  Host_Enter();
+  return ((hospi->State == HAL_OSPI_STATE_READY) ? HAL_OK : HAL_ERROR);
+}
+
+HAL_StatusTypeDef HAL_OSPI_Command (OSPI_HandleTypeDef *hospi, OSPI_RegularCmdTypeDef *cmd, uint32_t Timeout) {
+  NOR_CmdTypeDef command;
+
+  (void)Timeout;
+  Host_Enter();
+  if ((hospi->State != HAL_OSPI_STATE_READY) && (hospi->State != HAL_OSPI_STATE_CMD_CFG)) {
+    return (HAL_BUSY);
+  }
+
+  if (cmd->OperationType == HAL_OSPI_OPTYPE_READ_CFG) {
+    hospi->ReadCfg = *cmd;
+    hospi->State   = HAL_OSPI_STATE_CMD_CFG;
+    return (HAL_OK);
+  }
+  if (cmd->OperationType == HAL_OSPI_OPTYPE_WRITE_CFG) {
+    hospi->State   = HAL_OSPI_STATE_CMD_CFG;
+    return (HAL_OK);
+  }
+
+  hospi->Command = *cmd;
+  if (cmd->DataMode == HAL_OSPI_DATA_NONE) {
+    Host_OspiCmd(cmd, &command);
+    Host_Execute(&command, NULL, 0U, 0U);
+    hospi->State = HAL_OSPI_STATE_READY;
+  } else {
+    hospi->State = HAL_OSPI_STATE_CMD_CFG;
+  }
+  return (HAL_OK);
+}
+
+static HAL_StatusTypeDef Host_OspiData (OSPI_HandleTypeDef *hospi, uint8_t *pData, uint8_t Write) {
+  NOR_CmdTypeDef command;
+
+  Host_Enter();
+  if ((hospi->State != HAL_OSPI_STATE_CMD_CFG) || (hospi->Command.DataMode == HAL_OSPI_DATA_NONE)) {
+    Host_Error("OSPI transfer without a command of data");
+    return (HAL_ERROR);
+  }
+  Host_OspiCmd(&hospi->Command, &command);
+  Host_Execute(&command, pData, hospi->Command.NbData, Write);
+  hospi->State = HAL_OSPI_STATE_READY;
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_OSPI_Transmit (OSPI_HandleTypeDef *hospi, uint8_t *pData, uint32_t Timeout) {
+  (void)Timeout;
+  return (Host_OspiData(hospi, pData, 1U));
+}
+
+HAL_StatusTypeDef HAL_OSPI_Receive (OSPI_HandleTypeDef *hospi, uint8_t *pData, uint32_t Timeout) {
+  (void)Timeout;
+  return (Host_OspiData(hospi, pData, 0U));
+}
+
+HAL_StatusTypeDef HAL_OSPI_Transmit_DMA (OSPI_HandleTypeDef *hospi, uint8_t *pData) {
+  Host_Enter();
+  if ((hospi->State != HAL_OSPI_STATE_CMD_CFG) || (hospi->Command.DataMode == HAL_OSPI_DATA_NONE) ||
+      (hospi->Command.NbData > sizeof(Host_Dma.Data))) {
+    Host_Error("OSPI DMA transfer without a command of data");
+    return (HAL_ERROR);
+  }
+  if ((hospi->hdma == NULL) || (hospi->hdma->State != HAL_DMA_STATE_READY)) {
+    Host_Error("OSPI DMA transfer without a DMA channel ready");
+    return (HAL_ERROR);
+  }
+  Host_OspiCmd(&hospi->Command, &Host_Dma.Cmd);
+  Host_Dma.Size = hospi->Command.NbData;
+  memcpy(Host_Dma.Data, pData, Host_Dma.Size);
+  Host_Dma.End    = Host.Now + Host_BusTime(&Host_Dma.Cmd, Host_Dma.Size);
+  Host_Dma.Sr     = &hospi->Instance->SR;
+  Host_Dma.Active = 1U;
+  hospi->Instance->CR |= OCTOSPI_CR_DMAEN;
+  hospi->State = HAL_OSPI_STATE_BUSY_TX;
+  return (HAL_OK);
+}
+
+static HAL_StatusTypeDef Host_OspiPoll (OSPI_HandleTypeDef *hospi, OSPI_AutoPollingTypeDef *cfg, uint8_t Irq) {
+  NOR_CmdTypeDef command;
+
+  if ((hospi->State != HAL_OSPI_STATE_CMD_CFG) || (hospi->Command.DataMode == HAL_OSPI_DATA_NONE)) {
+    Host_Error("OSPI automatic polling without a command of data");
+    return (HAL_ERROR);
+  }
+  Host_OspiCmd(&hospi->Command, &command);
+  Host_PollStart(&command, hospi->Command.NbData, cfg->Match, cfg->Mask, cfg->Interval, Irq,
+                 &hospi->Instance->SR);
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_OSPI_AutoPolling (OSPI_HandleTypeDef *hospi, OSPI_AutoPollingTypeDef *cfg, uint32_t Timeout) {
+  Host_Enter();
+  if (Host_OspiPoll(hospi, cfg, 0U) != HAL_OK) {
+    return (HAL_ERROR);
+  }
+  hospi->State = HAL_OSPI_STATE_READY;
+  if (Host_PollWait(Timeout) != HAL_OK) {
+    hospi->ErrorCode = HAL_OSPI_ERROR_TIMEOUT;
+    return (HAL_ERROR);
+  }
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_OSPI_AutoPolling_IT (OSPI_HandleTypeDef *hospi, OSPI_AutoPollingTypeDef *cfg) {
+  Host_Enter();
+  if (Host_OspiPoll(hospi, cfg, 1U) != HAL_OK) {
+    return (HAL_ERROR);
+  }
+  hospi->State = HAL_OSPI_STATE_BUSY_AUTO_POLLING;
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_OSPI_MemoryMapped (OSPI_HandleTypeDef *hospi, OSPI_MemoryMappedTypeDef *cfg) {
+  NOR_CmdTypeDef command;
+
+  (void)cfg;
+  Host_Enter();
+  if ((hospi->State != HAL_OSPI_STATE_CMD_CFG) || (hospi->ReadCfg.OperationType != HAL_OSPI_OPTYPE_READ_CFG)) {
+    Host_Error("OSPI memory-mapped mode without its read command");
+    return (HAL_ERROR);
+  }
+  Host_OspiCmd(&hospi->ReadCfg, &command);
+  Host_MapStart(&command);
+  hospi->State = HAL_OSPI_STATE_BUSY_MEM_MAPPED;
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_OSPI_Abort (OSPI_HandleTypeDef *hospi) {
+  Host_Enter();
+  Host_Poll.Active = 0U;
+  Host_Dma.Active  = 0U;
+  Host_MapStop();
+  hospi->Instance->SR  = 0U;
+  hospi->Instance->CR &= ~OCTOSPI_CR_DMAEN;
+  hospi->State = HAL_OSPI_STATE_READY;
+  return (HAL_OK);
+}
+
+void HAL_OSPI_IRQHandler (OSPI_HandleTypeDef *hospi) {
+  Host_Enter();
+  if ((hospi->Instance->SR & OCTOSPI_SR_TCF) != 0U) {
+    hospi->Instance->SR &= ~OCTOSPI_SR_TCF;
+    hospi->Instance->CR &= ~OCTOSPI_CR_DMAEN;
+    hospi->State = HAL_OSPI_STATE_READY;
+  }
+  if ((hospi->Instance->SR & OCTOSPI_SR_SMF) != 0U) {
+    hospi->Instance->SR &= ~OCTOSPI_SR_SMF;
+    hospi->State = HAL_OSPI_STATE_READY;
+  }
+  if ((hospi->Instance->SR & OCTOSPI_SR_TEF) != 0U) {
+    hospi->Instance->SR &= ~OCTOSPI_SR_TEF;
+    hospi->State = HAL_OSPI_STATE_READY;
+  }
+}
+
+uint32_t HAL_OSPI_GetState (OSPI_HandleTypeDef *hospi) {
+  Host_Enter();
+  return (hospi->State);
+}
+
+/* Exported functions: QSPI ---------------------------------------------------*/
+
+/* The command of the data phase waits in the handle for Transmit/Receive */
+static uint8_t Host_QspiPending;
+
+HAL_StatusTypeDef HAL_QSPI_Init (QSPI_HandleTypeDef *hqspi) {
+  Host_Enter();
+  if (hqspi->Instance != QUADSPI) {
+    Host_Error("QSPI handle without instance");
+    return (HAL_ERROR);
+  }
+  Host_Bus.Quad      = 1U;
+  Host_Bus.Prescaler = hqspi->Init.ClockPrescaler;
+  Host_Bus.Csht      = hqspi->Init.ChipSelectHighTime;
+  Host_QspiPending   = 0U;
+  hqspi->ErrorCode   = HAL_QSPI_ERROR_NONE;
+  hqspi->State       = HAL_QSPI_STATE_READY;
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_QSPI_DeInit (QSPI_HandleTypeDef *hqspi) {
+  Host_Enter();
+  if (hqspi->Instance == NULL) {
+    return (HAL_ERROR);
+  }
+  Host_Poll.Active = 0U;
+  Host_MapStop();
+  Host_QspiPending    = 0U;
+  hqspi->Instance->SR = 0U;
+  hqspi->State        = HAL_QSPI_STATE_RESET;
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_QSPI_Command (QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd, uint32_t Timeout) {
+  NOR_CmdTypeDef command;
+
+  (void)Timeout;
+  Host_Enter();
+  if (hqspi->State != HAL_QSPI_STATE_READY) {
+    return (HAL_BUSY);
+  }
+  hqspi->Command = *cmd;
+  if (cmd->DataMode == QSPI_DATA_NONE) {
+    Host_QspiCmd(cmd, &command);
+    Host_Execute(&command, NULL, 0U, 0U);
+    Host_QspiPending = 0U;
+  } else {
+    Host_QspiPending = 1U;
+  }
+  return (HAL_OK);
+}
+
+static HAL_StatusTypeDef Host_QspiData (QSPI_HandleTypeDef *hqspi, uint8_t *pData, uint8_t Write) {
+  NOR_CmdTypeDef command;
+
+  Host_Enter();
+  if ((hqspi->State != HAL_QSPI_STATE_READY) || (Host_QspiPending == 0U)) {
+    Host_Error("QSPI transfer without a command of data");
+    return (HAL_ERROR);
+  }
+  Host_QspiPending = 0U;
+  Host_QspiCmd(&hqspi->Command, &command);
+  Host_Execute(&command, pData, hqspi->Command.NbData, Write);
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_QSPI_Transmit (QSPI_HandleTypeDef *hqspi, uint8_t *pData, uint32_t Timeout) {
+  (void)Timeout;
+  return (Host_QspiData(hqspi, pData, 1U));
+}
+
+HAL_StatusTypeDef HAL_QSPI_Receive (QSPI_HandleTypeDef *hqspi, uint8_t *pData, uint32_t Timeout) {
+  (void)Timeout;
+  return (Host_QspiData(hqspi, pData, 0U));
+}
+
+HAL_StatusTypeDef HAL_QSPI_AutoPolling (QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd,
+                                        QSPI_AutoPollingTypeDef *cfg, uint32_t Timeout) {
+  NOR_CmdTypeDef command;
+
+  Host_Enter();
+  if (hqspi->State != HAL_QSPI_STATE_READY) {
+    return (HAL_BUSY);
+  }
+  Host_QspiCmd(cmd, &command);
+  Host_PollStart(&command, cfg->StatusBytesSize, cfg->Match, cfg->Mask, cfg->Interval, 0U,
+                 &hqspi->Instance->SR);
+  return (Host_PollWait(Timeout));
+}
+
+HAL_StatusTypeDef HAL_QSPI_AutoPolling_IT (QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd,
+                                           QSPI_AutoPollingTypeDef *cfg) {
+  NOR_CmdTypeDef command;
+
+  Host_Enter();
+  if (hqspi->State != HAL_QSPI_STATE_READY) {
+    return (HAL_BUSY);
+  }
+  Host_QspiCmd(cmd, &command);
+  Host_PollStart(&command, cfg->StatusBytesSize, cfg->Match, cfg->Mask, cfg->Interval, 1U,
+                 &hqspi->Instance->SR);
+  hqspi->State = HAL_QSPI_STATE_BUSY_AUTO_POLLING;
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_QSPI_MemoryMapped (QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd,
+                                         QSPI_MemoryMappedTypeDef *cfg) {
+  NOR_CmdTypeDef command;
+
+  (void)cfg;
+  Host_Enter();
+  if (hqspi->State != HAL_QSPI_STATE_READY) {
+    return (HAL_BUSY);
+  }
+  Host_QspiCmd(cmd, &command);
+  Host_MapStart(&command);
+  hqspi->State = HAL_QSPI_STATE_BUSY_MEM_MAPPED;
+  return (HAL_OK);
+}
+
+HAL_StatusTypeDef HAL_QSPI_Abort (QSPI_HandleTypeDef *hqspi) {
+  Host_Enter();
+  Host_Poll.Active = 0U;
+  Host_MapStop();
+  Host_QspiPending    = 0U;
+  hqspi->Instance->SR = 0U;
+  hqspi->State        = HAL_QSPI_STATE_READY;
+  return (HAL_OK);
+}
+
+void HAL_QSPI_IRQHandler (QSPI_HandleTypeDef *hqspi) {
+  Host_Enter();
+  if ((hqspi->Instance->SR & (QUADSPI_SR_SMF | QUADSPI_SR_TEF)) != 0U) {
+    hqspi->Instance->SR &= ~(QUADSPI_SR_SMF | QUADSPI_SR_TEF);
+    hqspi->State = HAL_QSPI_STATE_READY;
+  }
+}
+
+uint32_t HAL_QSPI_GetState (QSPI_HandleTypeDef *hqspi) {
+  Host_Enter();
+  return (hqspi->State);
+}
@@ -0,0 +1,74 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Host tests of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4HostHAL.h
+  * @brief   Host side of the tests: the virtual time, the peripherals mapped
+  *          at their addresses and the Flash memory-mapped at 0x90000000,
+  *          over the model of the memory.
+  ******************************************************************************
+  */
+
+
+#ifndef __STM32L4HOSTHAL_H
+#define __STM32L4HOSTHAL_H
+#include "stdint.h"
+
+#include "STM32L4NorModel.h"
+
+#define HOST_FLASH_BASE         0x90000000UL
+#define HOST_CALL_LIMIT         20000000U     /* HAL calls of a step, beyond: endless wait */
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  NOR_ModelTypeDef Model;
+  uint64_t         Now;             /* virtual time, ns                          */
+  uint32_t         Calls;           /* HAL calls since Host_Watch                */
+  uint32_t         Errors;          /* misuses of the HAL and of the peripherals */
+  uint32_t         MappedPages;     /* 4 kB pages read in memory-mapped mode     */
+  uint32_t         Wfe;             /* WFE executed                              */
+  uint32_t         SysClock;        /* Hz                                        */
+  uint32_t         Apb1Divider;     /* RCC_HCLK_DIVx forced, 0: as configured    */
+} Host_TypeDef;
+
+extern Host_TypeDef Host;
+
+extern const NOR_DeviceTypeDef NOR_MX25LM51245G;
+extern const NOR_DeviceTypeDef NOR_N25Q128A;
+
+/* Exported functions --------------------------------------------------------*/
+void Host_Init  (const NOR_DeviceTypeDef *Device, const NOR_TimingTypeDef *Timing);
+void Host_Watch (void);
+void Host_Error (const char *Format, ...);
+
+#endif
@@ -0,0 +1,406 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Host tests of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4HostTest.c
+  * @brief   Tests of the external loaders on the host: the FlashOS entry
+  *          points of MX25LM51245G_STM32L4R9I-DK (HOST_OSPI) or of
+  *          N25Q128A_STM32L476G-DISCO (HOST_QSPI), compiled natively over
+  *          STM32L4HostHAL.c and the memory models, then the benchmark.
+  *          The program returns 0 when all the tests pass.
+  ******************************************************************************
+  */
+
+
+#include "../../FlashOS.h"
+#include "stm32l4xx_hal.h"
+#include "STM32L4HostHAL.h"
+#include "STM32L4Bench.h"
+#include "STM32L4Scatter.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined HOST_OSPI
+#include "STM32L4OSPI.h"
+#define HOST_DEVICE             NOR_MX25LM51245G
+#elif defined HOST_QSPI
+#include "STM32L4QSPI.h"
+#define HOST_DEVICE             NOR_N25Q128A
+#else
+#error "HOST_OSPI or HOST_QSPI"
+#endif
+
+#define TEST_BASE               HOST_FLASH_BASE
+#define TEST_SECTOR             0x10000U
+#define TEST_PAGE               0x1000U
+#define TEST_CLOCK              8000000U
+#define TEST_BENCH_SIZE         0x40000U
+
+/* Entry points of the loader outside FlashOS.h */
+extern int ProgramScatter (unsigned long cnt, unsigned long sz, unsigned char *buf);
+extern int Benchmark      (unsigned long adr, unsigned long sz, unsigned long clk);
+
+static uint32_t TestFailed;
+static uint8_t  TestData[4 * TEST_PAGE];
+static uint8_t  TestScatter[0x400];
+
+/* Private functions ---------------------------------------------------------*/
+
+#define CHECK(cond)       Test_Check((cond) != 0, #cond, __LINE__)
+
+static void Test_Check (int Pass, const char *Cond, int Line) {
+  if (!Pass) {
+    printf("  FAILED line %d: %s\n", Line, Cond);
+    TestFailed++;
+  }
+}
+
+static void Test_Start (const char *Name, const NOR_TimingTypeDef *Timing) {
+  printf("%s: %s\n", HOST_DEVICE.Name, Name);
+  Host_Init(&HOST_DEVICE, Timing);
+  Host_Watch();
+}
+
+/* No misuse of the HAL, no command the memory rejects */
+static void Test_End (void) {
+  CHECK(Host.Errors == 0U);
+  CHECK(Host.Model.Stats.Errors == 0U);
+  CHECK(Host.Model.Stats.Corrupted == 0U);
+}
+
+static void Test_Fill (uint8_t *Data, uint32_t Size, uint32_t Seed) {
+  uint32_t i;
+
+  for (i = 0U; i < Size; i++) {
+    Seed = (Seed * 1103515245U) + 12345U;
+    Data[i] = (uint8_t)(Seed >> 16);
+  }
+}
+
+static int Test_Blank (uint32_t Offset, uint32_t Size) {
+  uint32_t i;
+
+  for (i = 0U; i < Size; i++) {
+    if (Host.Model.Array[Offset + i] != 0xFFU) {
+      return (0);
+    }
+  }
+  return (1);
+}
+
+/* Tests -----------------------------------------------------------------------*/
+
+/* A download: erase, program, verify, one session each */
+static void Test_Download (void) {
+  uint32_t page;
+
+  Test_Start("download", NULL);
+  memset(Host.Model.Array, 0x00, 2 * TEST_SECTOR);
+  Test_Fill(TestData, sizeof(TestData), 1U);
+
+  CHECK(Init(TEST_BASE, TEST_CLOCK, 1) == 0);
+  CHECK(EraseSector(TEST_BASE) == 0);
+  CHECK(UnInit(1) == 0);
+  CHECK(Test_Blank(0U, TEST_SECTOR));
+  CHECK(Host.Model.Array[TEST_SECTOR] == 0x00U);
+
+  CHECK(Init(TEST_BASE, TEST_CLOCK, 2) == 0);
+  for (page = 0U; page < 4U; page++) {
+    CHECK(ProgramPage(TEST_BASE + (page * TEST_PAGE), TEST_PAGE, TestData + (page * TEST_PAGE)) == 0);
+  }
+  CHECK(UnInit(2) == 0);
+  CHECK(memcmp(Host.Model.Array, TestData, sizeof(TestData)) == 0);
+
+  CHECK(Init(TEST_BASE, TEST_CLOCK, 3) == 0);
+  CHECK(Verify(TEST_BASE, sizeof(TestData), TestData) == (TEST_BASE + sizeof(TestData)));
+  TestData[100] ^= 1U;
+  CHECK(Verify(TEST_BASE, sizeof(TestData), TestData) == (TEST_BASE + 100U));
+  CHECK(BlankCheck(TEST_BASE + sizeof(TestData), TEST_PAGE, 0xFF) == 0);
+  CHECK(BlankCheck(TEST_BASE, TEST_PAGE, 0xFF) != 0);
+  CHECK(UnInit(3) == 0);
+  CHECK(Host.MappedPages != 0U);
+
+  printf("  %u commands, %u polls, %.3f ms\n",
+         Host.Model.Stats.Commands, Host.Model.Stats.Polls, (double)Host.Now / 1e6);
+  Test_End();
+}
+
+/* The erase ends before the page programs, nothing is suspended */
+static void Test_Serial (void) {
+  uint32_t page;
+
+  Test_Start("erase then program in one session", NULL);
+  memset(Host.Model.Array, 0x00, 2 * TEST_SECTOR);
+  Test_Fill(TestData, sizeof(TestData), 2U);
+
+  CHECK(Init(TEST_BASE, TEST_CLOCK, 2) == 0);
+  CHECK(EraseSector(TEST_BASE) == 0);
+  CHECK(EraseSector(TEST_BASE + TEST_SECTOR) == 0);
+  for (page = 0U; page < 4U; page++) {
+    CHECK(ProgramPage(TEST_BASE + (page * TEST_PAGE), TEST_PAGE, TestData + (page * TEST_PAGE)) == 0);
+  }
+  CHECK(UnInit(2) == 0);
+
+  CHECK(memcmp(Host.Model.Array, TestData, sizeof(TestData)) == 0);
+  CHECK(Test_Blank(sizeof(TestData), (2 * TEST_SECTOR) - sizeof(TestData)));
+  CHECK(Host.Model.Stats.Suspends == 0U);
+  printf("  %.3f ms\n", (double)Host.Now / 1e6);
+  Test_End();
+}
+
+/* Erase suspend and resume of the BSP, the suspend waits for the suspend
+   latency and gives up past its timeout */
+static void Test_Suspend (void) {
+  NOR_TimingTypeDef timing = HOST_DEVICE.Timing;
+  uint32_t          run;
+
+  for (run = 0U; run < 2U; run++) {
+    if (run == 0U) {
+      Test_Start("erase suspend and resume", NULL);
+    } else {
+      timing.SuspendLatency = 5000U;
+      Test_Start("erase suspend latency of 5 ms, over the timeout", &timing);
+    }
+
+    /* Init leaves the interface memory-mapped */
+    CHECK(Init(TEST_BASE, TEST_CLOCK, 1) == 0);
+#if defined HOST_OSPI
+    CHECK(BSP_OSPI_NOR_DisableMemoryMappedMode() == OSPI_NOR_OK);
+    CHECK(BSP_OSPI_NOR_Erase_Block_Start(0U) == OSPI_NOR_OK);
+    CHECK(BSP_OSPI_NOR_SuspendErase() == ((run == 0U) ? OSPI_NOR_OK : OSPI_NOR_ERROR));
+    CHECK(BSP_OSPI_NOR_WaitForReady(MX25LM51245G_BLOCK_ERASE_MAX_TIME) == OSPI_NOR_OK);
+    CHECK(BSP_OSPI_NOR_GetStatus() == OSPI_NOR_SUSPENDED);
+    CHECK(BSP_OSPI_NOR_ResumeErase() == OSPI_NOR_OK);
+    CHECK(BSP_OSPI_NOR_WaitForReady(MX25LM51245G_BLOCK_ERASE_MAX_TIME) == OSPI_NOR_OK);
+#else
+    CHECK(BSP_QSPI_Init() == QSPI_OK);
+    CHECK(BSP_QSPI_Erase_Sector(0U) == QSPI_OK);
+    CHECK(BSP_QSPI_SuspendErase() == ((run == 0U) ? QSPI_OK : QSPI_ERROR));
+    CHECK(BSP_QSPI_WaitForReady(N25Q128A_SECTOR_ERASE_MAX_TIME) == QSPI_OK);
+    CHECK(BSP_QSPI_GetStatus() == QSPI_SUSPENDED);
+    CHECK(BSP_QSPI_ResumeErase() == QSPI_OK);
+    CHECK(BSP_QSPI_WaitForReady(N25Q128A_SECTOR_ERASE_MAX_TIME) == QSPI_OK);
+#endif
+    CHECK(UnInit(1) == 0);
+
+    CHECK(Test_Blank(0U, TEST_SECTOR));
+    CHECK(Host.Model.Stats.Suspends == 1U);
+    CHECK(Host.Model.Stats.Resumes == 1U);
+    Test_End();
+  }
+}
+
+/* The waits follow the timings of the model, TIM6 measures them whatever
+   the APB1 divider */
+static void Test_Timing (void) {
+  NOR_TimingTypeDef timing = HOST_DEVICE.Timing;
+  uint64_t          start;
+  uint64_t          time;
+  uint32_t          wait;
+  uint32_t          run;
+
+  timing.BlockErase *= 4U;
+  for (run = 0U; run < 2U; run++) {
+    if (run == 0U) {
+      Test_Start("block erase of 4 times the default time", &timing);
+    } else {
+      Test_Start("block erase of 4 times the default time, APB1 divided by 4", &timing);
+      Host.Apb1Divider = RCC_HCLK_DIV4;
+    }
+
+    CHECK(Init(TEST_BASE, TEST_CLOCK, 1) == 0);
+    start = Host.Now;
+    CHECK(EraseSector(TEST_BASE) == 0);
+#if defined HOST_OSPI
+    wait = BSP_OSPI_NOR_GetWaitTime();
+#else
+    wait = BSP_QSPI_GetWaitTime();
+#endif
+    CHECK(UnInit(1) == 0);
+    time = (Host.Now - start) / NOR_US;
+    CHECK(time >= timing.BlockErase);
+    CHECK(time < (timing.BlockErase + (timing.BlockErase / 10U)));
+    CHECK(wait <= time);
+    CHECK(wait >= timing.BlockErase);
+    printf("  %llu us for %u us, %u us measured\n", (unsigned long long)time, timing.BlockErase, wait);
+    Test_End();
+  }
+}
+
+/* Regions of a scatter list programmed in one call */
+static void Test_Scatter (void) {
+  Scatter_DescTypeDef *desc = (Scatter_DescTypeDef *)TestScatter;
+  uint32_t             offset = 3U * sizeof(Scatter_DescTypeDef);
+
+  Test_Start("scatter list", NULL);
+  Test_Fill(TestScatter, sizeof(TestScatter), 3U);
+  desc[0].Address = TEST_BASE + 0x0010U; desc[0].Length = 0x100U; desc[0].Offset = offset;
+  desc[1].Address = TEST_BASE + 0x0F80U; desc[1].Length = 0x104U; desc[1].Offset = offset + 0x100U;
+  desc[2].Address = TEST_BASE + 0x8000U; desc[2].Length = 0x020U; desc[2].Offset = offset + 0x204U;
+
+  CHECK(Init(TEST_BASE, TEST_CLOCK, 2) == 0);
+  CHECK(EraseSector(TEST_BASE) == 0);
+  CHECK(ProgramScatter(3U, offset + 0x224U, TestScatter) == 0);
+  CHECK(UnInit(2) == 0);
+
+  CHECK(memcmp(Host.Model.Array + 0x0010U, TestScatter + offset, 0x100U) == 0);
+  CHECK(memcmp(Host.Model.Array + 0x0F80U, TestScatter + offset + 0x100U, 0x104U) == 0);
+  CHECK(memcmp(Host.Model.Array + 0x8000U, TestScatter + offset + 0x204U, 0x020U) == 0);
+  CHECK(Test_Blank(0U, 0x10U));
+  CHECK(Test_Blank(0x0110U, 0x0F80U - 0x0110U));
+
+  /* Region out of the buffer */
+  desc[2].Length = 0x100U;
+  CHECK(Init(TEST_BASE, TEST_CLOCK, 2) == 0);
+  CHECK(ProgramScatter(3U, offset + 0x224U, TestScatter) != 0);
+  CHECK(UnInit(2) == 0);
+  Test_End();
+}
+
+/* Chip erase, the longest wait of the loader */
+static void Test_EraseChip (void) {
+  Test_Start("chip erase", NULL);
+  memset(Host.Model.Array, 0x00, HOST_DEVICE.Size);
+
+  CHECK(Init(TEST_BASE, TEST_CLOCK, 1) == 0);
+  CHECK(EraseChip() == 0);
+  CHECK(UnInit(1) == 0);
+  CHECK(Test_Blank(0U, HOST_DEVICE.Size));
+  CHECK(Host.Model.Stats.ChipErases == 1U);
+  printf("  %.3f s\n", (double)Host.Now / 1e9);
+  Test_End();
+}
+
+#if defined HOST_OSPI
+/* Octal DTR rejected by the calibration on a board sampling it up to 50 MHz
+   only: octal STR, with the same content */
+static void Test_Calibration (void) {
+  NOR_TimingTypeDef timing = HOST_DEVICE.Timing;
+
+  Test_Start("octal DTR by default", NULL);
+  CHECK(Init(TEST_BASE, TEST_CLOCK, 3) == 0);
+  CHECK(Host.Model.Reg[0] == 2U);
+  CHECK(UnInit(3) == 0);
+  Test_End();
+
+  timing.MaxClockDtr = 50000000U;
+  Test_Start("octal STR, DTR sampled up to 50 MHz", &timing);
+  Test_Fill(TestData, TEST_PAGE, 4U);
+  memcpy(Host.Model.Array, TestData, TEST_PAGE);
+  CHECK(Init(TEST_BASE, TEST_CLOCK, 3) == 0);
+  CHECK(Host.Model.Reg[0] == 1U);
+  CHECK(Verify(TEST_BASE, TEST_PAGE, TestData) == (TEST_BASE + TEST_PAGE));
+  CHECK(UnInit(3) == 0);
+
+  /* The calibration reads corrupted patterns on purpose */
+  Host.Model.Stats.Corrupted = 0U;
+  Test_End();
+}
+#endif
+
+#if defined HOST_QSPI
+/* Dummy cycles of the quad reads set in the volatile configuration */
+static void Test_DummyCycles (void) {
+  Test_Start("dummy cycles of the quad read", NULL);
+  CHECK(Init(TEST_BASE, TEST_CLOCK, 3) == 0);
+  CHECK(((Host.Model.Reg[0] >> 4) & 0xFU) == N25Q128A_DUMMY_CYCLES_READ_QUAD);
+  CHECK(BlankCheck(TEST_BASE, TEST_PAGE, 0xFF) == 0);
+  CHECK(UnInit(3) == 0);
+  Test_End();
+}
+
+/* Subsector erase of the BSP, 4 kB */
+static void Test_Subsector (void) {
+  Test_Start("subsector erase", NULL);
+  memset(Host.Model.Array, 0x00, TEST_SECTOR);
+
+  /* Init leaves the interface memory-mapped */
+  CHECK(Init(TEST_BASE, TEST_CLOCK, 1) == 0);
+  CHECK(BSP_QSPI_Init() == QSPI_OK);
+  CHECK(BSP_QSPI_Erase_Block(TEST_PAGE) == QSPI_OK);
+  CHECK(BSP_QSPI_WaitForReady(N25Q128A_SUBSECTOR_ERASE_MAX_TIME) == QSPI_OK);
+  CHECK(UnInit(1) == 0);
+  CHECK(Host.Model.Stats.SectorErases == 1U);
+  CHECK(Host.Model.Array[TEST_PAGE - 1U] == 0x00U);
+  CHECK(Test_Blank(TEST_PAGE, TEST_PAGE));
+  CHECK(Host.Model.Array[2U * TEST_PAGE] == 0x00U);
+  Test_End();
+}
+#endif
+
+/* Benchmark of the loader over the corpus, in virtual time */
+static void Test_Benchmark (void) {
+  static const char *const name[BENCH_IMAGES] = { "dense", "firmware", "sparse", "delta", "full" };
+  const Bench_ResultTypeDef *result;
+  uint32_t                   image;
+
+  Test_Start("benchmark", NULL);
+  CHECK(Benchmark(TEST_BASE, TEST_BENCH_SIZE, TEST_CLOCK) == 0);
+  CHECK(Bench_Report.Status == BENCH_OK);
+
+  printf("  %-9s %8s %10s %10s %10s %8s %12s %12s\n", "image", "bytes", "erase us", "program us",
+         "verify us", "commands", "program B/s", "total B/s");
+  for (image = 0U; image < BENCH_IMAGES; image++) {
+    result = &Bench_Report.Result[image];
+    if (result->Address == 0U) {
+      continue;
+    }
+    printf("  %-9s %8u %10u %10u %10u %8u %12u %12u\n", name[image], result->Size,
+           result->EraseTime, result->ProgramTime, result->VerifyTime, result->Commands,
+           result->ProgramRate, result->TotalRate);
+  }
+  printf("  model: %u commands, %u polls, %u programs, %u sector erases, %u block erases, %u suspends\n",
+         Host.Model.Stats.Commands, Host.Model.Stats.Polls, Host.Model.Stats.Programs,
+         Host.Model.Stats.SectorErases, Host.Model.Stats.BlockErases, Host.Model.Stats.Suspends);
+  Test_End();
+}
+
+int main (void) {
+  Test_Download();
+  Test_Serial();
+  Test_Suspend();
+  Test_Timing();
+  Test_Scatter();
+  Test_EraseChip();
+#if defined HOST_OSPI
+  Test_Calibration();
+#endif
+#if defined HOST_QSPI
+  Test_DummyCycles();
+  Test_Subsector();
+#endif
+  Test_Benchmark();
+
+  printf("%s: %s\n", HOST_DEVICE.Name, (TestFailed == 0U) ? "PASSED" : "FAILED");
+  return ((TestFailed == 0U) ? 0 : 1);
+}
@@ -0,0 +1,378 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Host tests of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4MX25Model.c
+  * @brief   Personality of the MX25LM51245G: the SPI, STR octal (SOPI) and
+  *          DTR octal (DOPI) protocols, the configuration register 2, the
+  *          security register, the SFDP and the dummy cycles of the reads.
+  ******************************************************************************
+  */
+
+
+#include "STM32L4NorModel.h"
+#include <string.h>
+
+/* Registers of the personality (NOR_ModelTypeDef.Reg) */
+#define MX25_PROTOCOL           0U      /* CR2 at 0x000: 0 SPI, 1 SOPI, 2 DOPI */
+#define MX25_DC                 1U      /* CR2 at 0x300: dummy cycles          */
+#define MX25_POWER_DOWN         2U
+
+#define MX25_SPI                0U
+#define MX25_SOPI               1U
+#define MX25_DOPI               2U
+
+#define MX25_SFDP_SIZE          0x100U
+#define MX25_SFDP_DUMMY         20U     /* octal SFDP read */
+
+/* Maximum clock (MHz) of the reads, by the CR2 dummy cycles setting */
+static const uint16_t MX25_DcClock[8] = { 200U, 173U, 155U, 133U, 133U, 104U, 84U, 66U };
+
+/* SFDP: JESD216 header, one parameter header, basic table of 20 DWORDs */
+static const uint32_t MX25_SfdpTable[20] = {
+  0xFF022005U,    /*  1: 4 kB erase 0x20, 3 or 4 address bytes   */
+  0x1FFFFFFFU,    /*  2: 512 Mbits                                */
+  0x00000000U,    /*  3: no quad reads                            */
+  0x00000000U,    /*  4: no dual reads                            */
+  0xFFFFFFEEU,    /*  5: no 2-2-2, 4-4-4                          */
+  0xFFFF0000U,    /*  6                                           */
+  0xFFFF0000U,    /*  7                                           */
+  0xD810200CU,    /*  8: erase types 4 kB 0x20, 64 kB 0xD8        */
+  0x00000000U,    /*  9                                           */
+  0x00000000U,    /* 10                                           */
+  0x00000080U,    /* 11: page of 256 bytes                        */
+  0x00000000U,    /* 12: suspend and resume supported             */
+  0xB0300000U,    /* 13: suspend 0xB0, resume 0x30                */
+  0x00000000U,    /* 14                                           */
+  0x00000000U,    /* 15: no quad enable                           */
+  0x01000000U,    /* 16: 4 byte address instruction 0xB7          */
+  0x00000000U,    /* 17                                           */
+  0x00000000U,    /* 18                                           */
+  0x00000000U,    /* 19                                           */
+  0x40000000U     /* 20: 8D-8D-8D with DQS                        */
+};
+
+static uint8_t MX25_Sfdp[MX25_SFDP_SIZE];
+
+/* Private functions ---------------------------------------------------------*/
+
+static void MX25_Reset (NOR_ModelTypeDef *Model) {
+  uint32_t i;
+
+  Model->Reg[MX25_PROTOCOL]   = MX25_SPI;
+  Model->Reg[MX25_DC]         = 0U;
+  Model->Reg[MX25_POWER_DOWN] = 0U;
+
+  memset(MX25_Sfdp, 0xFF, sizeof(MX25_Sfdp));
+  memcpy(&MX25_Sfdp[0], "SFDP", 4U);
+  MX25_Sfdp[4]  = 0x08U;                /* JESD216 revision 1.8 */
+  MX25_Sfdp[5]  = 0x01U;
+  MX25_Sfdp[6]  = 0x00U;                /* one parameter header */
+  MX25_Sfdp[8]  = 0x00U;                /* basic table 0xFF00   */
+  MX25_Sfdp[9]  = 0x08U;
+  MX25_Sfdp[10] = 0x01U;
+  MX25_Sfdp[11] = 20U;
+  MX25_Sfdp[12] = 0x30U;
+  MX25_Sfdp[13] = 0x00U;
+  MX25_Sfdp[14] = 0x00U;
+  MX25_Sfdp[15] = 0xFFU;
+  for (i = 0U; i < 20U; i++) {
+    MX25_Sfdp[0x30U + (i * 4U) + 0U] = (uint8_t)(MX25_SfdpTable[i]);
+    MX25_Sfdp[0x30U + (i * 4U) + 1U] = (uint8_t)(MX25_SfdpTable[i] >> 8);
+    MX25_Sfdp[0x30U + (i * 4U) + 2U] = (uint8_t)(MX25_SfdpTable[i] >> 16);
+    MX25_Sfdp[0x30U + (i * 4U) + 3U] = (uint8_t)(MX25_SfdpTable[i] >> 24);
+  }
+}
+
+/* Instruction of the command in the active protocol, or -1 */
+static int32_t MX25_Decode (NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd) {
+  uint32_t protocol = Model->Reg[MX25_PROTOCOL];
+  uint8_t  dtr      = (protocol == MX25_DOPI) ? 1U : 0U;
+  uint32_t op;
+
+  if (protocol == MX25_SPI) {
+    if ((Cmd->InstructionLines != 1U) || (Cmd->InstructionBytes != 1U) || (Cmd->InstructionDtr != 0U)) {
+      return (-1);
+    }
+    return ((int32_t)(Cmd->Instruction & 0xFFU));
+  }
+
+  if ((Cmd->InstructionLines != 8U) || (Cmd->InstructionBytes != 2U) || (Cmd->InstructionDtr != dtr)) {
+    return (-1);
+  }
+  op = (Cmd->Instruction >> 8) & 0xFFU;
+  if ((Cmd->Instruction & 0xFFU) != (~op & 0xFFU)) {
+    NOR_Error(Model, "instruction 0x%04X without its complement", Cmd->Instruction);
+    return (-2);
+  }
+  if (((Cmd->AddressLines != 0U) &&
+       ((Cmd->AddressLines != 8U) || (Cmd->AddressBytes != 4U) || (Cmd->AddressDtr != dtr))) ||
+      ((Cmd->DataLines != 0U) && ((Cmd->DataLines != 8U) || (Cmd->DataDtr != dtr)))) {
+    NOR_Error(Model, "phases of 0x%04X not in the %s protocol", Cmd->Instruction,
+              (dtr != 0U) ? "DOPI" : "SOPI");
+    return (-2);
+  }
+  return ((int32_t)op);
+}
+
+/* Sampling of the data by the board and the OCTOSPI */
+static const char *MX25_CheckClock (NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd) {
+  if (Cmd->DataDtr != 0U) {
+    if (Cmd->Dqs == 0U) {
+      return ("DTR read without DQS");
+    }
+    if (Cmd->Clock > Model->Timing.MaxClockDtr) {
+      return ("clock above the DTR limit of the board");
+    }
+  } else if (Cmd->Clock > Model->Timing.MaxClockStr) {
+    return ("clock above the STR limit of the board");
+  }
+  return (NULL);
+}
+
+static const char *MX25_CheckRead (NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd) {
+  int32_t  op = MX25_Decode(Model, Cmd);
+  uint32_t dc = Model->Reg[MX25_DC] & 7U;
+
+  switch (op) {
+    case 0x03:
+    case 0x13:
+      if (Cmd->DummyCycles != 0U) {
+        return ("dummy cycles of the read");
+      }
+      if (Cmd->Clock > 66000000U) {
+        return ("clock above 66 MHz for the read");
+      }
+      break;
+
+    case 0x0B:
+    case 0x0C:
+      if (Cmd->DummyCycles != 8U) {
+        return ("dummy cycles of the fast read");
+      }
+      break;
+
+    case 0xEC:
+    case 0xEE:
+      if (Cmd->DummyCycles != (20U - (2U * dc))) {
+        return ("dummy cycles not those of the configuration register 2");
+      }
+      if (Cmd->Clock > (MX25_DcClock[dc] * 1000000U)) {
+        return ("clock above the frequency of the dummy cycles");
+      }
+      break;
+
+    default:
+      return ("not a read of the active protocol");
+  }
+  if (((op == 0x03) || (op == 0x0B)) ? (Cmd->AddressBytes != 3U) : (Cmd->AddressBytes != 4U)) {
+    return ("address bytes of the read");
+  }
+  return (MX25_CheckClock(Model, Cmd));
+}
+
+static void MX25_Command (NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd,
+                          uint8_t *Data, uint32_t Size, uint8_t Write) {
+  uint8_t  value[1];
+  uint32_t sfdp_dummy;
+  uint32_t i;
+  int32_t  op;
+
+  if (Write == 0U) {
+    memset(Data, 0xFF, Size);
+  }
+
+  if (Model->Reg[MX25_POWER_DOWN] != 0U) {
+    Model->Reg[MX25_POWER_DOWN] = 0U;  /* CS# toggle releases it */
+    NOR_Ignore(Model, Cmd, "deep power down");
+    return;
+  }
+
+  op = MX25_Decode(Model, Cmd);
+  if (op == -1) {
+    NOR_Ignore(Model, Cmd, "other protocol");
+    return;
+  }
+  if (op < 0) {
+    return;
+  }
+
+  if (NOR_Busy(Model) &&
+      (op != 0x05) && (op != 0x2B) && (op != 0x06) && (op != 0x66) && (op != 0x99) &&
+      (op != 0xB0) && (op != 0x00)) {
+    NOR_Error(Model, "command 0x%02X while busy", op);
+    return;
+  }
+
+  switch (op) {
+    case 0x06:                                  /* WREN */
+      Model->Wel = 1U;
+      break;
+
+    case 0x04:                                  /* WRDI */
+      Model->Wel = 0U;
+      break;
+
+    case 0x05:                                  /* RDSR */
+      value[0] = (uint8_t)((NOR_Busy(Model) ? 0x01U : 0U) | ((Model->Wel != 0U) ? 0x02U : 0U));
+      NOR_Fill(Data, Size, value, 1U);
+      break;
+
+    case 0x2B:                                  /* RDSCUR */
+      value[0] = (uint8_t)(((Model->EraseSuspended != 0U) ? 0x08U : 0U) |
+                           ((Model->ProgramFail    != 0U) ? 0x20U : 0U) |
+                           ((Model->EraseFail      != 0U) ? 0x40U : 0U));
+      NOR_Fill(Data, Size, value, 1U);
+      break;
+
+    case 0x71:                                  /* RDCR2 */
+      value[0] = (Cmd->Address == 0x000U) ? (uint8_t)Model->Reg[MX25_PROTOCOL] :
+                 (Cmd->Address == 0x300U) ? (uint8_t)Model->Reg[MX25_DC] : 0U;
+      NOR_Fill(Data, Size, value, 1U);
+      break;
+
+    case 0x72:                                  /* WRCR2 */
+      if ((Model->Wel == 0U) || (Size == 0U)) {
+        NOR_Error(Model, "WRCR2 at 0x%03X %s", Cmd->Address, (Size == 0U) ? "without data" : "without write enable");
+        break;
+      }
+      if (Cmd->Address == 0x000U) {
+        Model->Reg[MX25_PROTOCOL] = Data[0] & 0x03U;
+      } else if (Cmd->Address == 0x300U) {
+        Model->Reg[MX25_DC] = Data[0] & 0x07U;
+      }
+      Model->Wel = 0U;
+      break;
+
+    case 0x66:                                  /* RSTEN */
+      Model->ResetEnable = 2U;
+      break;
+
+    case 0x99:                                  /* RST */
+      if (Model->ResetEnable == 1U) {
+        NOR_Reset(Model);
+      } else {
+        NOR_Ignore(Model, Cmd, "reset without reset enable");
+      }
+      break;
+
+    case 0x5A:                                  /* RDSFDP */
+      sfdp_dummy = (Model->Reg[MX25_PROTOCOL] == MX25_SPI) ? 8U : MX25_SFDP_DUMMY;
+      for (i = 0U; i < Size; i++) {
+        Data[i] = ((Cmd->Address + i) < MX25_SFDP_SIZE) ? MX25_Sfdp[Cmd->Address + i] : 0xFFU;
+      }
+      if ((Cmd->DummyCycles != sfdp_dummy) || (MX25_CheckClock(Model, Cmd) != NULL)) {
+        for (i = 0U; i < Size; i++) {
+          Data[i] ^= 0xA5U;
+        }
+        Model->Stats.Corrupted++;
+      }
+      break;
+
+    case 0x03:                                  /* READ, FAST_READ, 8READ, 8DTRD */
+    case 0x13:
+    case 0x0B:
+    case 0x0C:
+    case 0xEC:
+    case 0xEE:
+      NOR_Read(Model, Cmd->Address, Data, Size, (MX25_CheckRead(Model, Cmd) != NULL) ? 1U : 0U);
+      break;
+
+    case 0x02:                                  /* PP, PP4B */
+    case 0x12:
+      if ((Write == 0U) || (Size == 0U)) {
+        NOR_Error(Model, "program without data");
+        break;
+      }
+      NOR_Program(Model, Cmd->Address, Data, Size);
+      break;
+
+    case 0x20:                                  /* SE, SE4B */
+    case 0x21:
+      NOR_Erase(Model, Cmd->Address, 0x1000U);
+      break;
+
+    case 0xD8:                                  /* BE, BE4B */
+    case 0xDC:
+      NOR_Erase(Model, Cmd->Address, 0x10000U);
+      break;
+
+    case 0x60:                                  /* CE */
+    case 0xC7:
+      NOR_Erase(Model, 0U, Model->Device->Size);
+      break;
+
+    case 0xB0:                                  /* PGM/ERS suspend */
+      NOR_Suspend(Model);
+      break;
+
+    case 0x30:                                  /* PGM/ERS resume */
+      NOR_Resume(Model);
+      break;
+
+    case 0xB9:                                  /* DP */
+      Model->Reg[MX25_POWER_DOWN] = 1U;
+      break;
+
+    case 0x00:                                  /* NOP */
+    case 0xAB:                                  /* RDP */
+      break;
+
+    default:
+      NOR_Error(Model, "unsupported command 0x%02X", op);
+      break;
+  }
+}
+
+/* Exported variables --------------------------------------------------------*/
+
+/* Timings of the datasheet (typical), the board of the STM32L4R9I-DK */
+const NOR_DeviceTypeDef NOR_MX25LM51245G = {
+  "MX25LM51245G",
+  0x4000000U,
+  0x100U,
+  {
+    150U,                       /* PageProgram                      */
+    25000U,                     /* SectorErase, 4 kB                */
+    220000U,                    /* BlockErase, 64 kB                */
+    150000000U,                 /* ChipErase                        */
+    40000U,                     /* RegisterWrite                    */
+    40U,                        /* ResetRecovery                    */
+    20U,                        /* SuspendLatency                   */
+    100U,                       /* ResumeOverhead                   */
+    133000000U,                 /* MaxClockStr                      */
+    66000000U                   /* MaxClockDtr                      */
+  },
+  MX25_Reset,
+  MX25_Command,
+  MX25_CheckRead
+};
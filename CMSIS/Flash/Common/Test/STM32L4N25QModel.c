@@ -0,0 +1,343 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Host tests of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4N25QModel.c
+  * @brief   Personality of the N25Q128A: the extended SPI protocol with its
+  *          dual and quad reads and programs, the flag status register, the
+  *          volatile configuration register (dummy cycles), the SFDP.
+  ******************************************************************************
+  */
+
+
+#include "STM32L4NorModel.h"
+#include <string.h>
+
+/* Registers of the personality (NOR_ModelTypeDef.Reg) */
+#define N25Q_VCR                0U      /* volatile configuration register */
+#define N25Q_SR                 1U      /* status register, write bits     */
+
+#define N25Q_SFDP_SIZE          0x100U
+
+/* Maximum clock (MHz) of the quad I/O read (0xEB), by its dummy cycles */
+static const uint8_t N25Q_QuadIoClock[16] = {
+  0U, 43U, 51U, 60U, 68U, 77U, 86U, 95U, 104U, 108U, 108U, 108U, 108U, 108U, 108U, 108U
+};
+
+/* SFDP: JESD216 header, one parameter header, basic table of 9 DWORDs */
+static const uint32_t N25Q_SfdpTable[9] = {
+  0xFF792005U,    /* 1: 4 kB erase 0x20, 3 address bytes, 1-1-2 1-2-2 1-4-4 1-1-4 */
+  0x07FFFFFFU,    /* 2: 128 Mbits                                      */
+  0x6B08EB48U,    /* 3: 1-4-4 0xEB 2 mode + 8 dummy, 1-1-4 0x6B 8 dummy */
+  0xBB843B08U,    /* 4: 1-1-2 0x3B 8 dummy, 1-2-2 0xBB 4 mode + 4 dummy */
+  0xFFFFFFEEU,    /* 5: no 2-2-2, 4-4-4                                */
+  0xFFFF0000U,    /* 6                                                 */
+  0xFFFF0000U,    /* 7                                                 */
+  0xD810200CU,    /* 8: erase types 4 kB 0x20, 64 kB 0xD8              */
+  0x00000000U     /* 9                                                 */
+};
+
+static uint8_t N25Q_Sfdp[N25Q_SFDP_SIZE];
+
+/* Private functions ---------------------------------------------------------*/
+
+static void N25Q_Reset (NOR_ModelTypeDef *Model) {
+  uint32_t i;
+
+  Model->Reg[N25Q_VCR] = 0xFBU;
+  Model->Reg[N25Q_SR]  = 0x00U;
+
+  memset(N25Q_Sfdp, 0xFF, sizeof(N25Q_Sfdp));
+  memcpy(&N25Q_Sfdp[0], "SFDP", 4U);
+  N25Q_Sfdp[4]  = 0x00U;                /* JESD216 revision 1.0 */
+  N25Q_Sfdp[5]  = 0x01U;
+  N25Q_Sfdp[6]  = 0x00U;
+  N25Q_Sfdp[8]  = 0x00U;
+  N25Q_Sfdp[9]  = 0x00U;
+  N25Q_Sfdp[10] = 0x01U;
+  N25Q_Sfdp[11] = 9U;
+  N25Q_Sfdp[12] = 0x30U;
+  N25Q_Sfdp[13] = 0x00U;
+  N25Q_Sfdp[14] = 0x00U;
+  N25Q_Sfdp[15] = 0xFFU;
+  for (i = 0U; i < 9U; i++) {
+    N25Q_Sfdp[0x30U + (i * 4U) + 0U] = (uint8_t)(N25Q_SfdpTable[i]);
+    N25Q_Sfdp[0x30U + (i * 4U) + 1U] = (uint8_t)(N25Q_SfdpTable[i] >> 8);
+    N25Q_Sfdp[0x30U + (i * 4U) + 2U] = (uint8_t)(N25Q_SfdpTable[i] >> 16);
+    N25Q_Sfdp[0x30U + (i * 4U) + 3U] = (uint8_t)(N25Q_SfdpTable[i] >> 24);
+  }
+}
+
+/* Lines of the address and of the data of the reads and programs */
+static uint8_t N25Q_Lines (uint32_t Op, uint8_t *Address, uint8_t *Data) {
+  switch (Op) {
+    case 0x03: case 0x0B: case 0x02: *Address = 1U; *Data = 1U; break;
+    case 0x3B:                       *Address = 1U; *Data = 2U; break;
+    case 0xBB:                       *Address = 2U; *Data = 2U; break;
+    case 0x6B: case 0x32:            *Address = 1U; *Data = 4U; break;
+    case 0xEB: case 0x12:            *Address = 4U; *Data = 4U; break;
+    default:
+      return (0U);
+  }
+  return (1U);
+}
+
+/* Dummy cycles of a fast read: the VCR setting, 0 or 15 the default */
+static uint32_t N25Q_Dummy (NOR_ModelTypeDef *Model, uint32_t Op) {
+  uint32_t dummy = (Model->Reg[N25Q_VCR] >> 4) & 0x0FU;
+
+  if ((dummy == 0U) || (dummy == 0x0FU)) {
+    dummy = ((Op == 0xEB) ? 10U : 8U);
+  }
+  return (dummy);
+}
+
+static const char *N25Q_CheckRead (NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd) {
+  uint32_t op = Cmd->Instruction & 0xFFU;
+  uint32_t wait;
+  uint8_t  address;
+  uint8_t  data;
+
+  if ((Cmd->InstructionLines != 1U) || (Cmd->InstructionDtr != 0U) ||
+      (N25Q_Lines(op, &address, &data) == 0U) ||
+      (op == 0x02) || (op == 0x32) || (op == 0x12)) {
+    return ("not a read of the extended SPI protocol");
+  }
+  if ((Cmd->AddressLines != address) || (Cmd->DataLines != data) ||
+      ((Cmd->AlternateBytes != 0U) && (Cmd->AlternateLines != address))) {
+    return ("lines of the read");
+  }
+  if (Cmd->AddressBytes != 3U) {
+    return ("address bytes of the read");
+  }
+  if (Cmd->DataDtr != 0U) {
+    return ("DTR read not modelled");
+  }
+
+  /* The mode bits are the first wait cycles */
+  wait = Cmd->DummyCycles + ((Cmd->AlternateBytes * 8U) / ((Cmd->AlternateLines != 0U) ? Cmd->AlternateLines : 1U));
+  if (op == 0x03) {
+    if (wait != 0U) {
+      return ("dummy cycles of the read");
+    }
+    if (Cmd->Clock > 54000000U) {
+      return ("clock above 54 MHz for the read");
+    }
+  } else {
+    if (wait != N25Q_Dummy(Model, op)) {
+      return ("dummy cycles not those of the volatile configuration register");
+    }
+    if ((op == 0xEB) && (Cmd->Clock > (N25Q_QuadIoClock[wait & 0x0FU] * 1000000U))) {
+      return ("clock above the frequency of the dummy cycles");
+    }
+  }
+  if (Cmd->Clock > Model->Timing.MaxClockStr) {
+    return ("clock above the limit of the board");
+  }
+  return (NULL);
+}
+
+static void N25Q_Command (NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd,
+                          uint8_t *Data, uint32_t Size, uint8_t Write) {
+  uint8_t  value[1];
+  uint8_t  address;
+  uint8_t  data;
+  uint32_t op;
+  uint32_t i;
+
+  if (Write == 0U) {
+    memset(Data, 0xFF, Size);
+  }
+
+  if ((Cmd->InstructionLines != 1U) || (Cmd->InstructionBytes != 1U) || (Cmd->InstructionDtr != 0U)) {
+    NOR_Ignore(Model, Cmd, "dual or quad protocol not modelled");
+    return;
+  }
+  op = Cmd->Instruction & 0xFFU;
+
+  if (NOR_Busy(Model) &&
+      (op != 0x05) && (op != 0x70) && (op != 0x06) && (op != 0x04) && (op != 0x75) &&
+      (op != 0x66) && (op != 0x99)) {
+    NOR_Error(Model, "command 0x%02X while busy", op);
+    return;
+  }
+
+  switch (op) {
+    case 0x06:                                  /* WRITE ENABLE */
+      Model->Wel = 1U;
+      break;
+
+    case 0x04:                                  /* WRITE DISABLE */
+      Model->Wel = 0U;
+      break;
+
+    case 0x05:                                  /* READ STATUS REGISTER */
+      value[0] = (uint8_t)(Model->Reg[N25Q_SR] | (NOR_Busy(Model) ? 0x01U : 0U) |
+                           ((Model->Wel != 0U) ? 0x02U : 0U));
+      NOR_Fill(Data, Size, value, 1U);
+      break;
+
+    case 0x01:                                  /* WRITE STATUS REGISTER */
+      if ((Model->Wel == 0U) || (Size == 0U)) {
+        NOR_Error(Model, "WRSR %s", (Size == 0U) ? "without data" : "without write enable");
+        break;
+      }
+      Model->Reg[N25Q_SR] = Data[0] & 0xFCU;
+      NOR_RegisterWrite(Model);
+      break;
+
+    case 0x70:                                  /* READ FLAG STATUS REGISTER */
+      value[0] = (uint8_t)((NOR_Busy(Model) ? 0U : 0x80U) |
+                           ((Model->EraseSuspended != 0U) ? 0x40U : 0U) |
+                           ((Model->EraseFail      != 0U) ? 0x20U : 0U) |
+                           ((Model->ProgramFail    != 0U) ? 0x10U : 0U));
+      NOR_Fill(Data, Size, value, 1U);
+      break;
+
+    case 0x50:                                  /* CLEAR FLAG STATUS REGISTER */
+      Model->ProgramFail = 0U;
+      Model->EraseFail   = 0U;
+      break;
+
+    case 0x85:                                  /* READ VOLATILE CONFIGURATION */
+      value[0] = (uint8_t)Model->Reg[N25Q_VCR];
+      NOR_Fill(Data, Size, value, 1U);
+      break;
+
+    case 0x81:                                  /* WRITE VOLATILE CONFIGURATION */
+      if ((Model->Wel == 0U) || (Size == 0U)) {
+        NOR_Error(Model, "WRVCR %s", (Size == 0U) ? "without data" : "without write enable");
+        break;
+      }
+      Model->Reg[N25Q_VCR] = Data[0];
+      Model->Wel = 0U;
+      break;
+
+    case 0x66:                                  /* RESET ENABLE */
+      Model->ResetEnable = 2U;
+      break;
+
+    case 0x99:                                  /* RESET MEMORY */
+      if (Model->ResetEnable == 1U) {
+        NOR_Reset(Model);
+      } else {
+        NOR_Ignore(Model, Cmd, "reset without reset enable");
+      }
+      break;
+
+    case 0x5A:                                  /* READ SFDP */
+      for (i = 0U; i < Size; i++) {
+        Data[i] = ((Cmd->Address + i) < N25Q_SFDP_SIZE) ? N25Q_Sfdp[Cmd->Address + i] : 0xFFU;
+      }
+      if ((Cmd->DummyCycles != 8U) || (Cmd->AddressLines != 1U) || (Cmd->DataLines != 1U) ||
+          (Cmd->Clock > Model->Timing.MaxClockStr)) {
+        for (i = 0U; i < Size; i++) {
+          Data[i] ^= 0xA5U;
+        }
+        Model->Stats.Corrupted++;
+      }
+      break;
+
+    case 0x03:                                  /* READ, FAST READ, DUAL, QUAD */
+    case 0x0B:
+    case 0x3B:
+    case 0xBB:
+    case 0x6B:
+    case 0xEB:
+      NOR_Read(Model, Cmd->Address, Data, Size, (N25Q_CheckRead(Model, Cmd) != NULL) ? 1U : 0U);
+      break;
+
+    case 0x02:                                  /* PAGE PROGRAM, QUAD INPUT */
+    case 0x32:
+    case 0x12:
+      (void)N25Q_Lines(op, &address, &data);
+      if ((Cmd->AddressLines != address) || (Cmd->DataLines != data) || (Cmd->DummyCycles != 0U)) {
+        NOR_Error(Model, "lines of the program 0x%02X", op);
+        break;
+      }
+      if ((Write == 0U) || (Size == 0U)) {
+        NOR_Error(Model, "program without data");
+        break;
+      }
+      NOR_Program(Model, Cmd->Address, Data, Size);
+      break;
+
+    case 0x20:                                  /* SUBSECTOR ERASE */
+      NOR_Erase(Model, Cmd->Address, 0x1000U);
+      break;
+
+    case 0xD8:                                  /* SECTOR ERASE */
+      NOR_Erase(Model, Cmd->Address, 0x10000U);
+      break;
+
+    case 0xC7:                                  /* BULK ERASE */
+    case 0x60:
+      NOR_Erase(Model, 0U, Model->Device->Size);
+      break;
+
+    case 0x75:                                  /* PROGRAM/ERASE SUSPEND */
+      NOR_Suspend(Model);
+      break;
+
+    case 0x7A:                                  /* PROGRAM/ERASE RESUME */
+      NOR_Resume(Model);
+      break;
+
+    default:
+      NOR_Error(Model, "unsupported command 0x%02X", op);
+      break;
+  }
+}
+
+/* Exported variables --------------------------------------------------------*/
+
+/* Timings of the datasheet (typical), the board of the STM32L476G-DISCO */
+const NOR_DeviceTypeDef NOR_N25Q128A = {
+  "N25Q128A",
+  0x1000000U,
+  0x100U,
+  {
+    500U,                       /* PageProgram                      */
+    250000U,                    /* SectorErase, 4 kB subsector      */
+    700000U,                    /* BlockErase, 64 kB sector         */
+    170000000U,                 /* ChipErase, bulk                  */
+    1300U,                      /* RegisterWrite                    */
+    40U,                        /* ResetRecovery                    */
+    30U,                        /* SuspendLatency                   */
+    100U,                       /* ResumeOverhead                   */
+    108000000U,                 /* MaxClockStr                      */
+    0U                          /* MaxClockDtr                      */
+  },
+  N25Q_Reset,
+  N25Q_Command,
+  N25Q_CheckRead
+};
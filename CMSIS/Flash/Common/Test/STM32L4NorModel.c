@@ -0,0 +1,352 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Host tests of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4NorModel.c
+  * @brief   Behavioral model of a serial NOR Flash, at the level of its
+  *          commands (see STM32L4NorModel.h).
+  ******************************************************************************
+  */
+
+
+#include "STM32L4NorModel.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private functions ---------------------------------------------------------*/
+
+static uint64_t NOR_Time (uint32_t Us) {
+  return ((uint64_t)Us * NOR_US);
+}
+
+/* Completes the operation at its end time */
+static void NOR_Complete (NOR_ModelTypeDef *Model) {
+  Model->Now = Model->OpEnd;
+
+  switch (Model->Op) {
+    case NOR_OP_ERASE:
+      memset(&Model->Array[Model->EraseAddress], 0xFF, Model->EraseSize);
+      Model->Erasing = 0U;
+      Model->Wel     = 0U;
+      Model->Op      = NOR_OP_IDLE;
+      break;
+
+    case NOR_OP_SUSPENDING:
+      Model->EraseSuspended = 1U;
+      Model->Wel            = 0U;
+      Model->Op             = NOR_OP_IDLE;
+      break;
+
+    default:
+      Model->Wel = 0U;
+      Model->Op  = NOR_OP_IDLE;
+      break;
+  }
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Initializes the model, the array erased.
+  * @param  Model: model
+  * @param  Device: personality of the device
+  * @param  Timing: timings, NULL for the defaults of the device
+  * @param  Array: array of Device->Size bytes
+  */
+void NOR_Init (NOR_ModelTypeDef *Model, const NOR_DeviceTypeDef *Device,
+               const NOR_TimingTypeDef *Timing, uint8_t *Array) {
+  memset(Model, 0, sizeof(NOR_ModelTypeDef));
+  Model->Device = Device;
+  Model->Array  = Array;
+  Model->Timing = (Timing != NULL) ? *Timing : Device->Timing;
+  Model->Random = 0x2545F491U;
+  memset(Array, 0xFF, Device->Size);
+  Device->Reset(Model);
+}
+
+/**
+  * @brief  Advances the model to the time Now, the operations ending before
+  *         complete.
+  */
+void NOR_Sync (NOR_ModelTypeDef *Model, uint64_t Now) {
+  while ((Model->Op != NOR_OP_IDLE) && (Model->OpEnd <= Now)) {
+    NOR_Complete(Model);
+  }
+  if (Now > Model->Now) {
+    Model->Now = Now;
+  }
+}
+
+/**
+  * @brief  Time of the next change of the state, NOR_NEVER when idle: the
+  *         status of the device does not change before.
+  */
+uint64_t NOR_NextEvent (NOR_ModelTypeDef *Model) {
+  return ((Model->Op != NOR_OP_IDLE) ? Model->OpEnd : NOR_NEVER);
+}
+
+/**
+  * @brief  Executes a command of the bus at the time of the model.
+  * @param  Data: Size bytes written to the device, or read from it
+  * @param  Write: 1 when the data phase writes to the device
+  * @param  Poll: 1 for the status reads of the automatic polling
+  */
+void NOR_Transfer (NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd,
+                   uint8_t *Data, uint32_t Size, uint8_t Write, uint8_t Poll) {
+  if (Poll != 0U) {
+    Model->Stats.Polls++;
+  } else {
+    Model->Stats.Commands++;
+  }
+
+  Model->Device->Command(Model, Cmd, Data, Size, Write);
+
+  Model->ResetEnable = (Model->ResetEnable == 2U) ? 1U : 0U;
+}
+
+/**
+  * @brief  1 while an operation is in progress (the WIP bit).
+  */
+uint8_t NOR_Busy (NOR_ModelTypeDef *Model) {
+  return ((Model->Op != NOR_OP_IDLE) ? 1U : 0U);
+}
+
+/**
+  * @brief  Software reset: the operation in progress stops, an erase leaves
+  *         its range partially erased.
+  */
+void NOR_Reset (NOR_ModelTypeDef *Model) {
+  uint32_t i;
+
+  if ((Model->Op != NOR_OP_IDLE) || (Model->Erasing != 0U)) {
+    Model->Stats.Aborted++;
+  }
+  if (Model->Erasing != 0U) {
+    for (i = 0U; i < Model->EraseSize; i++) {
+      Model->Random = (Model->Random * 1103515245U) + 12345U;
+      Model->Array[Model->EraseAddress + i] |= (uint8_t)(Model->Random >> 16);
+    }
+  }
+
+  Model->Erasing        = 0U;
+  Model->EraseSuspended = 0U;
+  Model->Wel            = 0U;
+  Model->ProgramFail    = 0U;
+  Model->EraseFail      = 0U;
+  Model->Device->Reset(Model);
+
+  Model->Op    = NOR_OP_RESET;
+  Model->OpEnd = Model->Now + NOR_Time(Model->Timing.ResetRecovery);
+}
+
+/**
+  * @brief  Reads the array, wrapping at its end.
+  * @param  Corrupt: 1 when the command or the clock samples the data wrong
+  */
+void NOR_Read (NOR_ModelTypeDef *Model, uint32_t Address, uint8_t *Data,
+               uint32_t Size, uint8_t Corrupt) {
+  uint32_t mask = Model->Device->Size - 1U;
+  uint32_t i;
+
+  if (NOR_Busy(Model)) {
+    NOR_Error(Model, "read at 0x%08X while busy", Address);
+    memset(Data, 0xFF, Size);
+    return;
+  }
+  if ((Model->EraseSuspended != 0U) &&
+      ((Address & mask) < (Model->EraseAddress + Model->EraseSize)) &&
+      (((Address & mask) + Size) > Model->EraseAddress)) {
+    NOR_Error(Model, "read at 0x%08X in the suspended erase", Address);
+  }
+
+  for (i = 0U; i < Size; i++) {
+    Data[i] = Model->Array[(Address + i) & mask];
+  }
+  if (Corrupt != 0U) {
+    for (i = 0U; i < Size; i++) {
+      Data[i] ^= 0xA5U;
+    }
+    Model->Stats.Corrupted++;
+  }
+  Model->Stats.BytesRead += Size;
+}
+
+/**
+  * @brief  Page program: the bits are cleared, the address wraps in the
+  *         page. The time is in proportion to the bytes, plus a fixed part.
+  */
+void NOR_Program (NOR_ModelTypeDef *Model, uint32_t Address, const uint8_t *Data,
+                  uint32_t Size) {
+  uint32_t page = Model->Device->PageSize;
+  uint32_t base;
+  uint32_t i;
+
+  if (NOR_Busy(Model)) {
+    NOR_Error(Model, "program at 0x%08X while busy", Address);
+    return;
+  }
+  if (Model->Wel == 0U) {
+    NOR_Error(Model, "program at 0x%08X without write enable", Address);
+    return;
+  }
+  Address &= Model->Device->Size - 1U;
+  if ((Model->EraseSuspended != 0U) &&
+      (Address >= Model->EraseAddress) && (Address < (Model->EraseAddress + Model->EraseSize))) {
+    NOR_Error(Model, "program at 0x%08X in the suspended erase", Address);
+    Model->ProgramFail = 1U;
+    Model->Wel         = 0U;
+    return;
+  }
+  if (Size > page) {
+    NOR_Error(Model, "program of %u bytes at 0x%08X, above the page", Size, Address);
+  }
+
+  base = Address & ~(page - 1U);
+  for (i = 0U; i < Size; i++) {
+    Model->Array[base + ((Address + i) & (page - 1U))] &= Data[i];
+  }
+
+  Model->ProgramFail = 0U;
+  Model->Stats.Programs++;
+  Model->Stats.BytesProgrammed += Size;
+  Model->Op    = NOR_OP_PROGRAM;
+  Model->OpEnd = Model->Now + ((NOR_Time(Model->Timing.PageProgram) * ((page / 8U) + Size)) /
+                               ((page / 8U) + page));
+}
+
+/**
+  * @brief  Erase of Size bytes at Address, aligned: 4 kB, 64 kB or the chip.
+  */
+void NOR_Erase (NOR_ModelTypeDef *Model, uint32_t Address, uint32_t Size) {
+  uint32_t time;
+
+  if (NOR_Busy(Model) || (Model->EraseSuspended != 0U)) {
+    NOR_Error(Model, "erase at 0x%08X while %s", Address, NOR_Busy(Model) ? "busy" : "an erase is suspended");
+    return;
+  }
+  if (Model->Wel == 0U) {
+    NOR_Error(Model, "erase at 0x%08X without write enable", Address);
+    return;
+  }
+
+  if (Size >= Model->Device->Size) {
+    Size = Model->Device->Size;
+    time = Model->Timing.ChipErase;
+    Model->Stats.ChipErases++;
+  } else if (Size > 0x1000U) {
+    time = Model->Timing.BlockErase;
+    Model->Stats.BlockErases++;
+  } else {
+    time = Model->Timing.SectorErase;
+    Model->Stats.SectorErases++;
+  }
+
+  Model->EraseAddress = (Address & (Model->Device->Size - 1U)) & ~(Size - 1U);
+  Model->EraseSize    = Size;
+  Model->EraseFail    = 0U;
+  Model->Erasing      = 1U;
+  Model->Op           = NOR_OP_ERASE;
+  Model->OpEnd        = Model->Now + NOR_Time(time);
+}
+
+/**
+  * @brief  Erase suspend: the device is ready after the suspend latency. An
+  *         erase ending within the latency completes instead.
+  */
+void NOR_Suspend (NOR_ModelTypeDef *Model) {
+  uint64_t ready = Model->Now + NOR_Time(Model->Timing.SuspendLatency);
+
+  if ((Model->Op != NOR_OP_ERASE) || (Model->OpEnd <= ready)) {
+    return;
+  }
+  Model->Stats.Suspends++;
+  Model->EraseLeft = Model->OpEnd - ready;
+  Model->Op        = NOR_OP_SUSPENDING;
+  Model->OpEnd     = ready;
+}
+
+/**
+  * @brief  Erase resume: each resume costs the erase some of its progress.
+  */
+void NOR_Resume (NOR_ModelTypeDef *Model) {
+  if ((Model->EraseSuspended == 0U) || NOR_Busy(Model)) {
+    return;
+  }
+  Model->Stats.Resumes++;
+  Model->EraseSuspended = 0U;
+  Model->EraseLeft     += NOR_Time(Model->Timing.ResumeOverhead);
+  Model->Op             = NOR_OP_ERASE;
+  Model->OpEnd          = Model->Now + Model->EraseLeft;
+}
+
+/**
+  * @brief  Write of a non-volatile register, busy for its write time.
+  */
+void NOR_RegisterWrite (NOR_ModelTypeDef *Model) {
+  Model->Op    = NOR_OP_REGISTER;
+  Model->OpEnd = Model->Now + NOR_Time(Model->Timing.RegisterWrite);
+}
+
+/**
+  * @brief  Fills Data with the register value of Bytes bytes, repeated.
+  */
+void NOR_Fill (uint8_t *Data, uint32_t Size, const uint8_t *Value, uint32_t Bytes) {
+  uint32_t i;
+
+  for (i = 0U; i < Size; i++) {
+    Data[i] = Value[i % Bytes];
+  }
+}
+
+/**
+  * @brief  Command the device does not see: another protocol is active.
+  */
+void NOR_Ignore (NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd, const char *Reason) {
+  (void)Cmd;
+  (void)Reason;
+  Model->Stats.Ignored++;
+}
+
+/**
+  * @brief  Command rejected or misread by the device, reported on stderr.
+  */
+void NOR_Error (NOR_ModelTypeDef *Model, const char *Format, ...) {
+  va_list args;
+
+  Model->Stats.Errors++;
+  fprintf(stderr, "%s: %12.3f ms: ", Model->Device->Name, (double)Model->Now / 1e6);
+  va_start(args, Format);
+  vfprintf(stderr, Format, args);
+  va_end(args);
+  fputc('\n', stderr);
+}
@@ -0,0 +1,188 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Host tests of the ST STM32L4 Flash algorithms
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/**
+  ******************************************************************************
+  * @file    STM32L4NorModel.h
+  * @brief   Behavioral model of a serial NOR Flash, at the level of its
+  *          commands: the array, the write enable latch, the program and
+  *          erase operations in time, the erase suspend and resume. The
+  *          personality of a device (STM32L4MX25Model.c, STM32L4N25QModel.c)
+  *          decodes its commands and calls the operations of the model.
+  ******************************************************************************
+  */
+
+
+#ifndef __STM32L4NORMODEL_H
+#define __STM32L4NORMODEL_H
+#include "stdint.h"
+
+/* Time of the model, ns of the host virtual time */
+#define NOR_NEVER               UINT64_MAX
+#define NOR_US                  1000ULL
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Command on the bus: the lines and the bytes of each phase, 0 when the
+   phase is absent */
+typedef struct
+{
+  uint32_t Instruction;
+  uint8_t  InstructionLines;
+  uint8_t  InstructionBytes;
+  uint8_t  InstructionDtr;
+  uint32_t Address;
+  uint8_t  AddressLines;
+  uint8_t  AddressBytes;
+  uint8_t  AddressDtr;
+  uint32_t Alternate;
+  uint8_t  AlternateLines;
+  uint8_t  AlternateBytes;
+  uint8_t  AlternateDtr;
+  uint8_t  DataLines;
+  uint8_t  DataDtr;
+  uint8_t  Dqs;
+  uint32_t DummyCycles;
+  uint32_t Clock;               /* Hz */
+} NOR_CmdTypeDef;
+
+/* Timings of the device and of the board, the test may change them */
+typedef struct
+{
+  uint32_t PageProgram;         /* us, full page                            */
+  uint32_t SectorErase;         /* us, smallest erase (4 kB)                */
+  uint32_t BlockErase;          /* us, 64 kB                                */
+  uint32_t ChipErase;           /* us                                       */
+  uint32_t RegisterWrite;       /* us, non-volatile register                */
+  uint32_t ResetRecovery;       /* us                                       */
+  uint32_t SuspendLatency;      /* us, from the suspend command to ready    */
+  uint32_t ResumeOverhead;      /* us of erase lost at each resume          */
+  uint32_t MaxClockStr;         /* Hz, reads sampled right by the board up  */
+  uint32_t MaxClockDtr;         /*     to these clocks                      */
+} NOR_TimingTypeDef;
+
+typedef struct
+{
+  uint32_t Commands;            /* commands decoded, polls excluded         */
+  uint32_t Polls;               /* status reads of the automatic polling    */
+  uint32_t Ignored;             /* commands of another protocol             */
+  uint32_t Errors;              /* commands the device rejects or misreads  */
+  uint32_t Corrupted;           /* reads with wrong dummy cycles or clock   */
+  uint32_t Programs;
+  uint32_t BytesProgrammed;
+  uint32_t BytesRead;
+  uint32_t SectorErases;
+  uint32_t BlockErases;
+  uint32_t ChipErases;
+  uint32_t Suspends;
+  uint32_t Resumes;
+  uint32_t Aborted;             /* operations stopped by a reset            */
+} NOR_StatsTypeDef;
+
+typedef struct NOR_Model NOR_ModelTypeDef;
+
+/* Personality of a device */
+typedef struct
+{
+  const char        *Name;
+  uint32_t           Size;
+  uint32_t           PageSize;
+  NOR_TimingTypeDef  Timing;    /* defaults */
+  /* Registers to their reset value */
+  void        (*Reset)    (NOR_ModelTypeDef *Model);
+  /* Executes a command, Data holds Size bytes written or read */
+  void        (*Command)  (NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd,
+                           uint8_t *Data, uint32_t Size, uint8_t Write);
+  /* NULL when the command reads the array correctly, else the reason */
+  const char *(*CheckRead)(NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd);
+} NOR_DeviceTypeDef;
+
+typedef enum
+{
+  NOR_OP_IDLE = 0,
+  NOR_OP_PROGRAM,
+  NOR_OP_ERASE,
+  NOR_OP_SUSPENDING,            /* erase, until the suspend latency ends     */
+  NOR_OP_REGISTER,
+  NOR_OP_RESET
+} NOR_OpTypeDef;
+
+struct NOR_Model
+{
+  const NOR_DeviceTypeDef *Device;
+  uint8_t           *Array;
+  NOR_TimingTypeDef  Timing;
+  NOR_StatsTypeDef   Stats;
+  uint64_t           Now;
+
+  NOR_OpTypeDef      Op;
+  uint64_t           OpEnd;
+  uint8_t            Wel;
+  uint8_t            ResetEnable;     /* 1 after the reset enable command, the
+                                         personality sets 2 when it decodes it */
+  uint8_t            ProgramFail;
+  uint8_t            EraseFail;
+
+  /* Erase running, suspending or suspended */
+  uint8_t            Erasing;
+  uint8_t            EraseSuspended;
+  uint32_t           EraseAddress;
+  uint32_t           EraseSize;
+  uint64_t           EraseLeft;       /* ns, when suspended */
+
+  uint32_t           Reg[8];          /* registers of the personality */
+  uint32_t           Random;
+};
+
+/* Exported functions --------------------------------------------------------*/
+void     NOR_Init       (NOR_ModelTypeDef *Model, const NOR_DeviceTypeDef *Device,
+                         const NOR_TimingTypeDef *Timing, uint8_t *Array);
+void     NOR_Sync       (NOR_ModelTypeDef *Model, uint64_t Now);
+uint64_t NOR_NextEvent  (NOR_ModelTypeDef *Model);
+void     NOR_Transfer   (NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd,
+                         uint8_t *Data, uint32_t Size, uint8_t Write, uint8_t Poll);
+
+/* Operations, called by the personalities */
+uint8_t  NOR_Busy       (NOR_ModelTypeDef *Model);
+void     NOR_Reset      (NOR_ModelTypeDef *Model);
+void     NOR_Read       (NOR_ModelTypeDef *Model, uint32_t Address, uint8_t *Data,
+                         uint32_t Size, uint8_t Corrupt);
+void     NOR_Program    (NOR_ModelTypeDef *Model, uint32_t Address, const uint8_t *Data,
+                         uint32_t Size);
+void     NOR_Erase      (NOR_ModelTypeDef *Model, uint32_t Address, uint32_t Size);
+void     NOR_Suspend    (NOR_ModelTypeDef *Model);
+void     NOR_Resume     (NOR_ModelTypeDef *Model);
+void     NOR_RegisterWrite(NOR_ModelTypeDef *Model);
+void     NOR_Fill       (uint8_t *Data, uint32_t Size, const uint8_t *Value, uint32_t Bytes);
+void     NOR_Ignore     (NOR_ModelTypeDef *Model, const NOR_CmdTypeDef *Cmd, const char *Reason);
+void     NOR_Error      (NOR_ModelTypeDef *Model, const char *Format, ...);
+
+#endif
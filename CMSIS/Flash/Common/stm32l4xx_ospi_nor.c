@@ -0,0 +1,2346 @@
+/**
+  ******************************************************************************
+  * @file    stm32l4xx_ospi_nor.c
+  * @author  MCD Application Team
+  * @brief   This file includes a standard driver for the MX25LM51245G OSPI
+  *          memory mounted on the STM32L4R9I-DK, STM32L4P5G-DK and
+  *          STM32L4R9I-EVAL boards.
+  @verbatim
+  ==============================================================================
+                     ##### How to use this driver #####
+  ==============================================================================
+  [..]
+   (#) This driver is used to drive the MX25LM51245G OSPI external
+       memory mounted on the STM32L4R9I-DK, STM32L4P5G-DK and STM32L4R9I-EVAL
+       boards.
+
+   (#) The OctoSPI instance, the OctoSPI IO Manager port, the GPIOs and the
+       STR/DTR protocol of the board are read from OSPI_NOR_Board, defined
+       in the STM32L4OSPIBoard.c file of each loader.
+
+   (#) BSP_OSPI_NOR_Init() selects the fastest OctoSPI clock, down to the
+       clock of the board, and the protocol at which the SFDP of the memory
+       reads the same in octal mode as in SPI mode. Octal DTR is tried first
+       when the board supports it, then octal STR. The clocks above the
+       OctoSPI limit of the MCU are skipped, and the clock used is one step
+       slower than the first passing one, down to the clock of the board.
+
+   (#) This driver need a specific component driver (MX25LM51245G) to be included with.
+
+   (#) Initialization steps:
+       (++) Initialize the OPSI external memory using the BSP_OSPI_NOR_Init() function. This
+            function includes the MSP layer hardware resources initialization and the
+            OSPI interface with the external memory.
+
+   (#) OSPI memory operations
+       (++) OSPI memory can be accessed with read/write operations once it is
+            initialized.
+            Read/write operation can be performed with AHB access using the functions
+            BSP_OSPI_NOR_Read()/BSP_OSPI_NOR_Write().
+       (++) The function BSP_OSPI_NOR_GetInfo() returns the configuration of the OSPI memory.
+            (see the OSPI memory data sheet)
+       (++) Perform erase block operation using the function BSP_OSPI_NOR_Erase_Block() and by
+            specifying the block address. You can perform an erase operation of the whole
+            chip by calling the function BSP_OSPI_NOR_Erase_Chip().
+       (++) The function BSP_OSPI_NOR_GetStatus() returns the current status of the OSPI memory.
+            (see the OSPI memory data sheet)
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "STM32L4OSPI.h"
+#include "STM32L4Tick.h"
+#include <string.h>
+
+#if !defined OSPI_NOR_LEAN
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32L4_OSPI_Boards
+  * @{
+  */
+
+/** @defgroup STM32L4_OSPI_NOR STM32L4 OSPI NOR
+  * @{
+  */
+
+/* Private constants --------------------------------------------------------*/
+/** @defgroup STM32L4_OSPI_NOR_Private_Constants Private Constants
+  * @{
+  */
+#define OSPI_NOR_OCTAL_DISABLE      0x0
+#define OSPI_NOR_OCTAL_ENABLE       0x1
+
+#define OSPI_NOR_IRQn               ((OSPI_NOR_Board.Instance == OCTOSPI1) ? OCTOSPI1_IRQn : OCTOSPI2_IRQn)
+
+/* DMA channel feeding the OctoSPI FIFO during page programming */
+#define OSPI_NOR_DMA_INSTANCE       DMA2_Channel7
+#define OSPI_NOR_DMA_IRQn           DMA2_Channel7_IRQn
+#define OSPI_NOR_DMA_REQUEST        ((OSPI_NOR_Board.Instance == OCTOSPI1) ? DMA_REQUEST_OCTOSPI1 : DMA_REQUEST_OCTOSPI2)
+#define OSPI_NOR_PROG_TIMEOUT       10U    /* ms, page transfer to the FIFO */
+#define MEM_READY_POLLING_INTERVAL  0x80   /* OctoSPI clock cycles between status reads */
+
+/* Dummy cycles of the octal register reads */
+#define DUMMY_CYCLES_READ_OCTAL     MX25LM51245G_DUMMY_CYCLES_READ_OCTAL_66M
+
+/* Octal commands not defined by the component */
+#define OSPI_NOR_OCTAL_RESET_ENABLE_CMD  0x6699
+#define OSPI_NOR_OCTAL_RESET_MEMORY_CMD  0x9966
+#define OSPI_NOR_OCTAL_READ_SFDP_CMD     0x5AA5
+#define OSPI_NOR_OCTAL_SFDP_DUMMY_CYCLES 20U     /* fixed, whatever the CR2 setting */
+
+/* Octal command of an SPI instruction: the instruction, then its inverse */
+#define OSPI_NOR_OCTAL_CMD(inst)    ((uint32_t)(((uint32_t)(inst) << 8) | (~(uint32_t)(inst) & 0xFFU)))
+
+/* Calibration: SFDP bytes read in SPI mode and compared in octal mode, and
+   sampling settings tried at each OctoSPI clock. The pattern covers the
+   header and the parameter tables, the unused bytes after them read 0xFF.
+   The sampling settings are those of the OSPI HAL initialization: delay
+   block used or bypassed, half cycle shift. The tap of the delay block is
+   not swept, the HAL sets no tap, and in DTR the data are sampled on DQS */
+#define OSPI_NOR_PATTERN_SIZE       256U
+#define OSPI_NOR_SAMPLING_BYPASS    0x1U   /* delay block bypassed          */
+#define OSPI_NOR_SAMPLING_SHIFT     0x2U   /* half cycle shift, STR only    */
+#define OSPI_NOR_SAMPLINGS          4U
+
+/* Fastest OctoSPI clock of the STM32L4R/S and L4P/Q, octal STR and DTR:
+   the calibration never tries a faster one */
+#define OSPI_NOR_MAX_CLOCK_STR      86000000U
+#define OSPI_NOR_MAX_CLOCK_DTR      60000000U
+/**
+  * @}
+  */
+
+/* Private types -------------------------------------------------------------*/
+
+/* Dummy cycles of the memory array reads, up to an OctoSPI clock */
+typedef struct
+{
+  uint32_t MaxClock;          /* Hz                                 */
+  uint8_t  DummyCycles;
+  uint8_t  DummyCfg;          /* DC field of the CR2 register 0x300 */
+} OSPI_NOR_DummyTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+
+/** @defgroup STM32L4_OSPI_NOR_Private_Variables Private Variables
+  * @{
+  */
+OSPI_HandleTypeDef OSPINORHandle;
+static DMA_HandleTypeDef OSPI_NOR_DmaHandle;
+
+/* Time spent waiting for the memory by the last operation, in us */
+static uint32_t OSPI_NOR_WaitTime = 0;
+
+/* Commands sent to the memory since the algorithm was loaded */
+static uint32_t OSPI_NOR_Commands = 0;
+
+/* Parameters read from the SFDP of the memory, OSPI_NOR_SfdpStatus is 0xFF
+   until they are read */
+static SFDP_InfoTypeDef OSPI_NOR_Sfdp;
+static uint8_t          OSPI_NOR_SfdpStatus = 0xFF;
+static uint32_t         OSPI_NOR_FlashSize  = MX25LM51245G_FLASH_SIZE;
+static uint32_t         OSPI_NOR_PageSize   = MX25LM51245G_PAGE_SIZE;
+static uint8_t          OSPI_NOR_Pattern[OSPI_NOR_PATTERN_SIZE];
+static uint8_t          OSPI_NOR_PatternRead[OSPI_NOR_PATTERN_SIZE];   /* off the stack */
+
+/* Commands of the memory, from its SFDP or the MX25LM51245G ones. The
+   suspend command is 0 when the memory cannot suspend an erase */
+static uint32_t OSPI_NOR_BlockEraseCmd   = OCTAL_BLOCK_ERASE_CMD;
+static uint32_t OSPI_NOR_SectorEraseCmd  = OCTAL_SECTOR_ERASE_CMD;
+static uint32_t OSPI_NOR_EraseSuspendCmd = OCTAL_PROG_ERASE_SUSPEND_CMD;
+static uint32_t OSPI_NOR_EraseResumeCmd  = OCTAL_PROG_ERASE_RESUME_CMD;
+static uint8_t  OSPI_NOR_DtrSupported    = 1;
+
+/* Last page program of BSP_OSPI_NOR_Write not polled yet */
+static uint8_t  OSPI_NOR_ProgramPending  = 0;
+
+/* Protocol and read dummy cycles selected by the calibration */
+static uint8_t  OSPI_NOR_Dtr         = 0;
+static uint32_t OSPI_NOR_DummyCycles = MX25LM51245G_DUMMY_CYCLES_READ_OCTAL_66M;
+static uint8_t  OSPI_NOR_DummyCfg    = MX25LM51245G_CR2_DC_66M;
+
+/* MX25LM51245G data sheet, octal STR and DTR */
+static const OSPI_NOR_DummyTypeDef OSPI_NOR_Dummy[] =
+{
+  {  66000000U,  6U, 0x07U },
+  {  84000000U,  8U, 0x06U },
+  { 104000000U, 10U, 0x05U },
+  { 133000000U, 12U, 0x04U },
+  { 200000000U, 20U, 0x00U },
+};
+
+/**
+  * @}
+  */
+
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup STM32L4_OSPI_NOR_Private_Functions Private Functions
+  * @{
+  */
+static void    OSPI_NOR_MspInit            (void);
+static void    OSPI_NOR_MspDeInit          (void);
+static HAL_StatusTypeDef OSPI_NOR_Command  (OSPI_HandleTypeDef *hospi, OSPI_RegularCmdTypeDef *cmd, uint32_t Timeout);
+static uint8_t OSPI_NOR_ResetMemory        (OSPI_HandleTypeDef *hospi);
+static uint8_t OSPI_NOR_WriteEnable        (OSPI_HandleTypeDef *hospi);
+static uint8_t OSPI_NOR_AutoPollingMemReady(OSPI_HandleTypeDef *hospi, uint32_t Timeout);
+static uint8_t OSPI_NOR_ProgramWait        (OSPI_HandleTypeDef *hospi);
+static uint8_t OSPI_NOR_WaitForFlag        (OSPI_HandleTypeDef *hospi, uint32_t Flag, uint32_t Timeout);
+static uint8_t OSPI_NOR_OctalMode          (OSPI_HandleTypeDef *hospi, uint8_t Operation);
+static uint8_t OSPI_NOR_ReadSFDP           (uint32_t Address, uint8_t *pData, uint32_t Size);
+static uint8_t OSPI_NOR_MemoryCfg          (OSPI_HandleTypeDef *hospi);
+static uint32_t OSPI_NOR_EraseCmd          (const SFDP_EraseTypeDef *pErase);
+static uint8_t OSPI_NOR_SetTiming          (OSPI_HandleTypeDef *hospi, uint32_t Prescaler, uint8_t Dtr, uint32_t Sampling);
+static uint8_t OSPI_NOR_CheckPattern       (OSPI_HandleTypeDef *hospi);
+static uint8_t OSPI_NOR_TrySetting         (OSPI_HandleTypeDef *hospi, uint32_t Prescaler, uint8_t Dtr, uint32_t Sampling);
+static uint8_t OSPI_NOR_Calibrate          (OSPI_HandleTypeDef *hospi);
+/**
+  * @}
+  */
+
+/* Exported functions ---------------------------------------------------------*/
+
+/** @addtogroup STM32L4_OSPI_NOR_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initializes the OSPI interface.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_Init(void)
+{
+  OSPIM_CfgTypeDef OSPIM_Cfg_Struct;
+memset(&OSPIM_Cfg_Struct,0,sizeof(OSPIM_Cfg_Struct));
+memset(&OSPINORHandle,0,sizeof(OSPINORHandle));	
+  OSPINORHandle.Instance = OSPI_NOR_Board.Instance;
+  OSPI_NOR_ProgramPending = 0;
+
+  /* Call the DeInit function to reset the driver */
+  if (HAL_OSPI_DeInit(&OSPINORHandle) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* System level initialization */
+  OSPI_NOR_MspInit();
+
+  /* OctoSPI initialization */
+  OSPINORHandle.Init.FifoThreshold         = 4;
+  OSPINORHandle.Init.DualQuad              = HAL_OSPI_DUALQUAD_DISABLE;
+  OSPINORHandle.Init.DeviceSize            = POSITION_VAL(MX25LM51245G_FLASH_SIZE); /* 512 MBits */
+  OSPINORHandle.Init.ChipSelectHighTime    = 2;
+  OSPINORHandle.Init.FreeRunningClock      = HAL_OSPI_FREERUNCLK_DISABLE;
+  OSPINORHandle.Init.ClockMode             = HAL_OSPI_CLOCK_MODE_0;
+  OSPINORHandle.Init.ClockPrescaler        = OSPI_NOR_Board.ClockPrescaler; /* OctoSPI clock = SYSCLK / ClockPrescaler */
+  OSPINORHandle.Init.SampleShifting        = HAL_OSPI_SAMPLE_SHIFTING_NONE;
+  if (OSPI_NOR_Board.Dtr == 0U)
+  {
+    OSPINORHandle.Init.MemoryType            = HAL_OSPI_MEMTYPE_MICRON;
+    OSPINORHandle.Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_DISABLE;
+  }
+  else
+  {
+    OSPINORHandle.Init.MemoryType            = HAL_OSPI_MEMTYPE_MACRONIX;
+    OSPINORHandle.Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_ENABLE;
+  }
+  OSPINORHandle.Init.ChipSelectBoundary    = 0;
+  OSPINORHandle.Init.DelayBlockBypass      = HAL_OSPI_DELAY_BLOCK_USED;
+
+  if (HAL_OSPI_Init(&OSPINORHandle) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* OctoSPI IO Manager configuration, the reset mapping is kept when the
+     board does not define a port */
+  if (OSPI_NOR_Board.Ospim.ClkPort != 0U)
+  {
+    OSPIM_Cfg_Struct = OSPI_NOR_Board.Ospim;
+
+    if (HAL_OSPIM_Config(&OSPINORHandle, &OSPIM_Cfg_Struct, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+  }
+
+  /* OctoSPI memory reset */
+  if (OSPI_NOR_ResetMemory(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_NOT_SUPPORTED;
+  }
+
+  /* Geometry of the memory from its SFDP, in SPI mode */
+  if (OSPI_NOR_MemoryCfg(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_NOT_SUPPORTED;
+  }
+
+  /* OctoSPI octal enable, at the fastest clock and protocol passing the
+     calibration */
+  if (OSPI_NOR_Calibrate(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  De-Initializes the OSPI interface.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_DeInit(void)
+{
+  OSPINORHandle.Instance = OSPI_NOR_Board.Instance;
+
+  if (OSPI_NOR_ProgramWait(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Abort any activity on OctoSPI (eg Memory-mapped mode) */
+  if (HAL_OSPI_GetState(&OSPINORHandle) != HAL_OSPI_STATE_READY)
+  {
+    if (HAL_OSPI_Abort(&OSPINORHandle) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+  }
+
+  /* OctoSPI octal mode disable */
+  if (OSPI_NOR_OctalMode(&OSPINORHandle, OSPI_NOR_OCTAL_DISABLE) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Call the DeInit function to reset the driver */
+  if (HAL_OSPI_DeInit(&OSPINORHandle) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* System level De-initialization */
+  OSPI_NOR_MspDeInit();
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Reads an amount of data from the OSPI memory.
+  * @param  pData: Pointer to data to be read
+  * @param  ReadAddr: Read start address
+  * @param  Size: Size of data to read
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_Read(uint8_t* pData, uint32_t ReadAddr, uint32_t Size)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+
+  if (OSPI_NOR_ProgramWait(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Initialize the read command */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.Address               = ReadAddr;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_8_LINES;
+  sCommand.AddressSize           = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_8_LINES;
+  sCommand.NbData                = Size;
+  sCommand.DummyCycles           = OSPI_NOR_DummyCycles;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.Instruction           = OCTAL_IO_READ_CMD;
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_DISABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  }
+  else
+  {
+    sCommand.Instruction           = OCTAL_IO_DTR_READ_CMD;
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_ENABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_ENABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_ENABLE;
+  }
+
+  /* Configure the command */
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Reception of the data */
+  if (HAL_OSPI_Receive(&OSPINORHandle, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Writes an amount of data to the OSPI memory.
+  * @param  pData: Pointer to data to be written
+  * @param  WriteAddr: Write start address
+  * @param  Size: Size of data to write
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_Write(uint8_t* pData, uint32_t WriteAddr, uint32_t Size)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+  uint32_t end_addr, current_size, current_addr;
+
+  if (OSPI_NOR_ProgramWait(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Calculation of the size between the write address and the end of the page */
+  current_size = OSPI_NOR_PageSize - (WriteAddr % OSPI_NOR_PageSize);
+
+  /* Check if the size of the data is less than the remaining place in the page */
+  if (current_size > Size)
+  {
+    current_size = Size;
+  }
+
+  /* Initialize the adress variables */
+  current_addr = WriteAddr;
+  end_addr = WriteAddr + Size;
+
+  /* Initialize the program command */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = OCTAL_PAGE_PROG_CMD;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_8_LINES;
+  sCommand.AddressSize           = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_8_LINES;
+  sCommand.DummyCycles           = 0;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_DISABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  }
+  else
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_ENABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_ENABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_ENABLE;
+  }
+
+  /* Perform the write page by page */
+  do
+  {
+    sCommand.Address = current_addr;
+    sCommand.NbData  = current_size;
+
+    /* Enable write operations */
+    if (OSPI_NOR_WriteEnable(&OSPINORHandle) != OSPI_NOR_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Configure the command */
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Transmission of the data by DMA, the core sleeps until the end of
+       the transfer */
+    if (HAL_OSPI_Transmit_DMA(&OSPINORHandle, pData) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (OSPI_NOR_WaitForFlag(&OSPINORHandle, HAL_OSPI_FLAG_TC, OSPI_NOR_PROG_TIMEOUT) != OSPI_NOR_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Configure automatic polling mode to wait for end of program. The
+       last page is polled by the next command of the driver: it programs
+       while the debugger downloads the next buffer */
+    if ((current_addr + current_size) < end_addr)
+    {
+      if (OSPI_NOR_AutoPollingMemReady(&OSPINORHandle, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != OSPI_NOR_OK)
+      {
+        return OSPI_NOR_ERROR;
+      }
+    }
+    else
+    {
+      OSPI_NOR_ProgramPending = 1;
+    }
+
+    /* Update the address and size variables for next page programming */
+    current_addr += current_size;
+    pData += current_size;
+    current_size = ((current_addr + OSPI_NOR_PageSize) > end_addr) ? (end_addr - current_addr) : OSPI_NOR_PageSize;
+  } while (current_addr < end_addr);
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Starts the erase of the specified block of the OSPI memory.
+  * @param  BlockAddress: Block address to erase
+  * @retval OSPI memory status
+  * @note This function is non blocking meaning that block erase
+  *       operation is started but not completed when the function
+  *       returns. Application has to call BSP_OSPI_NOR_GetStatus()
+  *       to know when the device is available again (i.e. erase operation
+  *       completed). The erase can be suspended meanwhile.
+  */
+uint8_t BSP_OSPI_NOR_Erase_Block_Start(uint32_t BlockAddress)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+
+  if (OSPI_NOR_ProgramWait(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Initialize the erase command */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = OSPI_NOR_BlockEraseCmd;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.Address               = BlockAddress;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_8_LINES;
+  sCommand.AddressSize           = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_NONE;
+  sCommand.DummyCycles           = 0;
+  sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+  }
+  else
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_ENABLE;
+  }
+
+  /* Enable write operations */
+  if (OSPI_NOR_WriteEnable(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Send the command */
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Erases the specified block of the OSPI memory.
+  * @param  BlockAddress: Block address to erase
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_Erase_Block(uint32_t BlockAddress)
+{
+  /* Send the erase command */
+  if (BSP_OSPI_NOR_Erase_Block_Start(BlockAddress) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Configure automatic polling mode to wait for end of erase */
+  if (OSPI_NOR_AutoPollingMemReady(&OSPINORHandle, MX25LM51245G_BLOCK_ERASE_MAX_TIME) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Erases the specified sector of the OSPI memory.
+  * @param  Sector: Sector address to erase (0 to 255)
+  * @retval OSPI memory status
+  * @note This function is non blocking meaning that sector erase
+  *       operation is started but not completed when the function
+  *       returns. Application has to call BSP_QSPI_GetStatus()
+  *       to know when the device is available again (i.e. erase operation
+  *       completed).
+  */
+uint8_t BSP_OSPI_NOR_Erase_Sector(uint32_t Sector)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+
+  if (Sector >= (uint32_t)(OSPI_NOR_FlashSize/MX25LM51245G_SECTOR_SIZE))
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  if (OSPI_NOR_ProgramWait(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Initialize the erase command */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = OSPI_NOR_SectorEraseCmd;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.Address               = (Sector * MX25LM51245G_SECTOR_SIZE);
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_8_LINES;
+  sCommand.AddressSize           = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_NONE;
+  sCommand.DummyCycles           = 0;
+  sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+  }
+  else
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_ENABLE;
+  }
+
+  /* Enable write operations */
+  if (OSPI_NOR_WriteEnable(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Send the command */
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Erases the entire OSPI memory.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_Erase_Chip(void)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+
+  if (OSPI_NOR_ProgramWait(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Initialize the erase command */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = OCTAL_CHIP_ERASE_CMD;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_NONE;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_NONE;
+  sCommand.DummyCycles           = 0;
+  sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  }
+  else
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+  }
+
+  /* Enable write operations */
+  if (OSPI_NOR_WriteEnable(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Send the command */
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Configure automatic polling mode to wait for end of erase */
+  if (OSPI_NOR_AutoPollingMemReady(&OSPINORHandle, MX25LM51245G_CHIP_ERASE_MAX_TIME) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Reads current status of the OSPI memory.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_GetStatus(void)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+  uint8_t reg[2];
+
+  if (OSPI_NOR_ProgramWait(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Initialize the read security register command */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = OCTAL_READ_SECURITY_REG_CMD;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.Address               = 0;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_8_LINES;
+  sCommand.AddressSize           = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_8_LINES;
+  sCommand.NbData                = 2;
+  sCommand.DummyCycles           = DUMMY_CYCLES_READ_OCTAL;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_DISABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  }
+  else
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_ENABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_ENABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_ENABLE;
+  }
+
+  /* Configure the command */
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Reception of the data */
+  if (HAL_OSPI_Receive(&OSPINORHandle, reg, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Check the value of the register */
+  if ((reg[0] & (MX25LM51245G_SECR_P_FAIL | MX25LM51245G_SECR_E_FAIL)) != 0)
+  {
+    return OSPI_NOR_ERROR;
+  }
+  else if ((reg[0] & (MX25LM51245G_SECR_PSB | MX25LM51245G_SECR_ESB)) != 0)
+  {
+    return OSPI_NOR_SUSPENDED;
+  }
+
+  /* Initialize the read status register command */
+  sCommand.Instruction = OCTAL_READ_STATUS_REG_CMD;
+
+  /* Configure the command */
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Reception of the data */
+  if (HAL_OSPI_Receive(&OSPINORHandle, reg, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Check the value of the register */
+  if ((reg[0] & MX25LM51245G_SR_WIP) != 0)
+  {
+    return OSPI_NOR_BUSY;
+  }
+  else
+  {
+    return OSPI_NOR_OK;
+  }
+}
+
+/**
+  * @brief  Return the configuration of the OSPI memory.
+  * @param  pInfo: pointer on the configuration structure
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_GetInfo(OSPI_NOR_Info* pInfo)
+{
+  /* Configure the structure with the memory configuration */
+  pInfo->FlashSize          = OSPI_NOR_FlashSize;
+  pInfo->EraseSectorSize    = MX25LM51245G_BLOCK_SIZE;
+  pInfo->EraseSectorsNumber = (OSPI_NOR_FlashSize/MX25LM51245G_BLOCK_SIZE);
+  pInfo->ProgPageSize       = OSPI_NOR_PageSize;
+  pInfo->ProgPagesNumber    = (OSPI_NOR_FlashSize/OSPI_NOR_PageSize);
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Waits for the end of the ongoing program/erase operation.
+  * @param  Timeout: Timeout for the operation, in ms
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_WaitForReady(uint32_t Timeout)
+{
+  OSPI_NOR_ProgramPending = 0;
+
+  return OSPI_NOR_AutoPollingMemReady(&OSPINORHandle, Timeout);
+}
+
+/**
+  * @brief  Return the time spent waiting for the memory by the last
+  *         program/erase operation.
+  * @retval Wait time in us
+  */
+uint32_t BSP_OSPI_NOR_GetWaitTime(void)
+{
+  return OSPI_NOR_WaitTime;
+}
+
+/**
+  * @brief  Return the number of commands sent to the OSPI memory, a status
+  *         polling counts as one command.
+  * @retval Commands since the algorithm was loaded
+  */
+uint32_t BSP_OSPI_NOR_GetCommandCount(void)
+{
+  return OSPI_NOR_Commands;
+}
+
+/**
+  * @brief  Return the parameters read from the SFDP of the OSPI memory.
+  * @param  pInfo: pointer on the SFDP parameters
+  * @retval OSPI memory status, OSPI_NOR_NOT_SUPPORTED when the memory has no SFDP
+  */
+uint8_t BSP_OSPI_NOR_GetSFDP(SFDP_InfoTypeDef *pInfo)
+{
+  if (OSPI_NOR_SfdpStatus != SFDP_OK)
+  {
+    return OSPI_NOR_NOT_SUPPORTED;
+  }
+
+  *pInfo = OSPI_NOR_Sfdp;
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Configure the OSPI in memory-mapped mode, nothing is done when
+  *         the OSPI is already in memory-mapped mode.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_EnableMemoryMappedMode(void)
+{
+  OSPI_RegularCmdTypeDef   sCommand;
+  OSPI_MemoryMappedTypeDef sMemMappedCfg;
+
+  if (HAL_OSPI_GetState(&OSPINORHandle) == HAL_OSPI_STATE_BUSY_MEM_MAPPED)
+  {
+    return OSPI_NOR_OK;
+  }
+
+  if (OSPI_NOR_ProgramWait(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Enable write operations */
+  if (OSPI_NOR_WriteEnable(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Configure the command for the read instruction */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_READ_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_8_LINES;
+  sCommand.AddressSize           = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_8_LINES;
+  sCommand.DummyCycles           = OSPI_NOR_DummyCycles;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.Instruction           = OCTAL_IO_READ_CMD;
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_DISABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  }
+  else
+  {
+    sCommand.Instruction           = OCTAL_IO_DTR_READ_CMD;
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_ENABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_ENABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_ENABLE;
+  }
+
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Configure the command for the write instruction */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_WRITE_CFG;
+  sCommand.Instruction           = OCTAL_PAGE_PROG_CMD;
+  sCommand.DummyCycles           = 0;
+
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+   /* Configure the memory mapped mode */
+  sMemMappedCfg.TimeOutActivation = HAL_OSPI_TIMEOUT_COUNTER_DISABLE;
+
+  if (HAL_OSPI_MemoryMapped(&OSPINORHandle, &sMemMappedCfg) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Leaves the memory-mapped mode, back to the indirect mode. The
+  *         memory stays in octal mode.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_DisableMemoryMappedMode(void)
+{
+  if (HAL_OSPI_GetState(&OSPINORHandle) != HAL_OSPI_STATE_BUSY_MEM_MAPPED)
+  {
+    return OSPI_NOR_OK;
+  }
+
+  /* Aborting the memory-mapped mode releases the chip select */
+  if (HAL_OSPI_Abort(&OSPINORHandle) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function suspends an ongoing erase command.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_SuspendErase(void)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+  uint8_t status;
+
+  /* The SFDP of the memory has no erase suspend */
+  if (OSPI_NOR_EraseSuspendCmd == 0U)
+  {
+    return OSPI_NOR_NOT_SUPPORTED;
+  }
+
+  /* A suspend during the page program would suspend the program */
+  if (OSPI_NOR_ProgramWait(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Check whether the device is busy (erase operation is
+  in progress).
+  */
+  if (BSP_OSPI_NOR_GetStatus() == OSPI_NOR_BUSY)
+  {
+    /* Initialize the suspend command */
+    sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+    sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+    sCommand.Instruction           = OSPI_NOR_EraseSuspendCmd;
+    sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+    sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+    sCommand.AddressMode           = HAL_OSPI_ADDRESS_NONE;
+    sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+    sCommand.DataMode              = HAL_OSPI_DATA_NONE;
+    sCommand.DummyCycles           = 0;
+    sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+    sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+    if (OSPI_NOR_Dtr == 0U)
+    {
+      sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    }
+    else
+    {
+      sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    }
+
+  /* Send the command */
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* The device stays busy until the suspend latency has elapsed, the erase
+    may also have completed meanwhile.
+    */
+    if (OSPI_NOR_AutoPollingMemReady(&OSPINORHandle, ERASE_SUSPEND_TIMEOUT) != OSPI_NOR_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    status = BSP_OSPI_NOR_GetStatus();
+    if ((status == OSPI_NOR_SUSPENDED) || (status == OSPI_NOR_OK))
+    {
+      return OSPI_NOR_OK;
+    }
+
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function resumes a paused erase command.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_ResumeErase(void)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+
+  if (OSPI_NOR_ProgramWait(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Check whether the device is in suspended state */
+  if (BSP_OSPI_NOR_GetStatus() == OSPI_NOR_SUSPENDED)
+  {
+    /* Initialize the resume command */
+    sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+    sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+    sCommand.Instruction           = OSPI_NOR_EraseResumeCmd;
+    sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+    sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+    sCommand.AddressMode           = HAL_OSPI_ADDRESS_NONE;
+    sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+    sCommand.DataMode              = HAL_OSPI_DATA_NONE;
+    sCommand.DummyCycles           = 0;
+    sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+    sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+    if (OSPI_NOR_Dtr == 0U)
+    {
+      sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    }
+    else
+    {
+      sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    }
+
+    /* Send the command */
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /*
+    When this command is executed, the status register write in progress bit is set to 1, and
+    the flag status register program erase controller bit is set to 0. This command is ignored
+    if the device is not in a suspended state.
+    */
+
+    if (BSP_OSPI_NOR_GetStatus() == OSPI_NOR_BUSY)
+    {
+      return OSPI_NOR_OK;
+    }
+
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function enter the OSPI memory in deep power down mode.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_EnterDeepPowerDown(void)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+
+  if (OSPI_NOR_ProgramWait(&OSPINORHandle) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Initialize the deep power down command */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = OCTAL_ENTER_DEEP_POWER_DOWN_CMD;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_NONE;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_NONE;
+  sCommand.DummyCycles           = 0;
+  sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  }
+  else
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+  }
+
+  /* Send the command */
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* ---          Memory takes 10us max to enter deep power down          --- */
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function leave the OSPI memory from deep power down mode.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_LeaveDeepPowerDown(void)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+
+  /* Initialize the nop command */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = OCTAL_NO_OPERATION_CMD;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_NONE;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_NONE;
+  sCommand.DummyCycles           = 0;
+  sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  }
+  else
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+  }
+
+  /* Send the command */
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* --- A NOP command is sent to the memory, as the nCS should be low for at least 20 ns --- */
+  /* ---                  Memory takes 30us min to leave deep power down                  --- */
+
+  return OSPI_NOR_OK;
+}
+/**
+  * @}
+  */
+
+/** @addtogroup STM32L4_OSPI_NOR_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initializes the OSPI MSP.
+  * @retval None
+  */
+static void OSPI_NOR_MspInit(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct;
+  const OSPI_NOR_GpioTypeDef *gpio;
+
+  /* Enable the OctoSPI memory interface clock */
+  __HAL_RCC_OSPIM_CLK_ENABLE();
+  if (OSPI_NOR_Board.Instance == OCTOSPI1)
+  {
+    __HAL_RCC_OSPI1_CLK_ENABLE();
+
+    /* Reset the OctoSPI memory interface */
+    __HAL_RCC_OSPI1_FORCE_RESET();
+    __HAL_RCC_OSPI1_RELEASE_RESET();
+  }
+  else
+  {
+    __HAL_RCC_OSPI2_CLK_ENABLE();
+
+    /* Reset the OctoSPI memory interface */
+    __HAL_RCC_OSPI2_FORCE_RESET();
+    __HAL_RCC_OSPI2_RELEASE_RESET();
+  }
+
+  /* Enable GPIO clocks */
+  /* IOSV bit MUST be set to access GPIO port G[2:15] */
+  __HAL_RCC_PWR_CLK_ENABLE();
+  SET_BIT(PWR->CR2, PWR_CR2_IOSV);
+
+  /* OctoSPI CS, DQS, CLK and D0-D7 GPIO pins configuration, the table ends
+     with a NULL port */
+  GPIO_InitStruct.Mode      = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_VERY_HIGH;
+
+  for (gpio = OSPI_NOR_Board.Gpio; gpio->Port != NULL; gpio++)
+  {
+    /* The GPIOx enable bits of AHB2ENR follow the order of the ports */
+    SET_BIT(RCC->AHB2ENR, RCC_AHB2ENR_GPIOAEN << OSPI_NOR_GPIO_INDEX(gpio->Port));
+    (void)READ_BIT(RCC->AHB2ENR, RCC_AHB2ENR_GPIOAEN << OSPI_NOR_GPIO_INDEX(gpio->Port));
+
+    GPIO_InitStruct.Pin       = gpio->Pins;
+    GPIO_InitStruct.Pull      = gpio->Pull;
+    GPIO_InitStruct.Alternate = gpio->Alternate;
+    HAL_GPIO_Init(gpio->Port, &GPIO_InitStruct);
+  }
+
+  /* DMA channel of the page programming, memory to OctoSPI FIFO */
+  __HAL_RCC_DMA2_CLK_ENABLE();
+  __HAL_RCC_DMAMUX1_CLK_ENABLE();
+
+  OSPI_NOR_DmaHandle.Instance                 = OSPI_NOR_DMA_INSTANCE;
+  OSPI_NOR_DmaHandle.Init.Request             = OSPI_NOR_DMA_REQUEST;
+  OSPI_NOR_DmaHandle.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  OSPI_NOR_DmaHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+  OSPI_NOR_DmaHandle.Init.MemInc              = DMA_MINC_ENABLE;
+  OSPI_NOR_DmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  OSPI_NOR_DmaHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  OSPI_NOR_DmaHandle.Init.Mode                = DMA_NORMAL;
+  OSPI_NOR_DmaHandle.Init.Priority            = DMA_PRIORITY_HIGH;
+
+  HAL_DMA_DeInit(&OSPI_NOR_DmaHandle);
+  HAL_DMA_Init(&OSPI_NOR_DmaHandle);
+  __HAL_LINKDMA(&OSPINORHandle, hdma, OSPI_NOR_DmaHandle);
+}
+
+/**
+  * @brief  Sends a command to the OSPI memory, counted for
+  *         BSP_OSPI_NOR_GetCommandCount().
+  * @param  hospi: OSPI handle
+  * @param  cmd: structure that contains the command configuration
+  * @param  Timeout: Timeout duration
+  * @retval HAL status
+  * @note   The configuration of the memory-mapped mode is not a command on
+  *         the bus and is not counted.
+  */
+static HAL_StatusTypeDef OSPI_NOR_Command(OSPI_HandleTypeDef *hospi, OSPI_RegularCmdTypeDef *cmd, uint32_t Timeout)
+{
+  if (cmd->OperationType == HAL_OSPI_OPTYPE_COMMON_CFG)
+  {
+    OSPI_NOR_Commands++;
+  }
+
+  return HAL_OSPI_Command(hospi, cmd, Timeout);
+}
+
+/**
+  * @brief  De-Initializes the OSPI MSP.
+  * @retval None
+  */
+static void OSPI_NOR_MspDeInit(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct;
+  const OSPI_NOR_GpioTypeDef *gpio;
+
+  /* DMA channel of the page programming de-configuration */
+  HAL_DMA_DeInit(&OSPI_NOR_DmaHandle);
+
+  /* OctoSPI CLK, CS, D0-D7, DQS GPIO pins de-configuration  */
+  for (gpio = OSPI_NOR_Board.Gpio; gpio->Port != NULL; gpio++)
+  {
+    HAL_GPIO_DeInit(gpio->Port, gpio->Pins);
+  }
+
+  /* Set the CS pin in input, no pull (optimum default setting) */
+  GPIO_InitStruct.Mode      = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Pin       = OSPI_NOR_Board.CsPin;
+  GPIO_InitStruct.Pull      = GPIO_NOPULL;
+  GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(OSPI_NOR_Board.CsPort, &GPIO_InitStruct);
+
+  /* Set the idle pin of the board in no pull, low state (optimum default setting) */
+  GPIO_InitStruct.Mode      = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull      = GPIO_NOPULL;
+  GPIO_InitStruct.Pin       = OSPI_NOR_Board.IdleLowPin;
+  HAL_GPIO_Init(OSPI_NOR_Board.IdleLowPort, &GPIO_InitStruct);
+  HAL_GPIO_WritePin(OSPI_NOR_Board.IdleLowPort, OSPI_NOR_Board.IdleLowPin, GPIO_PIN_RESET);
+
+  if (OSPI_NOR_Board.Instance == OCTOSPI1)
+  {
+    /* Reset the OctoSPI memory interface */
+    __HAL_RCC_OSPI1_FORCE_RESET();
+    __HAL_RCC_OSPI1_RELEASE_RESET();
+
+    /* Disable the OctoSPI memory interface clock */
+    __HAL_RCC_OSPI1_CLK_DISABLE();
+  }
+  else
+  {
+    /* Reset the OctoSPI memory interface */
+    __HAL_RCC_OSPI2_FORCE_RESET();
+    __HAL_RCC_OSPI2_RELEASE_RESET();
+
+    /* Disable the OctoSPI memory interface clock */
+    __HAL_RCC_OSPI2_CLK_DISABLE();
+  }
+}
+
+/**
+  * @brief  This function reset the OSPI memory.
+  * @param  hospi: OSPI handle
+  * @retval None
+  */
+static uint8_t OSPI_NOR_ResetMemory(OSPI_HandleTypeDef *hospi)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+  OSPI_AutoPollingTypeDef sConfig;
+  uint32_t dtr;
+
+  /* Initialize the reset enable command */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = RESET_ENABLE_CMD;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_1_LINE;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_8_BITS;
+  sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_NONE;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_NONE;
+  sCommand.DummyCycles           = 0;
+  sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  /* Send the command */
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Send the reset memory command */
+  sCommand.Instruction = RESET_MEMORY_CMD;
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* The memory may be in octal STR or DTR mode, reset it in both */
+  sCommand.InstructionMode = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize = HAL_OSPI_INSTRUCTION_16_BITS;
+
+  for (dtr = 0; dtr < 2U; dtr++)
+  {
+    sCommand.InstructionDtrMode = (dtr == 0U) ? HAL_OSPI_INSTRUCTION_DTR_DISABLE : HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+
+    sCommand.Instruction = OSPI_NOR_OCTAL_RESET_ENABLE_CMD;
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    sCommand.Instruction = OSPI_NOR_OCTAL_RESET_MEMORY_CMD;
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+  }
+
+  /* Configure automatic polling mode to wait the memory is ready */
+  sCommand.Instruction        = READ_STATUS_REG_CMD;
+  sCommand.InstructionMode    = HAL_OSPI_INSTRUCTION_1_LINE;
+  sCommand.InstructionSize    = HAL_OSPI_INSTRUCTION_8_BITS;
+  sCommand.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.DataMode     = HAL_OSPI_DATA_1_LINE;
+  sCommand.NbData       = 1;
+  sCommand.DataDtrMode  = HAL_OSPI_DATA_DTR_DISABLE;
+
+  sConfig.Match         = 0;
+  sConfig.Mask          = MX25LM51245G_SR_WIP;
+  sConfig.MatchMode     = HAL_OSPI_MATCH_MODE_AND;
+  sConfig.Interval      = 0x10;
+  sConfig.AutomaticStop = HAL_OSPI_AUTOMATIC_STOP_ENABLE;
+
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  if (HAL_OSPI_AutoPolling(&OSPINORHandle, &sConfig, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function reads the SFDP of the OSPI memory, in SPI mode.
+  * @param  Address: address in the SFDP area
+  * @param  pData: pointer to data to be read
+  * @param  Size: size of data to read
+  * @retval SFDP status
+  */
+static uint8_t OSPI_NOR_ReadSFDP(uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+
+  /* Initialize the read SFDP command */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = SFDP_READ_CMD;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_1_LINE;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_8_BITS;
+  sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.Address               = Address;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_1_LINE;
+  sCommand.AddressSize           = HAL_OSPI_ADDRESS_24_BITS;
+  sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_1_LINE;
+  sCommand.NbData                = Size;
+  sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_DISABLE;
+  sCommand.DummyCycles           = SFDP_DUMMY_CYCLES;
+  sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  /* Configure the command */
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return SFDP_ERROR;
+  }
+
+  /* Reception of the data */
+  if (HAL_OSPI_Receive(&OSPINORHandle, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return SFDP_ERROR;
+  }
+
+  return SFDP_OK;
+}
+
+/**
+  * @brief  This function configures the driver from the SFDP of the memory,
+  *         read in SPI mode at the first call.
+  * @param  hospi: OSPI handle
+  * @retval OSPI memory status
+  * @note   The size, the page, the erase commands, the erase suspend and
+  *         the octal DTR support come from the SFDP, each one when the table
+  *         describes it. The octal mode entry, the read and program commands
+  *         are those of the MX25LM51245G: the Basic Flash Parameter Table has
+  *         no octal read or program instruction before the xSPI profile.
+  */
+static uint8_t OSPI_NOR_MemoryCfg(OSPI_HandleTypeDef *hospi)
+{
+  const SFDP_EraseTypeDef *erase;
+  const SFDP_EraseTypeDef *sector;
+
+  if (OSPI_NOR_SfdpStatus == 0xFF)
+  {
+    OSPI_NOR_SfdpStatus = SFDP_ReadInfo(OSPI_NOR_ReadSFDP, &OSPI_NOR_Sfdp);
+    if (OSPI_NOR_SfdpStatus == SFDP_ERROR)
+    {
+      OSPI_NOR_SfdpStatus = 0xFF;
+      return OSPI_NOR_ERROR;
+    }
+
+    if (OSPI_NOR_SfdpStatus == SFDP_OK)
+    {
+      /* The block and sector erases of the loader need these erase sizes */
+      erase  = SFDP_GetEraseType(&OSPI_NOR_Sfdp, MX25LM51245G_BLOCK_SIZE);
+      sector = SFDP_GetEraseType(&OSPI_NOR_Sfdp, MX25LM51245G_SECTOR_SIZE);
+      if ((erase == NULL) || (erase->Size != MX25LM51245G_BLOCK_SIZE) ||
+          (sector == NULL) || (sector->Size != MX25LM51245G_SECTOR_SIZE) ||
+          (OSPI_NOR_EraseCmd(erase) == 0U) || (OSPI_NOR_EraseCmd(sector) == 0U))
+      {
+        OSPI_NOR_SfdpStatus = 0xFF;
+        return OSPI_NOR_ERROR;
+      }
+      OSPI_NOR_BlockEraseCmd  = OSPI_NOR_EraseCmd(erase);
+      OSPI_NOR_SectorEraseCmd = OSPI_NOR_EraseCmd(sector);
+
+      OSPI_NOR_FlashSize = OSPI_NOR_Sfdp.FlashSize;
+      OSPI_NOR_PageSize  = OSPI_NOR_Sfdp.PageSize;
+
+      /* Erase suspend and resume, DWORD 12 and 13 (JESD216A) */
+      if (OSPI_NOR_Sfdp.Dwords >= 13U)
+      {
+        OSPI_NOR_EraseSuspendCmd = (OSPI_NOR_Sfdp.EraseSuspend != 0U) ?
+                                   OSPI_NOR_OCTAL_CMD(OSPI_NOR_Sfdp.EraseSuspend) : 0U;
+        OSPI_NOR_EraseResumeCmd  = OSPI_NOR_OCTAL_CMD(OSPI_NOR_Sfdp.EraseResume);
+      }
+
+      /* Octal DTR, DWORD 20 (JESD216C): tried by the calibration unless the
+         memory tells it has none */
+      if (OSPI_NOR_Sfdp.Dwords >= 20U)
+      {
+        OSPI_NOR_DtrSupported = OSPI_NOR_Sfdp.OctalDtr;
+      }
+
+      /* Known pattern of the calibration */
+      if (OSPI_NOR_ReadSFDP(0, OSPI_NOR_Pattern, OSPI_NOR_PATTERN_SIZE) != SFDP_OK)
+      {
+        OSPI_NOR_SfdpStatus = 0xFF;
+        return OSPI_NOR_ERROR;
+      }
+    }
+  }
+
+  /* Memory-mapped range of the memory */
+  hospi->Init.DeviceSize = POSITION_VAL(OSPI_NOR_FlashSize);
+  MODIFY_REG(hospi->Instance->DCR1, OCTOSPI_DCR1_DEVSIZE, (hospi->Init.DeviceSize << OCTOSPI_DCR1_DEVSIZE_Pos));
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function returns the octal command of an erase type of the
+  *         SFDP. The octal commands take a 4-byte address, the 3-byte
+  *         address instructions of the table are replaced by their 4-byte
+  *         address equivalent.
+  * @param  pErase: erase type
+  * @retval Octal command, 0 when the instruction has no 4-byte equivalent
+  */
+static uint32_t OSPI_NOR_EraseCmd(const SFDP_EraseTypeDef *pErase)
+{
+  switch (pErase->Instruction)
+  {
+    case 0x20U:                         /* 4 KB sector erase  */
+    case 0x21U:
+      return OSPI_NOR_OCTAL_CMD(0x21U);
+
+    case 0x52U:                         /* 32 KB block erase  */
+    case 0x5CU:
+      return OSPI_NOR_OCTAL_CMD(0x5CU);
+
+    case 0xD8U:                         /* 64 KB block erase  */
+    case 0xDCU:
+      return OSPI_NOR_OCTAL_CMD(0xDCU);
+
+    default:
+      return 0U;
+  }
+}
+
+/**
+  * @brief  This function configures the clock, the protocol and the sampling
+  *         of the OctoSPI. The memory must be in SPI mode.
+  * @param  hospi: OSPI handle
+  * @param  Prescaler: OctoSPI clock = SYSCLK / Prescaler
+  * @param  Dtr: 1 for octal DTR, 0 for octal STR
+  * @param  Sampling: OSPI_NOR_SAMPLING_x flags
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_SetTiming(OSPI_HandleTypeDef *hospi, uint32_t Prescaler, uint8_t Dtr, uint32_t Sampling)
+{
+  uint32_t clock, i;
+
+  hospi->Init.ClockPrescaler   = Prescaler;
+  /* Same chip select high time as at the board clock */
+  hospi->Init.ChipSelectHighTime = (2U * OSPI_NOR_Board.ClockPrescaler) / Prescaler;
+  hospi->Init.SampleShifting   = ((Sampling & OSPI_NOR_SAMPLING_SHIFT) != 0U) ?
+                                 HAL_OSPI_SAMPLE_SHIFTING_HALFCYCLE : HAL_OSPI_SAMPLE_SHIFTING_NONE;
+  hospi->Init.DelayBlockBypass = ((Sampling & OSPI_NOR_SAMPLING_BYPASS) != 0U) ?
+                                 HAL_OSPI_DELAY_BLOCK_BYPASSED : HAL_OSPI_DELAY_BLOCK_USED;
+  if (Dtr == 0U)
+  {
+    hospi->Init.MemoryType            = HAL_OSPI_MEMTYPE_MICRON;
+    hospi->Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_DISABLE;
+  }
+  else
+  {
+    hospi->Init.MemoryType            = HAL_OSPI_MEMTYPE_MACRONIX;
+    hospi->Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_ENABLE;
+  }
+
+  /* The HAL applies the configuration from the reset state only, the
+     OctoSPI IO Manager keeps its configuration */
+  if (HAL_OSPI_DeInit(hospi) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  if (HAL_OSPI_Init(hospi) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Fewest dummy cycles of the memory array reads at this clock */
+  clock = HAL_RCC_GetSysClockFreq() / Prescaler;
+  for (i = 0; (i < (sizeof(OSPI_NOR_Dummy) / sizeof(OSPI_NOR_Dummy[0])) - 1U) &&
+              (clock > OSPI_NOR_Dummy[i].MaxClock); i++)
+  {
+  }
+
+  OSPI_NOR_Dtr         = Dtr;
+  OSPI_NOR_DummyCycles = OSPI_NOR_Dummy[i].DummyCycles;
+  OSPI_NOR_DummyCfg    = OSPI_NOR_Dummy[i].DummyCfg;
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function reads the SFDP in octal mode and compares it with
+  *         the pattern read in SPI mode.
+  * @param  hospi: OSPI handle
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_CheckPattern(OSPI_HandleTypeDef *hospi)
+{
+  OSPI_RegularCmdTypeDef sCommand;
+  uint32_t i;
+
+  /* Initialize the read SFDP command */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = OSPI_NOR_OCTAL_READ_SFDP_CMD;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.Address               = 0;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_8_LINES;
+  sCommand.AddressSize           = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_8_LINES;
+  sCommand.NbData                = OSPI_NOR_PATTERN_SIZE;
+  sCommand.DummyCycles           = OSPI_NOR_OCTAL_SFDP_DUMMY_CYCLES;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_DISABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  }
+  else
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_ENABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_ENABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_ENABLE;
+  }
+
+  if (OSPI_NOR_Command(hospi, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Every bit of the buffer starts inverted: it matches only when the read
+     drove it to the pattern value, a short or stuck read never passes */
+  for (i = 0; i < OSPI_NOR_PATTERN_SIZE; i++)
+  {
+    OSPI_NOR_PatternRead[i] = (uint8_t)~OSPI_NOR_Pattern[i];
+  }
+
+  if (HAL_OSPI_Receive(hospi, OSPI_NOR_PatternRead, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  if (memcmp(OSPI_NOR_PatternRead, OSPI_NOR_Pattern, OSPI_NOR_PATTERN_SIZE) != 0)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function switches the memory to octal mode at one setting
+  *         and reads the SFDP pattern. When the read fails, the memory is
+  *         back in SPI mode at the board clock.
+  * @param  hospi: OSPI handle
+  * @param  Prescaler: OctoSPI clock = SYSCLK / Prescaler
+  * @param  Dtr: 1 for octal DTR, 0 for octal STR
+  * @param  Sampling: OSPI_NOR_SAMPLING_x flags
+  * @retval OSPI_NOR_OK when the pattern reads back, OSPI_NOR_BUSY when it
+  *         does not, OSPI_NOR_ERROR when the OctoSPI fails
+  */
+static uint8_t OSPI_NOR_TrySetting(OSPI_HandleTypeDef *hospi, uint32_t Prescaler, uint8_t Dtr, uint32_t Sampling)
+{
+  if (OSPI_NOR_SetTiming(hospi, Prescaler, Dtr, Sampling) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  if ((OSPI_NOR_OctalMode(hospi, OSPI_NOR_OCTAL_ENABLE) == OSPI_NOR_OK) &&
+      (OSPI_NOR_CheckPattern(hospi) == OSPI_NOR_OK))
+  {
+    return OSPI_NOR_OK;
+  }
+
+  /* Back to SPI mode at the board clock for the next setting */
+  if ((OSPI_NOR_SetTiming(hospi, OSPI_NOR_Board.ClockPrescaler, 0, 0) != OSPI_NOR_OK) ||
+      (OSPI_NOR_ResetMemory(hospi) != OSPI_NOR_OK))
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_BUSY;
+}
+
+/**
+  * @brief  This function switches the memory to octal mode at the fastest
+  *         OctoSPI clock passing the read of the SFDP pattern, octal DTR
+  *         first when the board supports it, then octal STR. At each setting
+  *         the delay block is used then bypassed, and in STR the sampling
+  *         is shifted by half a cycle. The memory must be in SPI mode.
+  * @param  hospi: OSPI handle
+  * @retval OSPI memory status
+  * @note   The clocks above the OctoSPI limit of the MCU are not tried. The
+  *         first passing setting has no margin: the clock is one prescaler
+  *         step slower, down to the board clock, and checked again.
+  *         The sweep covers the OSPI_NOR_SAMPLINGS settings only, not the
+  *         taps of the delay block.
+  */
+static uint8_t OSPI_NOR_Calibrate(OSPI_HandleTypeDef *hospi)
+{
+  uint32_t prescaler, sampling, sysclk, limit;
+  uint8_t  dtr, status;
+
+  /* Without SFDP there is no pattern, the board settings are used as is */
+  if (OSPI_NOR_SfdpStatus == SFDP_OK)
+  {
+    sysclk = HAL_RCC_GetSysClockFreq();
+
+    for (prescaler = 1; prescaler <= OSPI_NOR_Board.ClockPrescaler; prescaler++)
+    {
+      for (dtr = (OSPI_NOR_Board.Dtr & OSPI_NOR_DtrSupported) + 1U; dtr != 0U; dtr--)
+      {
+        limit = ((dtr - 1U) != 0U) ? OSPI_NOR_MAX_CLOCK_DTR : OSPI_NOR_MAX_CLOCK_STR;
+        if ((sysclk / prescaler) > limit)
+        {
+          continue;
+        }
+
+        for (sampling = 0; sampling < OSPI_NOR_SAMPLINGS; sampling++)
+        {
+          /* The sample shifting is not allowed in DTR */
+          if (((dtr - 1U) != 0U) && ((sampling & OSPI_NOR_SAMPLING_SHIFT) != 0U))
+          {
+            continue;
+          }
+
+          status = OSPI_NOR_TrySetting(hospi, prescaler, dtr - 1U, sampling);
+          if ((status == OSPI_NOR_OK) && (prescaler < OSPI_NOR_Board.ClockPrescaler))
+          {
+            /* Margin: the next slower clock, from SPI mode */
+            if ((OSPI_NOR_SetTiming(hospi, OSPI_NOR_Board.ClockPrescaler, 0, 0) != OSPI_NOR_OK) ||
+                (OSPI_NOR_ResetMemory(hospi) != OSPI_NOR_OK))
+            {
+              return OSPI_NOR_ERROR;
+            }
+            status = OSPI_NOR_TrySetting(hospi, prescaler + 1U, dtr - 1U, sampling);
+          }
+
+          if (status != OSPI_NOR_BUSY)
+          {
+            return status;
+          }
+        }
+      }
+    }
+  }
+
+  /* Board settings, without check */
+  if (OSPI_NOR_SetTiming(hospi, OSPI_NOR_Board.ClockPrescaler, OSPI_NOR_Board.Dtr & OSPI_NOR_DtrSupported, 0) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OctalMode(hospi, OSPI_NOR_OCTAL_ENABLE);
+}
+
+/**
+  * @brief  This function send a Write Enable and wait it is effective.
+  * @param  hospi: OSPI handle
+  * @retval None
+  */
+static uint8_t OSPI_NOR_WriteEnable(OSPI_HandleTypeDef *hospi)
+{
+  OSPI_RegularCmdTypeDef  sCommand;
+  OSPI_AutoPollingTypeDef sConfig;
+  uint8_t reg[2];
+  uint32_t tickstart;
+
+  /* Enable write operations */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = OCTAL_WRITE_ENABLE_CMD;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_NONE;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_NONE;
+  sCommand.DummyCycles           = 0;
+  sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  }
+  else
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+  }
+
+  if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Configure automatic polling mode to wait for write enabling */
+  sConfig.Match           = MX25LM51245G_SR_WEL;
+  sConfig.Mask            = MX25LM51245G_SR_WEL;
+
+  sCommand.Instruction    = OCTAL_READ_STATUS_REG_CMD;
+  sCommand.Address        = 0x0;
+  sCommand.AddressMode    = HAL_OSPI_ADDRESS_8_LINES;
+  sCommand.AddressSize    = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.DataMode       = HAL_OSPI_DATA_8_LINES;
+  sCommand.NbData         = 2;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.AddressDtrMode = HAL_OSPI_ADDRESS_DTR_DISABLE;
+    sCommand.DataDtrMode    = HAL_OSPI_DATA_DTR_DISABLE;
+    sCommand.DQSMode        = HAL_OSPI_DQS_DISABLE;
+    sCommand.DummyCycles    = DUMMY_CYCLES_READ_OCTAL;
+  }
+  else
+  {
+    sCommand.AddressDtrMode = HAL_OSPI_ADDRESS_DTR_ENABLE;
+    sCommand.DataDtrMode    = HAL_OSPI_DATA_DTR_ENABLE;
+    sCommand.DQSMode        = HAL_OSPI_DQS_ENABLE;
+    sCommand.DummyCycles    = 4;
+  }
+
+  /* Status register read until the write enable latch is set, for at
+     most HAL_OSPI_TIMEOUT_DEFAULT_VALUE */
+  tickstart = HAL_GetTick();
+  do
+  {
+    if ((HAL_GetTick() - tickstart) > HAL_OSPI_TIMEOUT_DEFAULT_VALUE)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (HAL_OSPI_Receive(&OSPINORHandle, reg, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+  }while((reg[0] & sConfig.Mask ) != sConfig.Match);
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function waits for the end of the last page program of
+  *         BSP_OSPI_NOR_Write, left running when it returned.
+  * @param  hospi: OSPI handle
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_ProgramWait(OSPI_HandleTypeDef *hospi)
+{
+  if (OSPI_NOR_ProgramPending == 0U)
+  {
+    return OSPI_NOR_OK;
+  }
+
+  OSPI_NOR_ProgramPending = 0;
+
+  return OSPI_NOR_AutoPollingMemReady(hospi, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+}
+
+/**
+  * @brief  This function read the SR of the memory and wait the EOP.
+  * @param  hospi: OSPI handle
+  * @param  Timeout: Timeout for auto-polling
+  * @retval None
+  */
+static uint8_t OSPI_NOR_AutoPollingMemReady(OSPI_HandleTypeDef *hospi, uint32_t Timeout)
+{
+  OSPI_RegularCmdTypeDef  sCommand;
+  OSPI_AutoPollingTypeDef sConfig;
+
+  /* Configure automatic polling mode to wait for memory ready */
+  sCommand.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId               = HAL_OSPI_FLASH_ID_1;
+  sCommand.Instruction           = OCTAL_READ_STATUS_REG_CMD;
+  sCommand.InstructionMode       = HAL_OSPI_INSTRUCTION_8_LINES;
+  sCommand.InstructionSize       = HAL_OSPI_INSTRUCTION_16_BITS;
+  sCommand.Address               = 0;
+  sCommand.AddressMode           = HAL_OSPI_ADDRESS_8_LINES;
+  sCommand.AddressSize           = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode              = HAL_OSPI_DATA_8_LINES;
+  sCommand.NbData                = 2;
+  sCommand.DummyCycles           = DUMMY_CYCLES_READ_OCTAL;
+  sCommand.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (OSPI_NOR_Dtr == 0U)
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_DISABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_DISABLE;
+  }
+  else
+  {
+    sCommand.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    sCommand.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_ENABLE;
+    sCommand.DataDtrMode           = HAL_OSPI_DATA_DTR_ENABLE;
+    sCommand.DQSMode               = HAL_OSPI_DQS_ENABLE;
+  }
+
+  sConfig.Match           = 0;
+  sConfig.Mask            = MX25LM51245G_SR_WIP;
+  sConfig.MatchMode       = HAL_OSPI_MATCH_MODE_AND;
+  sConfig.Interval        = MEM_READY_POLLING_INTERVAL;
+  sConfig.AutomaticStop   = HAL_OSPI_AUTOMATIC_STOP_ENABLE;
+
+  if (OSPI_NOR_Command(hospi, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  if (HAL_OSPI_AutoPolling_IT(hospi, &sConfig) != HAL_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Sleep until the memory is ready */
+  return OSPI_NOR_WaitForFlag(hospi, HAL_OSPI_FLAG_SM, Timeout);
+}
+
+/**
+  * @brief  Sleeps until the automatic polling running on the OSPI matches,
+  *         or until the DMA transfer running on the OSPI completes.
+  * @param  hospi: OSPI handle
+  * @param  Flag: HAL_OSPI_FLAG_SM for the match, HAL_OSPI_FLAG_TC for the
+  *         end of the transfer
+  * @param  Timeout: Timeout for the flag, in ms
+  * @retval OSPI memory status
+  * @note   The OSPI and DMA interrupts, as well as the TIM6 update used as
+  *         time reference, stay disabled in the NVIC: they only wake the
+  *         core up from WFE (SEVONPEND), no handler runs.
+  *         The measured wait is returned by BSP_OSPI_NOR_GetWaitTime().
+  */
+static uint8_t OSPI_NOR_WaitForFlag(OSPI_HandleTypeDef *hospi, uint32_t Flag, uint32_t Timeout)
+{
+  uint32_t overflow = 0;
+  uint32_t elapsed  = 0;
+  uint32_t period;
+
+  /* TIM6 free running at 1 MHz, updates every 65.536 ms, or when the
+     timeout expires for a shorter wait */
+  period = (Timeout < 64U) ? ((Timeout + 1U) * 1000U) : 0x10000U;
+  __HAL_RCC_TIM6_CLK_ENABLE();
+  TIM6->CR1  = 0;
+  TIM6->PSC  = (Tick_TimerClock() / 1000000U) - 1U;
+  TIM6->ARR  = period - 1U;
+  TIM6->EGR  = TIM_EGR_UG;
+  TIM6->SR   = 0;
+  TIM6->DIER = TIM_DIER_UIE;
+  TIM6->CR1  = TIM_CR1_CEN;
+
+  NVIC_DisableIRQ(OSPI_NOR_IRQn);
+  NVIC_DisableIRQ(OSPI_NOR_DMA_IRQn);
+  NVIC_DisableIRQ(TIM6_DAC_IRQn);
+  SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+
+  while ((__HAL_OSPI_GET_FLAG(hospi, Flag) == RESET) && (__HAL_OSPI_GET_FLAG(hospi, HAL_OSPI_FLAG_TE) == RESET))
+  {
+    if ((TIM6->SR & TIM_SR_UIF) != 0U)
+    {
+      TIM6->SR = 0;
+      overflow++;
+    }
+
+    elapsed = (overflow * period) + TIM6->CNT;
+    if ((elapsed / 1000U) > Timeout)
+    {
+      break;
+    }
+
+    /* A flag raised after the test pends its interrupt, which sets the
+       event register: WFE returns immediately in that case */
+    NVIC_ClearPendingIRQ(OSPI_NOR_IRQn);
+    NVIC_ClearPendingIRQ(OSPI_NOR_DMA_IRQn);
+    NVIC_ClearPendingIRQ(TIM6_DAC_IRQn);
+    __WFE();
+  }
+
+  TIM6->CR1  = 0;
+  TIM6->DIER = 0;
+  TIM6->SR   = 0;
+  NVIC_ClearPendingIRQ(OSPI_NOR_IRQn);
+  NVIC_ClearPendingIRQ(OSPI_NOR_DMA_IRQn);
+  NVIC_ClearPendingIRQ(TIM6_DAC_IRQn);
+
+  OSPI_NOR_WaitTime = (overflow * period) + TIM6->CNT;
+
+  if ((__HAL_OSPI_GET_FLAG(hospi, Flag) == RESET) || (__HAL_OSPI_GET_FLAG(hospi, HAL_OSPI_FLAG_TE) != RESET))
+  {
+    /* Timeout or transfer error: stop the automatic polling or the transfer */
+    HAL_OSPI_Abort(hospi);
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Let the HAL acknowledge the DMA half and full transfers, which hands
+     the end of the transfer over to the OSPI */
+  if (READ_BIT(hospi->Instance->CR, OCTOSPI_CR_DMAEN) != 0U)
+  {
+    while (HAL_DMA_GetState(hospi->hdma) == HAL_DMA_STATE_BUSY)
+    {
+      HAL_DMA_IRQHandler(hospi->hdma);
+    }
+  }
+
+  /* Let the HAL acknowledge the flag and release the handle */
+  HAL_OSPI_IRQHandler(hospi);
+
+  if (hospi->ErrorCode != HAL_OSPI_ERROR_NONE)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function enables/disables the octal mode of the memory.
+  * @param  hospi: OSPI handle
+  * @param  Operation: Octal operation mode enable/disable
+  * @retval None
+  */
+static uint8_t OSPI_NOR_OctalMode(OSPI_HandleTypeDef *hospi, uint8_t Operation)
+{
+  OSPI_RegularCmdTypeDef  sCommand;
+  OSPI_AutoPollingTypeDef sConfig;
+  uint8_t reg[2];
+
+  sCommand.OperationType      = HAL_OSPI_OPTYPE_COMMON_CFG;
+  sCommand.FlashId            = HAL_OSPI_FLASH_ID_1;
+  sCommand.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.AddressSize        = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_DISABLE;
+  sCommand.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataDtrMode        = HAL_OSPI_DATA_DTR_DISABLE;
+  sCommand.DQSMode            = HAL_OSPI_DQS_DISABLE;
+  sCommand.SIOOMode           = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  sConfig.MatchMode     = HAL_OSPI_MATCH_MODE_AND;
+  sConfig.Interval      = 0x10;
+  sConfig.AutomaticStop = HAL_OSPI_AUTOMATIC_STOP_ENABLE;
+
+  /* Activate/deactivate the Octal mode */
+  if (Operation == OSPI_NOR_OCTAL_ENABLE)
+  {
+    /* Enable write operations */
+    sCommand.Instruction     = WRITE_ENABLE_CMD;
+    sCommand.InstructionMode = HAL_OSPI_INSTRUCTION_1_LINE;
+    sCommand.InstructionSize = HAL_OSPI_INSTRUCTION_8_BITS;
+    sCommand.AddressMode     = HAL_OSPI_ADDRESS_NONE;
+    sCommand.DataMode        = HAL_OSPI_DATA_NONE;
+    sCommand.DummyCycles     = 0;
+
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Configure automatic polling mode to wait for write enabling */
+    sConfig.Match = MX25LM51245G_SR_WEL;
+    sConfig.Mask  = MX25LM51245G_SR_WEL;
+
+    sCommand.Instruction = READ_STATUS_REG_CMD;
+    sCommand.DataMode    = HAL_OSPI_DATA_1_LINE;
+    sCommand.NbData      = 1;
+
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (HAL_OSPI_AutoPolling(&OSPINORHandle, &sConfig, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Write Configuration register 2 (with new dummy cycles) */
+    sCommand.Instruction = WRITE_CFG_REG_2_CMD;
+    sCommand.Address     = MX25LM51245G_CR2_REG3_ADDR;
+    sCommand.AddressMode = HAL_OSPI_ADDRESS_1_LINE;
+    reg[0] = OSPI_NOR_DummyCfg;
+
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (HAL_OSPI_Transmit(&OSPINORHandle, reg, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Enable write operations */
+    sCommand.Instruction = WRITE_ENABLE_CMD;
+    sCommand.AddressMode = HAL_OSPI_ADDRESS_NONE;
+    sCommand.DataMode    = HAL_OSPI_DATA_NONE;
+
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Configure automatic polling mode to wait for write enabling */
+    sCommand.Instruction = READ_STATUS_REG_CMD;
+    sCommand.DataMode    = HAL_OSPI_DATA_1_LINE;
+
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (HAL_OSPI_AutoPolling(&OSPINORHandle, &sConfig, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Write Configuration register 2 (with Octal I/O SPI protocol) */
+    sCommand.Instruction = WRITE_CFG_REG_2_CMD;
+    sCommand.Address     = MX25LM51245G_CR2_REG1_ADDR;
+    sCommand.AddressMode = HAL_OSPI_ADDRESS_1_LINE;
+    reg[0] = (OSPI_NOR_Dtr != 0U) ? MX25LM51245G_CR2_DOPI : MX25LM51245G_CR2_SOPI;
+
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (HAL_OSPI_Transmit(&OSPINORHandle, reg, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Wait that the configuration is effective: the memory is busy for
+       up to MX25LM51245G_WRITE_REG_MAX_TIME */
+    if (OSPI_NOR_AutoPollingMemReady(&OSPINORHandle, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != OSPI_NOR_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Check the configuration has been correctly done */
+    sCommand.Instruction     = OCTAL_READ_CFG_REG_2_CMD;
+    sCommand.InstructionMode = HAL_OSPI_INSTRUCTION_8_LINES;
+    sCommand.InstructionSize = HAL_OSPI_INSTRUCTION_16_BITS;
+    sCommand.AddressMode     = HAL_OSPI_ADDRESS_8_LINES;
+    sCommand.DataMode        = HAL_OSPI_DATA_8_LINES;
+    sCommand.DummyCycles     = DUMMY_CYCLES_READ_OCTAL;
+    sCommand.NbData          = 2;
+    reg[0] = 0;
+
+    if (OSPI_NOR_Dtr != 0U)
+    {
+      sCommand.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+      sCommand.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_ENABLE;
+      sCommand.DataDtrMode        = HAL_OSPI_DATA_DTR_ENABLE;
+      sCommand.DQSMode            = HAL_OSPI_DQS_ENABLE;
+    }
+
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (HAL_OSPI_Receive(&OSPINORHandle, reg, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (reg[0] != ((OSPI_NOR_Dtr != 0U) ? MX25LM51245G_CR2_DOPI : MX25LM51245G_CR2_SOPI))
+    {
+      return OSPI_NOR_ERROR;
+    }
+  }
+  else
+  {
+    /* Enable write operations */
+    if (OSPI_NOR_WriteEnable(&OSPINORHandle) != OSPI_NOR_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Write Configuration register 2 (with Octal I/O SPI protocol) */
+    sCommand.Instruction     = OCTAL_WRITE_CFG_REG_2_CMD;
+    sCommand.InstructionMode = HAL_OSPI_INSTRUCTION_8_LINES;
+    sCommand.InstructionSize = HAL_OSPI_INSTRUCTION_16_BITS;
+    sCommand.Address         = MX25LM51245G_CR2_REG1_ADDR;
+    sCommand.AddressMode     = HAL_OSPI_ADDRESS_8_LINES;
+    sCommand.DataMode        = HAL_OSPI_DATA_8_LINES;
+    sCommand.NbData          = 2;
+    sCommand.DummyCycles     = 0;
+    reg[0] = 0;
+    reg[1] = 0;
+
+    if (OSPI_NOR_Dtr != 0U)
+    {
+      sCommand.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+      sCommand.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_ENABLE;
+      sCommand.DataDtrMode        = HAL_OSPI_DATA_DTR_ENABLE;
+    }
+
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (HAL_OSPI_Transmit(&OSPINORHandle, reg, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Wait that the configuration is effective: the memory is busy for
+       up to MX25LM51245G_WRITE_REG_MAX_TIME, polled in SPI mode */
+    sCommand.Instruction     = READ_STATUS_REG_CMD;
+    sCommand.InstructionMode = HAL_OSPI_INSTRUCTION_1_LINE;
+    sCommand.InstructionSize = HAL_OSPI_INSTRUCTION_8_BITS;
+    sCommand.AddressMode     = HAL_OSPI_ADDRESS_NONE;
+    sCommand.DataMode        = HAL_OSPI_DATA_1_LINE;
+    sCommand.NbData          = 1;
+    sCommand.DummyCycles     = 0;
+
+    if (OSPI_NOR_Dtr != 0U)
+    {
+      sCommand.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+      sCommand.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_DISABLE;
+      sCommand.DataDtrMode        = HAL_OSPI_DATA_DTR_DISABLE;
+    }
+
+    sConfig.Match = 0;
+    sConfig.Mask  = MX25LM51245G_SR_WIP;
+
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (HAL_OSPI_AutoPolling(&OSPINORHandle, &sConfig, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Check the configuration has been correctly done */
+    sCommand.Instruction = READ_CFG_REG_2_CMD;
+    sCommand.Address     = MX25LM51245G_CR2_REG1_ADDR;
+    sCommand.AddressMode = HAL_OSPI_ADDRESS_1_LINE;
+
+    if (OSPI_NOR_Command(&OSPINORHandle, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (HAL_OSPI_Receive(&OSPINORHandle, reg, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    if (reg[0] != 0)
+    {
+      return OSPI_NOR_ERROR;
+    }
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* !OSPI_NOR_LEAN */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+
@@ -0,0 +1,1203 @@
+/**
+  ******************************************************************************
+  * @file    stm32l4xx_ospi_nor_lean.c
+  * @author  MCD Application Team
+  * @brief   This file includes a register-level driver for the MX25LM51245G
+  *          OSPI memory mounted on the STM32L4R9I-DK, STM32L4P5G-DK and
+  *          STM32L4R9I-EVAL boards, limited to the commands of the loaders.
+  @verbatim
+  ==============================================================================
+                     ##### How to use this driver #####
+  ==============================================================================
+  [..]
+   (#) This driver replaces stm32l4xx_ospi_nor.c when OSPI_NOR_LEAN is
+       defined, by the *_Lean targets of the OSPI projects or in
+       STM32L4OSPI.h. It drives the OctoSPI, the OctoSPI IO Manager and the
+       GPIOs through their registers: the *_Lean targets leave the HAL OSPI
+       and DMA drivers, the SFDP parser and stm32l4xx_ospi_nor.c out of the
+       build. The size of their FLM against the HAL build is not measured
+       yet, the pack does not list them.
+
+   (#) The board settings of OSPI_NOR_Board are used as is: the OctoSPI
+       clock and the octal DTR/STR protocol are not calibrated, and the size
+       and the page of the memory are those of the MX25LM51245G, not read
+       from its SFDP. The pages are written to the OctoSPI FIFO by the core.
+
+   (#) The OctoSPI IO Manager port ClkPort of the board carries all the
+       signals of the OctoSPI instance, the other port those of the other
+       instance.
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "STM32L4OSPI.h"
+#include "STM32L4Tick.h"
+
+#if defined OSPI_NOR_LEAN
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32L4_OSPI_Boards
+  * @{
+  */
+
+/** @defgroup STM32L4_OSPI_NOR_Lean STM32L4 OSPI NOR Lean
+  * @{
+  */
+
+/* Private constants --------------------------------------------------------*/
+/** @defgroup STM32L4_OSPI_NOR_Lean_Private_Constants Private Constants
+  * @{
+  */
+#define OSPI_NOR_IRQn               ((OSPI_NOR_Board.Instance == OCTOSPI1) ? OCTOSPI1_IRQn : OCTOSPI2_IRQn)
+
+#define OSPI_NOR_CMD_TIMEOUT        10U    /* ms, command or page transfer  */
+#define OSPI_NOR_FIFO_THRESHOLD     4U     /* bytes, one word of the FIFO   */
+#define OSPI_NOR_CS_HIGH_TIME       2U     /* OctoSPI clock cycles          */
+#define MEM_READY_POLLING_INTERVAL  0x80   /* OctoSPI clock cycles between status reads */
+#define SPI_POLLING_INTERVAL        0x10
+
+/* Dummy cycles of the octal register reads */
+#define DUMMY_CYCLES_READ_OCTAL     MX25LM51245G_DUMMY_CYCLES_READ_OCTAL_66M
+#define DUMMY_CYCLES_WEL_DTR        4U
+
+/* Octal commands not defined by the component */
+#define OSPI_NOR_OCTAL_RESET_ENABLE_CMD  0x6699
+#define OSPI_NOR_OCTAL_RESET_MEMORY_CMD  0x9966
+
+/* Phases of a command after the instruction */
+#define OSPI_NOR_ADDRESS            0x1U
+#define OSPI_NOR_DATA               0x2U
+#define OSPI_NOR_DQS                0x4U   /* data strobe, in DTR only      */
+
+/* Functional modes, CR register */
+#define OSPI_NOR_INDIRECT_WRITE     0x0U
+#define OSPI_NOR_INDIRECT_READ      OCTOSPI_CR_FMODE_0
+#define OSPI_NOR_AUTO_POLLING       OCTOSPI_CR_FMODE_1
+#define OSPI_NOR_MEMORY_MAPPED      OCTOSPI_CR_FMODE
+
+/* SPI commands, 8-bit instruction on 1 line */
+#define OSPI_NOR_SPI_CMD            OCTOSPI_CCR_IMODE_0
+#define OSPI_NOR_SPI_READ           (OCTOSPI_CCR_IMODE_0 | OCTOSPI_CCR_DMODE_0)
+#define OSPI_NOR_SPI_WRITE_REG      (OCTOSPI_CCR_IMODE_0 | OCTOSPI_CCR_ADMODE_0 | OCTOSPI_CCR_ADSIZE | OCTOSPI_CCR_DMODE_0)
+
+/* GPIO modes, MODER register */
+#define OSPI_NOR_GPIO_INPUT         0x0U
+#define OSPI_NOR_GPIO_OUTPUT        0x1U
+#define OSPI_NOR_GPIO_AF            0x2U
+#define OSPI_NOR_GPIO_ANALOG        0x3U
+#define OSPI_NOR_GPIO_VERY_HIGH     0x3U
+
+/* OctoSPI IO Manager port carrying CLK, DQS, NCS and IO[7:0] of OCTOSPI1
+   or OCTOSPI2, the reset values of PCR1 and PCR2 */
+#define OSPI_NOR_OSPIM_PORT_OSPI1   0x03010111U
+#define OSPI_NOR_OSPIM_PORT_OSPI2   0x07050333U
+/**
+  * @}
+  */
+
+/* Private types -------------------------------------------------------------*/
+
+/* Dummy cycles of the memory array reads, up to an OctoSPI clock */
+typedef struct
+{
+  uint32_t MaxClock;          /* Hz                                 */
+  uint8_t  DummyCycles;
+  uint8_t  DummyCfg;          /* DC field of the CR2 register 0x300 */
+} OSPI_NOR_DummyTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+
+/** @defgroup STM32L4_OSPI_NOR_Lean_Private_Variables Private Variables
+  * @{
+  */
+
+/* Time spent waiting for the memory by the last operation, in us */
+static uint32_t OSPI_NOR_WaitTime = 0;
+
+/* Commands sent to the memory since the algorithm was loaded */
+static uint32_t OSPI_NOR_Commands = 0;
+
+/* Protocol of the memory, 0 in SPI and octal STR, and read dummy cycles */
+static uint8_t  OSPI_NOR_Dtr         = 0;
+static uint32_t OSPI_NOR_DummyCycles = MX25LM51245G_DUMMY_CYCLES_READ_OCTAL_66M;
+static uint8_t  OSPI_NOR_DummyCfg    = MX25LM51245G_CR2_DC_66M;
+
+/* MX25LM51245G data sheet, octal STR and DTR */
+static const OSPI_NOR_DummyTypeDef OSPI_NOR_Dummy[] =
+{
+  {  66000000U,  6U, 0x07U },
+  {  84000000U,  8U, 0x06U },
+  { 104000000U, 10U, 0x05U },
+  { 133000000U, 12U, 0x04U },
+  { 200000000U, 20U, 0x00U },
+};
+
+/**
+  * @}
+  */
+
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup STM32L4_OSPI_NOR_Lean_Private_Functions Private Functions
+  * @{
+  */
+static void     OSPI_NOR_GpioInit          (GPIO_TypeDef *Port, uint32_t Pins, uint32_t Mode,
+                                            uint32_t Pull, uint32_t Alternate);
+static void     OSPI_NOR_MspInit           (void);
+static void     OSPI_NOR_MspDeInit         (void);
+static uint8_t  OSPI_NOR_WaitReg           (__IO uint32_t *Reg, uint32_t Mask, uint32_t Value);
+static uint8_t  OSPI_NOR_Abort             (void);
+static uint32_t OSPI_NOR_OctalCcr          (uint32_t Phases);
+static uint8_t  OSPI_NOR_Command           (uint32_t Mode, uint32_t Ccr, uint32_t Instruction,
+                                            uint32_t Address, uint32_t DummyCycles, uint32_t Size);
+static uint8_t  OSPI_NOR_Transmit          (const uint8_t *pData, uint32_t Size);
+static uint8_t  OSPI_NOR_Receive           (uint8_t *pData, uint32_t Size);
+static uint8_t  OSPI_NOR_AutoPolling       (uint32_t Ccr, uint32_t Instruction, uint32_t DummyCycles,
+                                            uint32_t Size, uint32_t Mask, uint32_t Match,
+                                            uint32_t Interval, uint32_t Timeout);
+static uint8_t  OSPI_NOR_ResetMemory       (void);
+static uint8_t  OSPI_NOR_WriteEnable       (void);
+static uint8_t  OSPI_NOR_AutoPollingMemReady(uint32_t Timeout);
+static uint8_t  OSPI_NOR_WaitForFlag       (uint32_t Flag, uint32_t Timeout);
+static uint8_t  OSPI_NOR_OctalEnable       (void);
+static uint8_t  OSPI_NOR_OctalDisable      (void);
+/**
+  * @}
+  */
+
+/* Exported functions ---------------------------------------------------------*/
+
+/** @addtogroup STM32L4_OSPI_NOR_Lean_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initializes the OSPI interface.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_Init(void)
+{
+  OCTOSPI_TypeDef *ospi = OSPI_NOR_Board.Instance;
+  uint32_t clock, i;
+
+  /* System level initialization, the OctoSPI is reset */
+  OSPI_NOR_MspInit();
+
+  /* OctoSPI initialization, at the clock and in the protocol of the board */
+  ospi->DCR1 = ((POSITION_VAL(MX25LM51245G_FLASH_SIZE) - 1U) << OCTOSPI_DCR1_DEVSIZE_Pos) |
+               ((OSPI_NOR_CS_HIGH_TIME - 1U) << OCTOSPI_DCR1_CSHT_Pos) |
+               ((OSPI_NOR_Board.Dtr != 0U) ? OCTOSPI_DCR1_MTYP_0 : 0U);   /* Macronix or Micron */
+  ospi->DCR2 = (OSPI_NOR_Board.ClockPrescaler - 1U) << OCTOSPI_DCR2_PRESCALER_Pos;
+  ospi->DCR3 = 0;
+  ospi->DCR4 = 0;
+  ospi->TCR  = (OSPI_NOR_Board.Dtr != 0U) ? OCTOSPI_TCR_DHQC : 0U;
+  ospi->CR   = ((OSPI_NOR_FIFO_THRESHOLD - 1U) << OCTOSPI_CR_FTHRES_Pos) | OCTOSPI_CR_EN;
+
+  /* Fewest dummy cycles of the memory array reads at this clock */
+  clock = SystemCoreClock / OSPI_NOR_Board.ClockPrescaler;
+  for (i = 0; (i < (sizeof(OSPI_NOR_Dummy) / sizeof(OSPI_NOR_Dummy[0])) - 1U) &&
+              (clock > OSPI_NOR_Dummy[i].MaxClock); i++)
+  {
+  }
+
+  OSPI_NOR_Dtr         = 0;
+  OSPI_NOR_DummyCycles = OSPI_NOR_Dummy[i].DummyCycles;
+  OSPI_NOR_DummyCfg    = OSPI_NOR_Dummy[i].DummyCfg;
+
+  /* OctoSPI memory reset, back to SPI mode */
+  if (OSPI_NOR_ResetMemory() != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_NOT_SUPPORTED;
+  }
+
+  /* OctoSPI octal enable */
+  if (OSPI_NOR_OctalEnable() != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  De-Initializes the OSPI interface.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_DeInit(void)
+{
+  OCTOSPI_TypeDef *ospi = OSPI_NOR_Board.Instance;
+  uint32_t enable = (ospi == OCTOSPI1) ? RCC_AHB3ENR_OSPI1EN : RCC_AHB3ENR_OSPI2EN;
+
+  /* Nothing to do before the first initialization */
+  if ((READ_BIT(RCC->AHB3ENR, enable) == 0U) || (READ_BIT(ospi->CR, OCTOSPI_CR_EN) == 0U))
+  {
+    return OSPI_NOR_OK;
+  }
+
+  /* Abort any activity on OctoSPI (eg Memory-mapped mode) */
+  if (OSPI_NOR_Abort() != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* OctoSPI octal mode disable */
+  if (OSPI_NOR_OctalDisable() != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* System level De-initialization */
+  OSPI_NOR_MspDeInit();
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Writes an amount of data to the OSPI memory.
+  * @param  pData: Pointer to data to be written
+  * @param  WriteAddr: Write start address
+  * @param  Size: Size of data to write
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_Write(uint8_t* pData, uint32_t WriteAddr, uint32_t Size)
+{
+  uint32_t end_addr, current_size, current_addr;
+  uint32_t ccr = OSPI_NOR_OctalCcr(OSPI_NOR_ADDRESS | OSPI_NOR_DATA | OSPI_NOR_DQS);
+
+  /* Calculation of the size between the write address and the end of the page */
+  current_size = MX25LM51245G_PAGE_SIZE - (WriteAddr % MX25LM51245G_PAGE_SIZE);
+
+  /* Check if the size of the data is less than the remaining place in the page */
+  if (current_size > Size)
+  {
+    current_size = Size;
+  }
+
+  /* Initialize the adress variables */
+  current_addr = WriteAddr;
+  end_addr = WriteAddr + Size;
+
+  /* Perform the write page by page */
+  do
+  {
+    /* Enable write operations */
+    if (OSPI_NOR_WriteEnable() != OSPI_NOR_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* The page program starts with the first write to the FIFO */
+    if ((OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, ccr, OCTAL_PAGE_PROG_CMD, current_addr, 0, current_size) != OSPI_NOR_OK) ||
+        (OSPI_NOR_Transmit(pData, current_size) != OSPI_NOR_OK))
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Configure automatic polling mode to wait for end of program */
+    if (OSPI_NOR_AutoPollingMemReady(HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != OSPI_NOR_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+
+    /* Update the address and size variables for next page programming */
+    current_addr += current_size;
+    pData += current_size;
+    current_size = ((current_addr + MX25LM51245G_PAGE_SIZE) > end_addr) ? (end_addr - current_addr) : MX25LM51245G_PAGE_SIZE;
+  } while (current_addr < end_addr);
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Starts the erase of the specified block of the OSPI memory.
+  * @param  BlockAddress: Block address to erase
+  * @retval OSPI memory status
+  * @note   The erase runs when the function returns, it can be suspended.
+  */
+uint8_t BSP_OSPI_NOR_Erase_Block_Start(uint32_t BlockAddress)
+{
+  /* Enable write operations */
+  if (OSPI_NOR_WriteEnable() != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Send the command */
+  return OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_OctalCcr(OSPI_NOR_ADDRESS),
+                          OCTAL_BLOCK_ERASE_CMD, BlockAddress, 0, 0);
+}
+
+/**
+  * @brief  Erases the specified sector of the OSPI memory.
+  * @param  Sector: Sector address to erase
+  * @retval OSPI memory status
+  * @note   The erase runs when the function returns.
+  */
+uint8_t BSP_OSPI_NOR_Erase_Sector(uint32_t Sector)
+{
+  if (Sector >= (uint32_t)(MX25LM51245G_FLASH_SIZE/MX25LM51245G_SECTOR_SIZE))
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Enable write operations */
+  if (OSPI_NOR_WriteEnable() != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Send the command */
+  return OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_OctalCcr(OSPI_NOR_ADDRESS),
+                          OCTAL_SECTOR_ERASE_CMD, Sector * MX25LM51245G_SECTOR_SIZE, 0, 0);
+}
+
+/**
+  * @brief  Erases the entire OSPI memory.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_Erase_Chip(void)
+{
+  /* Enable write operations */
+  if (OSPI_NOR_WriteEnable() != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Send the command */
+  if (OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_OctalCcr(0), OCTAL_CHIP_ERASE_CMD, 0, 0, 0) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Configure automatic polling mode to wait for end of erase */
+  return OSPI_NOR_AutoPollingMemReady(MX25LM51245G_CHIP_ERASE_MAX_TIME);
+}
+
+/**
+  * @brief  Reads current status of the OSPI memory.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_GetStatus(void)
+{
+  uint32_t ccr = OSPI_NOR_OctalCcr(OSPI_NOR_ADDRESS | OSPI_NOR_DATA | OSPI_NOR_DQS);
+  uint8_t reg[2];
+
+  /* Read the security register */
+  if ((OSPI_NOR_Command(OSPI_NOR_INDIRECT_READ, ccr, OCTAL_READ_SECURITY_REG_CMD, 0, DUMMY_CYCLES_READ_OCTAL, 2) != OSPI_NOR_OK) ||
+      (OSPI_NOR_Receive(reg, 2) != OSPI_NOR_OK))
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Check the value of the register */
+  if ((reg[0] & (MX25LM51245G_SECR_P_FAIL | MX25LM51245G_SECR_E_FAIL)) != 0)
+  {
+    return OSPI_NOR_ERROR;
+  }
+  else if ((reg[0] & (MX25LM51245G_SECR_PSB | MX25LM51245G_SECR_ESB)) != 0)
+  {
+    return OSPI_NOR_SUSPENDED;
+  }
+
+  /* Read the status register */
+  if ((OSPI_NOR_Command(OSPI_NOR_INDIRECT_READ, ccr, OCTAL_READ_STATUS_REG_CMD, 0, DUMMY_CYCLES_READ_OCTAL, 2) != OSPI_NOR_OK) ||
+      (OSPI_NOR_Receive(reg, 2) != OSPI_NOR_OK))
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Check the value of the register */
+  if ((reg[0] & MX25LM51245G_SR_WIP) != 0)
+  {
+    return OSPI_NOR_BUSY;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Return the configuration of the OSPI memory.
+  * @param  pInfo: pointer on the configuration structure
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_GetInfo(OSPI_NOR_Info* pInfo)
+{
+  /* Configure the structure with the memory configuration */
+  pInfo->FlashSize          = MX25LM51245G_FLASH_SIZE;
+  pInfo->EraseSectorSize    = MX25LM51245G_BLOCK_SIZE;
+  pInfo->EraseSectorsNumber = (MX25LM51245G_FLASH_SIZE/MX25LM51245G_BLOCK_SIZE);
+  pInfo->ProgPageSize       = MX25LM51245G_PAGE_SIZE;
+  pInfo->ProgPagesNumber    = (MX25LM51245G_FLASH_SIZE/MX25LM51245G_PAGE_SIZE);
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Waits for the end of the ongoing program/erase operation.
+  * @param  Timeout: Timeout for the operation, in ms
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_WaitForReady(uint32_t Timeout)
+{
+  return OSPI_NOR_AutoPollingMemReady(Timeout);
+}
+
+/**
+  * @brief  Return the time spent waiting for the memory by the last
+  *         program/erase operation.
+  * @retval Wait time in us
+  */
+uint32_t BSP_OSPI_NOR_GetWaitTime(void)
+{
+  return OSPI_NOR_WaitTime;
+}
+
+/**
+  * @brief  Return the number of commands sent to the OSPI memory, a status
+  *         polling counts as one command.
+  * @retval Commands since the algorithm was loaded
+  */
+uint32_t BSP_OSPI_NOR_GetCommandCount(void)
+{
+  return OSPI_NOR_Commands;
+}
+
+/**
+  * @brief  Configure the OSPI in memory-mapped mode, nothing is done when
+  *         the OSPI is already in memory-mapped mode.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_EnableMemoryMappedMode(void)
+{
+  OCTOSPI_TypeDef *ospi = OSPI_NOR_Board.Instance;
+  uint32_t ccr = OSPI_NOR_OctalCcr(OSPI_NOR_ADDRESS | OSPI_NOR_DATA | OSPI_NOR_DQS);
+
+  if (READ_BIT(ospi->CR, OCTOSPI_CR_FMODE) == OSPI_NOR_MEMORY_MAPPED)
+  {
+    return OSPI_NOR_OK;
+  }
+
+  if (OSPI_NOR_WaitReg(&ospi->SR, OCTOSPI_SR_BUSY, 0) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Write instruction, the DQS setting of both must match */
+  ospi->WCCR = ccr;
+  ospi->WTCR = 0;
+  ospi->WIR  = OCTAL_PAGE_PROG_CMD;
+
+  /* Read instruction, the memory is read from the first AHB access */
+  MODIFY_REG(ospi->CR, (OCTOSPI_CR_FMODE | OCTOSPI_CR_TCEN), OSPI_NOR_MEMORY_MAPPED);
+  MODIFY_REG(ospi->TCR, OCTOSPI_TCR_DCYC, OSPI_NOR_DummyCycles);
+  ospi->CCR = ccr;
+  ospi->IR  = (OSPI_NOR_Dtr == 0U) ? OCTAL_IO_READ_CMD : OCTAL_IO_DTR_READ_CMD;
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Leaves the memory-mapped mode, back to the indirect mode. The
+  *         memory stays in octal mode.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_DisableMemoryMappedMode(void)
+{
+  if (READ_BIT(OSPI_NOR_Board.Instance->CR, OCTOSPI_CR_FMODE) != OSPI_NOR_MEMORY_MAPPED)
+  {
+    return OSPI_NOR_OK;
+  }
+
+  /* Aborting the memory-mapped mode releases the chip select */
+  return OSPI_NOR_Abort();
+}
+
+/**
+  * @brief  This function suspends an ongoing erase command.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_SuspendErase(void)
+{
+  uint8_t status;
+
+  /* Check whether the device is busy (erase operation is in progress) */
+  if (BSP_OSPI_NOR_GetStatus() != OSPI_NOR_BUSY)
+  {
+    return OSPI_NOR_OK;
+  }
+
+  /* Send the command */
+  if (OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_OctalCcr(0), OCTAL_PROG_ERASE_SUSPEND_CMD, 0, 0, 0) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* The device stays busy until the suspend latency has elapsed, the erase
+     may also have completed meanwhile */
+  if (OSPI_NOR_AutoPollingMemReady(ERASE_SUSPEND_TIMEOUT) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  status = BSP_OSPI_NOR_GetStatus();
+  return ((status == OSPI_NOR_SUSPENDED) || (status == OSPI_NOR_OK)) ? OSPI_NOR_OK : OSPI_NOR_ERROR;
+}
+
+/**
+  * @brief  This function resumes a paused erase command.
+  * @retval OSPI memory status
+  */
+uint8_t BSP_OSPI_NOR_ResumeErase(void)
+{
+  /* Check whether the device is in suspended state */
+  if (BSP_OSPI_NOR_GetStatus() != OSPI_NOR_SUSPENDED)
+  {
+    return OSPI_NOR_OK;
+  }
+
+  /* Send the command */
+  if (OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_OctalCcr(0), OCTAL_PROG_ERASE_RESUME_CMD, 0, 0, 0) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* The write in progress bit is set again by the resumed erase */
+  return (BSP_OSPI_NOR_GetStatus() == OSPI_NOR_BUSY) ? OSPI_NOR_OK : OSPI_NOR_ERROR;
+}
+/**
+  * @}
+  */
+
+/** @addtogroup STM32L4_OSPI_NOR_Lean_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Configures the pins of a GPIO port.
+  * @param  Port: GPIO port
+  * @param  Pins: GPIO_PIN_x of the pins
+  * @param  Mode: OSPI_NOR_GPIO_x mode
+  * @param  Pull: GPIO_NOPULL, GPIO_PULLUP or GPIO_PULLDOWN
+  * @param  Alternate: alternate function, in OSPI_NOR_GPIO_AF mode
+  * @retval None
+  */
+static void OSPI_NOR_GpioInit(GPIO_TypeDef *Port, uint32_t Pins, uint32_t Mode, uint32_t Pull, uint32_t Alternate)
+{
+  uint32_t pin, speed;
+
+  speed = (Mode == OSPI_NOR_GPIO_AF) ? OSPI_NOR_GPIO_VERY_HIGH : 0U;
+
+  for (pin = 0; pin < 16U; pin++)
+  {
+    if ((Pins & (1UL << pin)) == 0U)
+    {
+      continue;
+    }
+
+    MODIFY_REG(Port->AFR[pin >> 3], 0xFUL << ((pin & 7U) * 4U), Alternate << ((pin & 7U) * 4U));
+    MODIFY_REG(Port->OSPEEDR, 0x3UL << (pin * 2U), speed << (pin * 2U));
+    CLEAR_BIT(Port->OTYPER, 1UL << pin);
+    MODIFY_REG(Port->PUPDR, 0x3UL << (pin * 2U), Pull << (pin * 2U));
+    MODIFY_REG(Port->MODER, 0x3UL << (pin * 2U), Mode << (pin * 2U));
+  }
+}
+
+/**
+  * @brief  Initializes the OSPI MSP.
+  * @retval None
+  */
+static void OSPI_NOR_MspInit(void)
+{
+  const OSPI_NOR_GpioTypeDef *gpio;
+  uint32_t ospi1, ospi2;
+
+  /* Enable the OctoSPI memory interface clock and reset it */
+  __HAL_RCC_OSPIM_CLK_ENABLE();
+  if (OSPI_NOR_Board.Instance == OCTOSPI1)
+  {
+    __HAL_RCC_OSPI1_CLK_ENABLE();
+    __HAL_RCC_OSPI1_FORCE_RESET();
+    __HAL_RCC_OSPI1_RELEASE_RESET();
+  }
+  else
+  {
+    __HAL_RCC_OSPI2_CLK_ENABLE();
+    __HAL_RCC_OSPI2_FORCE_RESET();
+    __HAL_RCC_OSPI2_RELEASE_RESET();
+  }
+
+  /* OctoSPI IO Manager configuration, the reset mapping is kept when the
+     board does not define a port. The port of the board and the other
+     port are swapped between the instances */
+  if (OSPI_NOR_Board.Ospim.ClkPort != 0U)
+  {
+    ospi1 = (OSPI_NOR_Board.Instance == OCTOSPI1) ? (OSPI_NOR_Board.Ospim.ClkPort - 1U) : (2U - OSPI_NOR_Board.Ospim.ClkPort);
+    ospi2 = 1U - ospi1;
+
+    OCTOSPIM->PCR[ospi1] = OSPI_NOR_OSPIM_PORT_OSPI1;
+    OCTOSPIM->PCR[ospi2] = OSPI_NOR_OSPIM_PORT_OSPI2;
+  }
+
+  /* IOSV bit MUST be set to access GPIO port G[2:15] */
+  __HAL_RCC_PWR_CLK_ENABLE();
+  SET_BIT(PWR->CR2, PWR_CR2_IOSV);
+
+  /* OctoSPI CS, DQS, CLK and D0-D7 GPIO pins configuration, the table ends
+     with a NULL port */
+  for (gpio = OSPI_NOR_Board.Gpio; gpio->Port != NULL; gpio++)
+  {
+    /* The GPIOx enable bits of AHB2ENR follow the order of the ports */
+    SET_BIT(RCC->AHB2ENR, RCC_AHB2ENR_GPIOAEN << OSPI_NOR_GPIO_INDEX(gpio->Port));
+    (void)READ_BIT(RCC->AHB2ENR, RCC_AHB2ENR_GPIOAEN << OSPI_NOR_GPIO_INDEX(gpio->Port));
+
+    OSPI_NOR_GpioInit(gpio->Port, gpio->Pins, OSPI_NOR_GPIO_AF, gpio->Pull, gpio->Alternate);
+  }
+}
+
+/**
+  * @brief  De-Initializes the OSPI MSP.
+  * @retval None
+  */
+static void OSPI_NOR_MspDeInit(void)
+{
+  const OSPI_NOR_GpioTypeDef *gpio;
+
+  /* OctoSPI CLK, CS, D0-D7, DQS GPIO pins back to their reset state */
+  for (gpio = OSPI_NOR_Board.Gpio; gpio->Port != NULL; gpio++)
+  {
+    OSPI_NOR_GpioInit(gpio->Port, gpio->Pins, OSPI_NOR_GPIO_ANALOG, GPIO_NOPULL, 0);
+  }
+
+  /* Set the CS pin in input, no pull (optimum default setting) */
+  OSPI_NOR_GpioInit(OSPI_NOR_Board.CsPort, OSPI_NOR_Board.CsPin, OSPI_NOR_GPIO_INPUT, GPIO_NOPULL, 0);
+
+  /* Set the idle pin of the board in no pull, low state (optimum default setting) */
+  OSPI_NOR_Board.IdleLowPort->BRR = OSPI_NOR_Board.IdleLowPin;
+  OSPI_NOR_GpioInit(OSPI_NOR_Board.IdleLowPort, OSPI_NOR_Board.IdleLowPin, OSPI_NOR_GPIO_OUTPUT, GPIO_NOPULL, 0);
+
+  /* Reset the OctoSPI memory interface and disable its clock */
+  if (OSPI_NOR_Board.Instance == OCTOSPI1)
+  {
+    __HAL_RCC_OSPI1_FORCE_RESET();
+    __HAL_RCC_OSPI1_RELEASE_RESET();
+    __HAL_RCC_OSPI1_CLK_DISABLE();
+  }
+  else
+  {
+    __HAL_RCC_OSPI2_FORCE_RESET();
+    __HAL_RCC_OSPI2_RELEASE_RESET();
+    __HAL_RCC_OSPI2_CLK_DISABLE();
+  }
+}
+
+/**
+  * @brief  Waits until the masked bits of a register have a value.
+  * @param  Reg: register
+  * @param  Mask: bits of the register
+  * @param  Value: value of the bits
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_WaitReg(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while ((*Reg & Mask) != Value)
+  {
+    if ((HAL_GetTick() - tickstart) > OSPI_NOR_CMD_TIMEOUT)
+    {
+      return OSPI_NOR_ERROR;
+    }
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Aborts the ongoing command, automatic polling or memory-mapped
+  *         mode, the OctoSPI is left in indirect mode.
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_Abort(void)
+{
+  OCTOSPI_TypeDef *ospi = OSPI_NOR_Board.Instance;
+
+  if (READ_BIT(ospi->SR, OCTOSPI_SR_BUSY) != 0U)
+  {
+    SET_BIT(ospi->CR, OCTOSPI_CR_ABORT);
+
+    /* The abort bit is cleared by hardware once the abort is done */
+    if ((OSPI_NOR_WaitReg(&ospi->CR, OCTOSPI_CR_ABORT, 0) != OSPI_NOR_OK) ||
+        (OSPI_NOR_WaitReg(&ospi->SR, OCTOSPI_SR_BUSY, 0) != OSPI_NOR_OK))
+    {
+      return OSPI_NOR_ERROR;
+    }
+  }
+
+  ospi->FCR = OCTOSPI_FCR_CTEF | OCTOSPI_FCR_CTCF | OCTOSPI_FCR_CSMF | OCTOSPI_FCR_CTOF;
+  MODIFY_REG(ospi->CR, (OCTOSPI_CR_FMODE | OCTOSPI_CR_TEIE | OCTOSPI_CR_TCIE | OCTOSPI_CR_SMIE), OSPI_NOR_INDIRECT_WRITE);
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Returns the communication configuration of an octal command, in
+  *         the protocol of the memory.
+  * @param  Phases: OSPI_NOR_ADDRESS, OSPI_NOR_DATA and OSPI_NOR_DQS flags
+  * @retval CCR register value
+  */
+static uint32_t OSPI_NOR_OctalCcr(uint32_t Phases)
+{
+  /* 16-bit instruction on 8 lines */
+  uint32_t ccr = OCTOSPI_CCR_IMODE_2 | OCTOSPI_CCR_ISIZE_0;
+
+  /* 32-bit address on 8 lines */
+  if ((Phases & OSPI_NOR_ADDRESS) != 0U)
+  {
+    ccr |= OCTOSPI_CCR_ADMODE_2 | OCTOSPI_CCR_ADSIZE;
+  }
+
+  /* Data on 8 lines */
+  if ((Phases & OSPI_NOR_DATA) != 0U)
+  {
+    ccr |= OCTOSPI_CCR_DMODE_2;
+  }
+
+  if (OSPI_NOR_Dtr != 0U)
+  {
+    ccr |= OCTOSPI_CCR_IDTR;
+
+    if ((Phases & OSPI_NOR_ADDRESS) != 0U)
+    {
+      ccr |= OCTOSPI_CCR_ADDTR;
+    }
+
+    if ((Phases & OSPI_NOR_DATA) != 0U)
+    {
+      ccr |= OCTOSPI_CCR_DDTR;
+    }
+
+    if ((Phases & OSPI_NOR_DQS) != 0U)
+    {
+      ccr |= OCTOSPI_CCR_DQSE;
+    }
+  }
+
+  return ccr;
+}
+
+/**
+  * @brief  Configures a command in indirect or automatic polling mode. A
+  *         command without data is sent and completed.
+  * @param  Mode: OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_INDIRECT_READ or
+  *         OSPI_NOR_AUTO_POLLING
+  * @param  Ccr: communication configuration
+  * @param  Instruction: instruction
+  * @param  Address: address, when the configuration has an address phase
+  * @param  DummyCycles: dummy cycles
+  * @param  Size: size of data, when the configuration has a data phase
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_Command(uint32_t Mode, uint32_t Ccr, uint32_t Instruction,
+                                uint32_t Address, uint32_t DummyCycles, uint32_t Size)
+{
+  OCTOSPI_TypeDef *ospi = OSPI_NOR_Board.Instance;
+
+  /* The configuration is only changed when the OctoSPI is idle */
+  if (OSPI_NOR_WaitReg(&ospi->SR, OCTOSPI_SR_BUSY, 0) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  OSPI_NOR_Commands++;
+
+  MODIFY_REG(ospi->CR, OCTOSPI_CR_FMODE, Mode);
+  if (Size != 0U)
+  {
+    ospi->DLR = Size - 1U;
+  }
+  MODIFY_REG(ospi->TCR, OCTOSPI_TCR_DCYC, DummyCycles);
+  ospi->CCR = Ccr;
+
+  /* The command starts at the last phase written: the instruction, the
+     address, or the first data written to the FIFO */
+  ospi->IR = Instruction;
+  if ((Ccr & OCTOSPI_CCR_ADMODE) != 0U)
+  {
+    ospi->AR = Address;
+  }
+
+  if ((Ccr & OCTOSPI_CCR_DMODE) == 0U)
+  {
+    if (OSPI_NOR_WaitReg(&ospi->SR, OCTOSPI_SR_TCF, OCTOSPI_SR_TCF) != OSPI_NOR_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+    ospi->FCR = OCTOSPI_FCR_CTCF;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Writes the data of an indirect write command to the FIFO.
+  * @param  pData: pointer to data
+  * @param  Size: size of data
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_Transmit(const uint8_t *pData, uint32_t Size)
+{
+  OCTOSPI_TypeDef *ospi = OSPI_NOR_Board.Instance;
+
+  /* Words while the buffer is aligned, the FIFO threshold is one word */
+  if (((uint32_t)pData & 3U) == 0U)
+  {
+    for (; Size >= 4U; Size -= 4U)
+    {
+      if (OSPI_NOR_WaitReg(&ospi->SR, OCTOSPI_SR_FTF, OCTOSPI_SR_FTF) != OSPI_NOR_OK)
+      {
+        return OSPI_NOR_ERROR;
+      }
+      ospi->DR = *(const uint32_t *)pData;
+      pData += 4U;
+    }
+  }
+
+  for (; Size != 0U; Size--)
+  {
+    if (OSPI_NOR_WaitReg(&ospi->SR, OCTOSPI_SR_FTF, OCTOSPI_SR_FTF) != OSPI_NOR_OK)
+    {
+      return OSPI_NOR_ERROR;
+    }
+    *(__IO uint8_t *)&ospi->DR = *pData++;
+  }
+
+  /* End of the transfer on the bus */
+  if (OSPI_NOR_WaitReg(&ospi->SR, OCTOSPI_SR_TCF, OCTOSPI_SR_TCF) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+  ospi->FCR = OCTOSPI_FCR_CTCF;
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Reads the data of an indirect read command from the FIFO.
+  * @param  pData: pointer to data
+  * @param  Size: size of data, up to the 32 bytes of the FIFO
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_Receive(uint8_t *pData, uint32_t Size)
+{
+  OCTOSPI_TypeDef *ospi = OSPI_NOR_Board.Instance;
+
+  /* All the data is in the FIFO at the end of the transfer */
+  if (OSPI_NOR_WaitReg(&ospi->SR, OCTOSPI_SR_TCF, OCTOSPI_SR_TCF) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  for (; Size != 0U; Size--)
+  {
+    *pData++ = *(__IO uint8_t *)&ospi->DR;
+  }
+  ospi->FCR = OCTOSPI_FCR_CTCF;
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  Reads a register of the memory until its masked value matches,
+  *         the core sleeps meanwhile.
+  * @param  Ccr: communication configuration of the register read
+  * @param  Instruction: register read instruction
+  * @param  DummyCycles: dummy cycles
+  * @param  Size: size of the register
+  * @param  Mask: bits of the register
+  * @param  Match: value of the bits
+  * @param  Interval: OctoSPI clock cycles between the reads
+  * @param  Timeout: Timeout for the match, in ms
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_AutoPolling(uint32_t Ccr, uint32_t Instruction, uint32_t DummyCycles,
+                                    uint32_t Size, uint32_t Mask, uint32_t Match,
+                                    uint32_t Interval, uint32_t Timeout)
+{
+  OCTOSPI_TypeDef *ospi = OSPI_NOR_Board.Instance;
+
+  if (OSPI_NOR_WaitReg(&ospi->SR, OCTOSPI_SR_BUSY, 0) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* AND match mode, automatic stop on match */
+  ospi->PSMKR = Mask;
+  ospi->PSMAR = Match;
+  ospi->PIR   = Interval;
+  MODIFY_REG(ospi->CR, (OCTOSPI_CR_PMM | OCTOSPI_CR_APMS), OCTOSPI_CR_APMS);
+
+  if (OSPI_NOR_Command(OSPI_NOR_AUTO_POLLING, Ccr, Instruction, 0, DummyCycles, Size) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Sleep until the register matches */
+  return OSPI_NOR_WaitForFlag(OCTOSPI_SR_SMF, Timeout);
+}
+
+/**
+  * @brief  This function reset the OSPI memory.
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_ResetMemory(void)
+{
+  uint32_t dtr, ccr;
+
+  /* Reset in SPI mode */
+  if ((OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_SPI_CMD, RESET_ENABLE_CMD, 0, 0, 0) != OSPI_NOR_OK) ||
+      (OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_SPI_CMD, RESET_MEMORY_CMD, 0, 0, 0) != OSPI_NOR_OK))
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* The memory may be in octal STR or DTR mode, reset it in both */
+  for (dtr = 0; dtr < 2U; dtr++)
+  {
+    ccr = OCTOSPI_CCR_IMODE_2 | OCTOSPI_CCR_ISIZE_0 | ((dtr != 0U) ? OCTOSPI_CCR_IDTR : 0U);
+
+    if ((OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, ccr, OSPI_NOR_OCTAL_RESET_ENABLE_CMD, 0, 0, 0) != OSPI_NOR_OK) ||
+        (OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, ccr, OSPI_NOR_OCTAL_RESET_MEMORY_CMD, 0, 0, 0) != OSPI_NOR_OK))
+    {
+      return OSPI_NOR_ERROR;
+    }
+  }
+
+  /* Configure automatic polling mode to wait the memory is ready */
+  return OSPI_NOR_AutoPolling(OSPI_NOR_SPI_READ, READ_STATUS_REG_CMD, 0, 1, MX25LM51245G_SR_WIP, 0,
+                              SPI_POLLING_INTERVAL, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+}
+
+/**
+  * @brief  This function send a Write Enable and wait it is effective.
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_WriteEnable(void)
+{
+  if (OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_OctalCcr(0), OCTAL_WRITE_ENABLE_CMD, 0, 0, 0) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Configure automatic polling mode to wait for write enabling */
+  return OSPI_NOR_AutoPolling(OSPI_NOR_OctalCcr(OSPI_NOR_ADDRESS | OSPI_NOR_DATA | OSPI_NOR_DQS), OCTAL_READ_STATUS_REG_CMD,
+                              (OSPI_NOR_Dtr == 0U) ? DUMMY_CYCLES_READ_OCTAL : DUMMY_CYCLES_WEL_DTR, 2,
+                              MX25LM51245G_SR_WEL, MX25LM51245G_SR_WEL, SPI_POLLING_INTERVAL, OSPI_NOR_CMD_TIMEOUT);
+}
+
+/**
+  * @brief  This function read the SR of the memory and wait the EOP.
+  * @param  Timeout: Timeout for auto-polling, in ms
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_AutoPollingMemReady(uint32_t Timeout)
+{
+  return OSPI_NOR_AutoPolling(OSPI_NOR_OctalCcr(OSPI_NOR_ADDRESS | OSPI_NOR_DATA | OSPI_NOR_DQS), OCTAL_READ_STATUS_REG_CMD,
+                              DUMMY_CYCLES_READ_OCTAL, 2, MX25LM51245G_SR_WIP, 0,
+                              MEM_READY_POLLING_INTERVAL, Timeout);
+}
+
+/**
+  * @brief  Sleeps until the automatic polling running on the OSPI matches.
+  * @param  Flag: OCTOSPI_SR_SMF
+  * @param  Timeout: Timeout for the flag, in ms
+  * @retval OSPI memory status
+  * @note   The OSPI interrupt, as well as the TIM6 update used as time
+  *         reference, stay disabled in the NVIC: they only wake the core up
+  *         from WFE (SEVONPEND), no handler runs.
+  *         The measured wait is returned by BSP_OSPI_NOR_GetWaitTime().
+  */
+static uint8_t OSPI_NOR_WaitForFlag(uint32_t Flag, uint32_t Timeout)
+{
+  OCTOSPI_TypeDef *ospi = OSPI_NOR_Board.Instance;
+  uint32_t overflow = 0;
+  uint32_t elapsed  = 0;
+  uint32_t period;
+
+  /* TIM6 free running at 1 MHz, updates every 65.536 ms, or when the
+     timeout expires for a shorter wait */
+  period = (Timeout < 64U) ? ((Timeout + 1U) * 1000U) : 0x10000U;
+  __HAL_RCC_TIM6_CLK_ENABLE();
+  TIM6->CR1  = 0;
+  TIM6->PSC  = (Tick_TimerClock() / 1000000U) - 1U;
+  TIM6->ARR  = period - 1U;
+  TIM6->EGR  = TIM_EGR_UG;
+  TIM6->SR   = 0;
+  TIM6->DIER = TIM_DIER_UIE;
+  TIM6->CR1  = TIM_CR1_CEN;
+
+  NVIC_DisableIRQ(OSPI_NOR_IRQn);
+  NVIC_DisableIRQ(TIM6_DAC_IRQn);
+  SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+  SET_BIT(ospi->CR, (OCTOSPI_CR_SMIE | OCTOSPI_CR_TEIE));
+
+  while ((READ_BIT(ospi->SR, (Flag | OCTOSPI_SR_TEF))) == 0U)
+  {
+    if ((TIM6->SR & TIM_SR_UIF) != 0U)
+    {
+      TIM6->SR = 0;
+      overflow++;
+    }
+
+    elapsed = (overflow * period) + TIM6->CNT;
+    if ((elapsed / 1000U) > Timeout)
+    {
+      break;
+    }
+
+    /* A flag raised after the test pends its interrupt, which sets the
+       event register: WFE returns immediately in that case */
+    NVIC_ClearPendingIRQ(OSPI_NOR_IRQn);
+    NVIC_ClearPendingIRQ(TIM6_DAC_IRQn);
+    __WFE();
+  }
+
+  CLEAR_BIT(ospi->CR, (OCTOSPI_CR_SMIE | OCTOSPI_CR_TEIE));
+  TIM6->CR1  = 0;
+  TIM6->DIER = 0;
+  TIM6->SR   = 0;
+  NVIC_ClearPendingIRQ(OSPI_NOR_IRQn);
+  NVIC_ClearPendingIRQ(TIM6_DAC_IRQn);
+
+  OSPI_NOR_WaitTime = (overflow * period) + TIM6->CNT;
+
+  if ((READ_BIT(ospi->SR, Flag) == 0U) || (READ_BIT(ospi->SR, OCTOSPI_SR_TEF) != 0U))
+  {
+    /* Timeout or transfer error: stop the automatic polling */
+    OSPI_NOR_Abort();
+    return OSPI_NOR_ERROR;
+  }
+
+  ospi->FCR = OCTOSPI_FCR_CSMF | OCTOSPI_FCR_CTCF;
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function switches the memory from SPI to octal mode, in the
+  *         protocol of the board.
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_OctalEnable(void)
+{
+  uint32_t ccr;
+  uint8_t reg[2];
+
+  /* Dummy cycles of the array reads, then protocol, in configuration
+     register 2 */
+  reg[0] = OSPI_NOR_DummyCfg;
+  if ((OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_SPI_CMD, WRITE_ENABLE_CMD, 0, 0, 0) != OSPI_NOR_OK) ||
+      (OSPI_NOR_AutoPolling(OSPI_NOR_SPI_READ, READ_STATUS_REG_CMD, 0, 1, MX25LM51245G_SR_WEL, MX25LM51245G_SR_WEL,
+                            SPI_POLLING_INTERVAL, OSPI_NOR_CMD_TIMEOUT) != OSPI_NOR_OK) ||
+      (OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_SPI_WRITE_REG, WRITE_CFG_REG_2_CMD,
+                        MX25LM51245G_CR2_REG3_ADDR, 0, 1) != OSPI_NOR_OK) ||
+      (OSPI_NOR_Transmit(reg, 1) != OSPI_NOR_OK))
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  reg[0] = (OSPI_NOR_Board.Dtr != 0U) ? MX25LM51245G_CR2_DOPI : MX25LM51245G_CR2_SOPI;
+  if ((OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_SPI_CMD, WRITE_ENABLE_CMD, 0, 0, 0) != OSPI_NOR_OK) ||
+      (OSPI_NOR_AutoPolling(OSPI_NOR_SPI_READ, READ_STATUS_REG_CMD, 0, 1, MX25LM51245G_SR_WEL, MX25LM51245G_SR_WEL,
+                            SPI_POLLING_INTERVAL, OSPI_NOR_CMD_TIMEOUT) != OSPI_NOR_OK) ||
+      (OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_SPI_WRITE_REG, WRITE_CFG_REG_2_CMD,
+                        MX25LM51245G_CR2_REG1_ADDR, 0, 1) != OSPI_NOR_OK) ||
+      (OSPI_NOR_Transmit(reg, 1) != OSPI_NOR_OK))
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* The memory answers in octal mode from now on */
+  OSPI_NOR_Dtr = OSPI_NOR_Board.Dtr;
+
+  if (OSPI_NOR_AutoPollingMemReady(HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != OSPI_NOR_OK)
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* Check the configuration has been correctly done */
+  ccr = OSPI_NOR_OctalCcr(OSPI_NOR_ADDRESS | OSPI_NOR_DATA | OSPI_NOR_DQS);
+  if ((OSPI_NOR_Command(OSPI_NOR_INDIRECT_READ, ccr, OCTAL_READ_CFG_REG_2_CMD, MX25LM51245G_CR2_REG1_ADDR,
+                        DUMMY_CYCLES_READ_OCTAL, 2) != OSPI_NOR_OK) ||
+      (OSPI_NOR_Receive(reg, 2) != OSPI_NOR_OK))
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  if (reg[0] != ((OSPI_NOR_Dtr != 0U) ? MX25LM51245G_CR2_DOPI : MX25LM51245G_CR2_SOPI))
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  return OSPI_NOR_OK;
+}
+
+/**
+  * @brief  This function switches the memory from octal back to SPI mode.
+  * @retval OSPI memory status
+  */
+static uint8_t OSPI_NOR_OctalDisable(void)
+{
+  uint8_t reg[2] = { 0, 0 };
+
+  /* Write configuration register 2 (with SPI protocol) */
+  if ((OSPI_NOR_WriteEnable() != OSPI_NOR_OK) ||
+      (OSPI_NOR_Command(OSPI_NOR_INDIRECT_WRITE, OSPI_NOR_OctalCcr(OSPI_NOR_ADDRESS | OSPI_NOR_DATA),
+                        OCTAL_WRITE_CFG_REG_2_CMD, MX25LM51245G_CR2_REG1_ADDR, 0, 2) != OSPI_NOR_OK) ||
+      (OSPI_NOR_Transmit(reg, 2) != OSPI_NOR_OK))
+  {
+    return OSPI_NOR_ERROR;
+  }
+
+  /* The memory answers in SPI mode from now on */
+  OSPI_NOR_Dtr = 0;
+
+  /* Wait that the configuration is effective and check that memory is ready */
+  return OSPI_NOR_AutoPolling(OSPI_NOR_SPI_READ, READ_STATUS_REG_CMD, 0, 1, MX25LM51245G_SR_WIP, 0,
+                              SPI_POLLING_INTERVAL, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* OSPI_NOR_LEAN */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
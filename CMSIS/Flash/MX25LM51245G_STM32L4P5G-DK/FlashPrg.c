@@ -10,6 +10,11 @@
 
 #include "..\FlashOS.H"        
 #include "STM32L4OSPI.h"
+#include "STM32L4Trace.h"
+#include "STM32L4Scatter.h"
+#include "STM32L4Bench.h"
+
+extern struct FlashDevice const FlashDevice;
 
 /*
  *  Initialize Flash Programming Functions
@@ -22,11 +27,20 @@
 #if defined FLASH_MEM || defined FLASH_OTP
 int Init (unsigned long adr, unsigned long clk, unsigned long fnc) {
 
- 
-	if(Init_OSPI ()!=0)
-   return 0;
- else 
-   return 1;
+  TRACE_BEGIN (TRACE_INIT, adr, fnc);
+
+  if (Init_OSPI () == 0)
+    return TRACE_END (1);
+
+#ifdef FLASH_MEM
+  /* FlashDev.c is fixed at build time, the memory found must hold it */
+  if (CheckDevice_OSPI (FlashDevice.szDev, FlashDevice.sectors[0].szSector) == 0)
+    return TRACE_END (1);
+#endif
+
+  TRACE_HCLK (SystemCoreClock);
+
+  return TRACE_END (0);
 }
 #endif
 
@@ -40,8 +54,36 @@ int Init (unsigned long adr, unsigned long clk, unsigned long fnc) {
 #if defined FLASH_MEM || defined FLASH_OTP
 int UnInit (unsigned long fnc) {
 
+  TRACE_BEGIN (TRACE_UNINIT, 0, fnc);
+
+  /* The last page program ends here, the memory is left idle and
+     memory-mapped */
+  if (UnInit_OSPI () == 0)
+    return TRACE_END (1);
 
-  return (0);
+  return TRACE_END (0);
+}
+#endif
+
+
+/*
+ *  Blank Check Checks if Memory is Blank
+ *    Parameter:      adr:  Block Start Address
+ *                    sz:   Block Size (in bytes)
+ *                    pat:  Block Pattern
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#ifdef FLASH_MEM
+int BlankCheck (unsigned long adr, unsigned long sz, unsigned char pat) {
+
+  TRACE_BEGIN (TRACE_BLANK_CHECK, adr, sz);
+
+  /* A blank sector is not erased again */
+  if (BlankCheck_OSPI (adr, sz, pat) == 1)
+    return TRACE_END (0);
+
+  return TRACE_END (1);
 }
 #endif
 
@@ -55,7 +97,9 @@ int UnInit (unsigned long fnc) {
 int EraseChip (void) {
 	
 
-  return (MassErase());                                          
+  TRACE_BEGIN (TRACE_ERASE_CHIP, 0, 0);
+
+  return TRACE_END (MassErase());                                          
 }
 #endif
 
@@ -67,18 +111,36 @@ int EraseChip (void) {
  */
 
 #ifdef FLASH_MEM
+/*
+ *  Size of the Sector at an Address, from the Device Description
+ *    Parameter:      adr:  Sector Address
+ *    Return Value:   Sector Size (in bytes)
+ */
+
+static unsigned long SectorSize (unsigned long adr) {
+  const struct FlashSectors *sector;
+  unsigned long size = 0;
+
+  adr -= FlashDevice.DevAdr;
+  for (sector = FlashDevice.sectors; sector->szSector != 0xFFFFFFFF; sector++) {
+    if (sector->AddrSector > adr)
+      break;
+    size = sector->szSector;
+  }
+
+  return size;
+}
+
 int EraseSector (unsigned long adr) {
-	
-    
- int result = 0;
-	uint32_t block_start=adr;
-	uint32_t block_size;
-	
-  result = SectorErase ((uint32_t) block_start & 0xffffffff ,((uint32_t) block_start & 0xffffffff) + block_size);
-  if (result == 1)   
-    return 0;   
-  else 
-    return result;	
+  unsigned long size = SectorSize (adr);
+
+  TRACE_BEGIN (TRACE_ERASE_SECTOR, adr, size);
+
+  /* Exactly the sector declared in FlashDev.c, nothing more */
+  if (SectorErase ((uint32_t) adr, (uint32_t) (adr + size)) == 1)
+    return TRACE_END (0);
+  else
+    return TRACE_END (1);
 }
 #endif
 
@@ -94,22 +156,79 @@ int EraseSector (unsigned long adr) {
 #if defined FLASH_MEM || defined FLASH_OTP
 int ProgramPage (unsigned long block_start, unsigned long size, unsigned char *buffer) {
                                        
+	TRACE_BEGIN (TRACE_PROGRAM, block_start, size);
+
 	if(Write(block_start ,size, buffer)!=0)
-  return 0;
+  return TRACE_END (0);
 	 else
-  return 1;
+  return TRACE_END (1);
 }
 
 
 
 unsigned long Verify (unsigned long adr, unsigned long sz, unsigned char *buf){
 	
+	TRACE_BEGIN (TRACE_VERIFY, adr, sz);
+
 	while (sz-->0)
 	{
-		if ( *(char*)adr++ != *((char*)buf++))
-			return (adr);
+		if ( *(char*)adr != *((char*)buf++))
+			return TRACE_END (adr);
+		adr++;
 	}
 		
-  return adr;
+  return TRACE_END (adr);
+}
+#endif
+
+/*
+ *  Program the Regions of a Descriptor List downloaded in one Buffer (STM32L4Scatter.c)
+ *    Parameter:      cnt:  Number of Descriptors
+ *                    sz:   Buffer Size (in bytes)
+ *                    buf:  Descriptors, then the Data of the Regions
+ *    Return Value:   0 - OK,  1 - Failed
+ *
+ *  The small sections of an image are programmed in one call instead of one
+ *  ProgramPage call each. The regions are erased before, any alignment.
+ */
+
+#if defined FLASH_MEM || defined FLASH_OTP
+int ProgramScatter (unsigned long cnt, unsigned long sz, unsigned char *buf) {
+
+  if (Scatter_Program (ProgramPage, cnt, sz, buf, FlashDevice.szPage, 1U) != 0U) {
+    return (1);                                         /* Failed */
+  }
+
+  return (0);                                           /* Done */
+}
+#endif
+
+/*
+ *  Benchmark the Programming Functions over a Corpus of Images (STM32L4Bench.c),
+ *  the Report is read from Bench_Report. The Memory Content is lost.
+ *    Parameter:      adr:  Start Address of the Images
+ *                    sz:   Size of the Images, 0 - whole Device
+ *                    clk:  Clock Frequency (Hz)
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#if defined FLASH_MEM && defined FLASH_BENCHMARK
+static uint32_t BenchCommands (void) {
+  return (BusCount.Commands);
+}
+
+static uint32_t BenchClock (void) {
+  return (SystemCoreClock);
+}
+
+int Benchmark (unsigned long adr, unsigned long sz, unsigned long clk) {
+  static const Bench_AlgoTypeDef Algo = {
+    Init, UnInit, EraseSector, ProgramPage, Verify, BenchCommands, BenchClock
+  };
+
+  if (Bench_Run (&Algo, &FlashDevice, adr, sz, clk) == BENCH_OK)
+    return 0;
+
+  return 1;
 }
 #endif
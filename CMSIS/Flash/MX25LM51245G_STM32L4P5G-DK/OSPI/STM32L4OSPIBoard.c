@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file    STM32L4OSPIBoard.c
+  * @author  MCD Application Team
+  * @brief   This file describes the wiring of the MX25LM51245G OSPI memory
+  *          of STM32L4P5G-DK.
+  *           
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+#include "STM32L4OSPI.h"
+
+/* OCTOSPI2 over the port 2 of the OctoSPI IO Manager, octal STR */
+const OSPI_NOR_BoardTypeDef OSPI_NOR_Board =
+{
+  .Instance       = OCTOSPI2,
+  .ClockPrescaler = 2,        /* slowest OctoSPI clock, 110MHz / 2 = 55MHz */
+  .PllN           = 55,
+  .Dtr            = 0,
+  .Ospim =
+  {
+    .ClkPort     = 2,
+    .DQSPort     = 2,
+    .NCSPort     = 2,
+    .IOLowPort   = HAL_OSPIM_IOPORT_2_LOW,
+    .IOHighPort  = HAL_OSPIM_IOPORT_2_HIGH,
+    .Req2AckTime = 1,
+  },
+  .Gpio =
+  {
+    /* CS */
+    { GPIOG, GPIO_PIN_12, GPIO_PULLUP, GPIO_AF5_OCTOSPIM_P2 },
+    /* DQS */
+    { GPIOF, GPIO_PIN_12, GPIO_PULLUP, GPIO_AF5_OCTOSPIM_P2 },
+    /* CLK, NCLK, D0, D1, D2 and D3 */
+    { GPIOF, (GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3 | GPIO_PIN_4 | GPIO_PIN_5), GPIO_NOPULL, GPIO_AF5_OCTOSPIM_P2 },
+    /* D4, D5, D6 and D7 */
+    { GPIOG, (GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_9 | GPIO_PIN_10), GPIO_NOPULL, GPIO_AF5_OCTOSPIM_P2 },
+    { NULL }
+  },
+  .CsPort         = GPIOG,
+  .CsPin          = GPIO_PIN_12,
+  .IdleLowPort    = GPIOF,
+  .IdleLowPin     = GPIO_PIN_12,
+};
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * @file    STM32L4OSPIBoard.c
+  * @author  MCD Application Team
+  * @brief   This file describes the wiring of the MX25LM51245G OSPI memory
+  *          of STM32L4R9I-DK.
+  *           
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+#include "STM32L4OSPI.h"
+
+/* OCTOSPI1 over the port 2 of the OctoSPI IO Manager, octal DTR */
+const OSPI_NOR_BoardTypeDef OSPI_NOR_Board =
+{
+  .Instance       = OCTOSPI1,
+  .ClockPrescaler = 2,        /* slowest OctoSPI clock, 110MHz / 2 = 55MHz */
+  .PllN           = 55,
+  .Dtr            = 1,
+  .Ospim =
+  {
+    .ClkPort     = 2,
+    .DQSPort     = 2,
+    .NCSPort     = 2,
+    .IOLowPort   = HAL_OSPIM_IOPORT_2_LOW,
+    .IOHighPort  = HAL_OSPIM_IOPORT_2_HIGH,
+  },
+  .Gpio =
+  {
+    /* CS */
+    { GPIOG, GPIO_PIN_12, GPIO_PULLUP, GPIO_AF5_OCTOSPIM_P2 },
+    /* DQS */
+    { GPIOG, GPIO_PIN_15, GPIO_PULLUP, GPIO_AF5_OCTOSPIM_P2 },
+    /* CLK, D0, D1 and D2 */
+    { GPIOI, (GPIO_PIN_6 | GPIO_PIN_9 | GPIO_PIN_10 | GPIO_PIN_11), GPIO_NOPULL, GPIO_AF5_OCTOSPIM_P2 },
+    /* D3, D4 and D5 */
+    { GPIOH, (GPIO_PIN_8 | GPIO_PIN_9 | GPIO_PIN_10), GPIO_NOPULL, GPIO_AF5_OCTOSPIM_P2 },
+    /* D6 and D7 */
+    { GPIOG, (GPIO_PIN_9 | GPIO_PIN_10), GPIO_NOPULL, GPIO_AF5_OCTOSPIM_P2 },
+    { NULL }
+  },
+  .CsPort         = GPIOG,
+  .CsPin          = GPIO_PIN_12,
+  .IdleLowPort    = GPIOG,
+  .IdleLowPin     = GPIO_PIN_15,
+};
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file    STM32L4OSPIBoard.c
+  * @author  MCD Application Team
+  * @brief   This file describes the wiring of the MX25LM51245G OSPI memory
+  *          of STM32L4R9I-EVAL.
+  *           
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+#include "STM32L4OSPI.h"
+
+/* OCTOSPI1 over the port 1 of the OctoSPI IO Manager (reset mapping), octal DTR */
+const OSPI_NOR_BoardTypeDef OSPI_NOR_Board =
+{
+  .Instance       = OCTOSPI1,
+  .ClockPrescaler = 2,        /* slowest OctoSPI clock, 120MHz / 2 = 60MHz */
+  .PllN           = 60,
+  .Dtr            = 1,
+  .Gpio =
+  {
+    /* CS */
+    { GPIOA, GPIO_PIN_2, GPIO_PULLUP, GPIO_AF10_OCTOSPIM_P1 },
+    /* DQS */
+    { GPIOB, GPIO_PIN_2, GPIO_PULLUP, GPIO_AF10_OCTOSPIM_P1 },
+    /* CLK, D2 and D3 */
+    { GPIOA, (GPIO_PIN_3 | GPIO_PIN_6 | GPIO_PIN_7), GPIO_NOPULL, GPIO_AF10_OCTOSPIM_P1 },
+    /* D0 and D1 */
+    { GPIOB, (GPIO_PIN_0 | GPIO_PIN_1), GPIO_NOPULL, GPIO_AF10_OCTOSPIM_P1 },
+    /* D6 and D7 */
+    { GPIOC, (GPIO_PIN_3 | GPIO_PIN_4), GPIO_NOPULL, GPIO_AF10_OCTOSPIM_P1 },
+    /* D5 */
+    { GPIOG, GPIO_PIN_11, GPIO_NOPULL, GPIO_AF3_OCTOSPIM_P1 },
+    /* D4 */
+    { GPIOH, GPIO_PIN_2, GPIO_NOPULL, GPIO_AF10_OCTOSPIM_P1 },
+    { NULL }
+  },
+  .CsPort         = GPIOA,
+  .CsPin          = GPIO_PIN_2,
+  .IdleLowPort    = GPIOA,
+  .IdleLowPin     = GPIO_PIN_3,
+};
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -1,8 +1,8 @@
 /**
   ******************************************************************************
-  * @file    STM32L4OSPI.h
+  * @file    STM32L4OSPIBoard.h
   * @author  MCD Application Team
-  * @brief   Header file of STM32L4OSPI.c
+  * @brief   Board BSP header of the MX25LM51245G OSPI loader of STM32L4R9I-EVAL.
   *           
   ******************************************************************************
   * @attention
@@ -19,22 +19,10 @@
   */
 
 
-#ifndef __STM32L4OSPI_H
-#define __STM32L4OSPI_H
+#ifndef __STM32L4OSPIBOARD_H
+#define __STM32L4OSPIBOARD_H
 #include "stdint.h"
 /* Includes ------------------------------------------------------------------*/
-#include "stm32L4xx_hal.h"
 #include "stm32l4r9i_eval_ospi_nor.h"
-#include "./mx25lm51245g/mx25lm51245g.h"
-
-#define TIMEOUT 5000U
-
-
-/* Private function prototypes -----------------------------------------------*/
-int Init_OSPI(void);
- int Write (uint32_t Address, uint32_t Size, uint8_t* buffer);
- int SectorErase (uint32_t EraseStartAddress ,uint32_t EraseEndAddress);
- int MassErase ( void);
-void SystemClock_Config(void);
 
 #endif
@@ -20,6 +20,7 @@
   */	
 
 #include "STM32L4QSPI.h"
+#include "STM32L4Tick.h"
 
 
 
@@ -32,36 +33,50 @@
 
 /* Private functions ---------------------------------------------------------*/
 
+static int SystemClock_Config(void);
+
 /** @defgroup STM32L476G_Disco_QSPI_Private_Functions Private Functions
   * @{
   */
 
-void HAL_Delay(uint32_t Delay)
-{
-  int i=0;
-  for (i=0; i<0x1000; i++);
-}
- uint32_t HAL_GetTick(void)
-{
-  int i;
-  for (i=0;i<1024;i++);
-  uwTick++;
-  return uwTick;
-}
 /** @defgroup STM32L476G_Disco_QSPI_Exported_Functions Exported Functions
   * @{
   */
  
+
+/* Time spent waiting for the memory by the last operations */
+WaitTime_TypeDef WaitTime;
+
+/* Operations on the memory since Init, and commands counted by the BSP at
+   Init */
+BusCount_TypeDef BusCount;
+static uint32_t  BusCount_Base = 0;
+
 /**
-  * @brief  Initializes the QSPI interface.
-  * @param  Instance   QSPI Instance
-  * @param  Init       QSPI Init structure
-  * @retval BSP status
+  * @brief  Record the commands sent to the memory since Init.
+  * @param  None
+  * @retval None
+  */
+static void BusCount_Commands(void)
+{
+  BusCount.Commands = BSP_QSPI_GetCommandCount() - BusCount_Base;
+}
+
+/**
+  * @brief  Record the wait of the last sector erase.
+  * @param  None
+  * @retval None
   */
- HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
-{ 
-  return HAL_OK;
+static void SectorErase_WaitTime(void)
+{
+  WaitTime.SectorErase = BSP_QSPI_GetWaitTime();
+  if (WaitTime.SectorErase > WaitTime.SectorEraseMax)
+  {
+    WaitTime.SectorEraseMax = WaitTime.SectorErase;
+  }
 }
+
+
 /**
   * @brief  System initialization.
   * @param  None
@@ -77,6 +92,9 @@ int Init_QSPI()
 	
   /* Configure the system clock  */
    SystemClock_Config();
+  memset(&WaitTime, 0, sizeof(WaitTime));
+  memset(&BusCount, 0, sizeof(BusCount));
+  BusCount_Base = BSP_QSPI_GetCommandCount();
 
 /*Initialaize QSPI*/
    if(BSP_QSPI_Init() !=0)
@@ -102,9 +120,16 @@ int Init_QSPI()
 	 /*Initialaize QSPI*/
     BSP_QSPI_Init();
 	 /*Erases the entire QSPI memory*/
+	  BusCount.Erases++;
 	  BSP_QSPI_Erase_Chip();
+	 /* Sleep until the end of the erase */
+	  if (BSP_QSPI_WaitForReady(N25Q128A_BULK_ERASE_MAX_TIME) != QSPI_OK)
+	    return 1;
+	  WaitTime.ChipErase = BSP_QSPI_GetWaitTime();
+	  BusCount_Commands();
 	 /* Reads current status of the QSPI memory*/
-    while (BSP_QSPI_GetStatus()!=0){};
+	  if (BSP_QSPI_GetStatus() != QSPI_OK)
+	    return 1;
 
 	 return 0;
  
@@ -120,14 +145,109 @@ int Init_QSPI()
   */
  int Write (uint32_t Address, uint32_t Size, uint8_t* buffer)
 {
+  int result = 1;
+
      Address = Address & 0x0fffffff;
+
+  /* One page program command per memory page spanned */
+  if (Size != 0U)
+  {
+    BusCount.PagePrograms += ((Address + Size - 1U) / N25Q128A_PAGE_SIZE) - (Address / N25Q128A_PAGE_SIZE) + 1U;
+    BusCount.BytesProgrammed += Size;
+  }
+
+  {
 	/*Initialaize QSPI*/
      BSP_QSPI_Init();
 	/* Writes an amount of data to the QSPI memory*/
      BSP_QSPI_Write(buffer,Address, Size);
-  
-   return 1;
+  }
+
+  BusCount_Commands();
+   return result;
+}
+/**
+  * @brief   Check the device of FlashDev.c, fixed when the algorithm is
+  *          built, against the memory found by Init_QSPI.
+  * @param   Size      : device size, from the start of the memory
+  * @param   SectorSize: smallest sector of the device
+  * @retval  1      : The memory holds the device
+  * @retval  0      : Smaller memory, or sectors it cannot erase
+  */
+int CheckDevice_QSPI(uint32_t Size, uint32_t SectorSize)
+{
+  QSPI_Info info;
+
+  if (BSP_QSPI_GetInfo(&info) != QSPI_OK)
+    return 0;
+
+  if ((Size > info.FlashSize) || ((SectorSize % ERASE_BLOCK_SIZE) != 0U))
+    return 0;
+
+  return 1;
+}
+
+/**
+  * @brief   Blank check, the memory is read in memory-mapped mode 32 bits
+  *          at a time and the check stops at the first 32-byte line which
+  *          differs from the erased pattern.
+  * @param   Address: start address, in the memory-mapped area
+  * @param   Size   : size of the area
+  * @param   Pattern: content of the erased memory
+  * @retval  1      : Area blank
+  * @retval  0      : Area not blank or operation failed
+  */
+int BlankCheck_QSPI(uint32_t Address, uint32_t Size, uint8_t Pattern)
+{
+  const volatile uint32_t *word;
+  uint32_t blank, n;
+
+  /* Write and erase leave the interface in indirect mode */
+  if (HAL_QSPI_GetState(&QSPIHandle) != HAL_QSPI_STATE_BUSY_MEM_MAPPED)
+  {
+    if (BSP_QSPI_EnableMemoryMappedMode() != QSPI_OK)
+      return 0;
+  }
+
+  /* Leading bytes up to the first word */
+  while (((Address & 3U) != 0U) && (Size != 0U))
+  {
+    if (*(const volatile uint8_t *)Address != Pattern)
+      return 0;
+    Address++;
+    Size--;
+  }
+
+  blank = Pattern * 0x01010101U;
+  word  = (const volatile uint32_t *)Address;
+
+  /* One test per 32-byte line, the prefetch of the memory-mapped mode
+     keeps streaming while the line is compared */
+  for (n = Size / 32U; n != 0U; n--)
+  {
+    if (((word[0] ^ blank) | (word[1] ^ blank) | (word[2] ^ blank) | (word[3] ^ blank) |
+         (word[4] ^ blank) | (word[5] ^ blank) | (word[6] ^ blank) | (word[7] ^ blank)) != 0U)
+      return 0;
+    word += 8;
+  }
+
+  for (n = (Size % 32U) / 4U; n != 0U; n--)
+  {
+    if (*word++ != blank)
+      return 0;
+  }
+
+  /* Trailing bytes */
+  Address = (uint32_t)word;
+  for (n = Size & 3U; n != 0U; n--)
+  {
+    if (*(const volatile uint8_t *)Address++ != Pattern)
+      return 0;
+  }
+
+  return 1;
 }
+
 /**
   * @brief   Sector erase.
   * @param   EraseStartAddress :  erase start address
@@ -149,9 +269,15 @@ int Init_QSPI()
   {
     BlockAddr = EraseStartAddress>>16;
     /*Erases the specified sector of the QSPI memory*/
+    BusCount.Erases++;
     BSP_QSPI_Erase_Sector(BlockAddr );
+  /* Sleep until the end of the erase */
+    if (BSP_QSPI_WaitForReady(N25Q128A_SECTOR_ERASE_MAX_TIME) != QSPI_OK)
+      return 0;
+    SectorErase_WaitTime();
   /* Reads current status of the QSPI memory*/
-	  while (BSP_QSPI_GetStatus()!=0){};
+	  if (BSP_QSPI_GetStatus() != QSPI_OK)
+	    return 0;
  
 		EraseStartAddress+=0x10000;
    
@@ -159,9 +285,11 @@ int Init_QSPI()
 	/*Configure the QSPI in memory-mapped mode*/
    BSP_QSPI_EnableMemoryMappedMode();
  
+  BusCount_Commands();
   return 1;	
 }
 
+
 /**
   * @brief  System Clock Configuration
   *         The system Clock is configured as follow : 
@@ -30,16 +30,50 @@
 #include "stm32l4xx_hal.h"
 #include "stm32l476g_discovery_qspi.h"
 #include "stm32l476g_discovery_qspi.h"
+#include "STM32L4Sfdp.h"
 #include <string.h>
 
 #define TIMEOUT 5000U
 
+#define ERASE_BLOCK_SIZE        0x10000U   /* N25Q128A_SECTOR_SIZE                       */
+
+
+/* Time spent waiting for the memory, in us. Reset by Init, read from the
+   debugger to profile the erase operations */
+typedef struct
+{
+  uint32_t ChipErase;         /* last chip erase                  */
+  uint32_t SectorErase;       /* last 64 KB sector erase          */
+  uint32_t SectorEraseMax;    /* longest sector erase since Init  */
+} WaitTime_TypeDef;
+
+extern WaitTime_TypeDef WaitTime;
+
+/* Operations on the memory since Init, read from the debugger with WaitTime
+   to compare the bus activity of downloads */
+typedef struct
+{
+  uint32_t Commands;          /* commands sent, a status polling counts once */
+  uint32_t PagePrograms;      /* page program commands            */
+  uint32_t BytesProgrammed;
+  uint32_t Erases;            /* sector and bulk erases           */
+} BusCount_TypeDef;
+
+extern BusCount_TypeDef BusCount;
 
 /* Private function prototypes -----------------------------------------------*/
 int Init_QSPI(void);
 int Write (uint32_t Address, uint32_t Size, uint8_t* buffer);
 int SectorErase (uint32_t EraseStartAddress ,uint32_t EraseEndAddress);
 int MassErase ( void);
-static int SystemClock_Config(void);
+int BlankCheck_QSPI(uint32_t Address, uint32_t Size, uint8_t Pattern);
+int CheckDevice_QSPI(uint32_t Size, uint32_t SectorSize);
+
+/* BSP extensions, not declared by the board BSP header ----------------------*/
+extern QSPI_HandleTypeDef QSPIHandle;
+uint8_t  BSP_QSPI_WaitForReady(uint32_t Timeout);
+uint32_t BSP_QSPI_GetWaitTime(void);
+uint32_t BSP_QSPI_GetCommandCount(void);
+uint8_t  BSP_QSPI_GetSFDP(SFDP_InfoTypeDef *pInfo);
 
 #endif
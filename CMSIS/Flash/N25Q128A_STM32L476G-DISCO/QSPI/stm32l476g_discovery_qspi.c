@@ -56,6 +56,8 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32l476g_discovery_qspi.h"
+#include "STM32L4Sfdp.h"
+#include "STM32L4Tick.h"
 #include <string.h>
 /** @addtogroup BSP
   * @{
@@ -69,6 +71,53 @@
   * @{
   */
 
+/* Private constants --------------------------------------------------------*/
+/** @defgroup STM32L476G_DISCOVERY_QSPI_Private_Constants Private Constants
+  * @{
+  */
+/* Commands of the memories described by their SFDP only */
+#define ENTER_4_BYTE_ADDR_CMD       0xB7
+#define READ_STATUS_REG2_CMD        0x35
+#define WRITE_STATUS_REG2_CMD       0x31
+#define READ_STATUS_REG2_3F_CMD     0x3F
+#define WRITE_STATUS_REG2_3E_CMD    0x3E
+
+/* Erase suspend latency of 30 us, with margin */
+#define QSPI_SUSPEND_TIMEOUT        1U     /* ms */
+/**
+  * @}
+  */
+
+/* Private types -------------------------------------------------------------*/
+
+/** @defgroup STM32L476G_DISCOVERY_QSPI_Private_Types Private Types
+  * @{
+  */
+/* Geometry and commands of the memory, from its SFDP or the N25Q128A ones */
+typedef struct
+{
+  uint32_t FlashSize;           /* bytes                                        */
+  uint32_t PageSize;            /* bytes                                        */
+  uint32_t SubsectorSize;       /* erased by BSP_QSPI_Erase_Block               */
+  uint8_t  SubsectorEraseCmd;
+  uint8_t  SectorEraseCmd;      /* N25Q128A_SECTOR_SIZE, BSP_QSPI_Erase_Sector  */
+  uint8_t  EraseSuspendCmd;     /* 0: erase suspend not supported               */
+  uint8_t  EraseResumeCmd;
+  uint32_t AddressSize;         /* QSPI_ADDRESS_24_BITS or QSPI_ADDRESS_32_BITS */
+  uint8_t  ReadCmd;
+  uint32_t ReadAddressMode;
+  uint32_t ReadAlternateMode;   /* mode bits, sent as 0xFF                      */
+  uint32_t ReadDataMode;
+  uint32_t ReadDummyCycles;
+  uint8_t  ProgCmd;
+  uint32_t ProgAddressMode;
+  uint32_t ProgDataMode;
+  uint8_t  SfdpCommands;        /* JESD216A command set, status in SR only      */
+} QSPI_MemoryTypeDef;
+/**
+  * @}
+  */
+
 /* Private variables ---------------------------------------------------------*/
 
 /** @defgroup STM32L476G_DISCOVERY_QSPI_Private_Variables Private Variables
@@ -76,6 +125,47 @@
   */
 QSPI_HandleTypeDef QSPIHandle;
 
+/* Time spent waiting for the memory by the last operation, in us */
+static uint32_t QSPI_WaitTime = 0;
+
+/* Commands sent to the memory since the algorithm was loaded */
+static uint32_t QSPI_Commands = 0;
+
+/* Parameters read from the memory, once: SFDP_OK when available */
+static SFDP_InfoTypeDef QSPI_Sfdp;
+static uint8_t          QSPI_SfdpStatus = 0xFF;
+
+/* Memory in use, the N25Q128A until the SFDP is read */
+static QSPI_MemoryTypeDef QSPI_Memory =
+{
+  N25Q128A_FLASH_SIZE, N25Q128A_PAGE_SIZE,
+  N25Q128A_SUBSECTOR_SIZE, SUBSECTOR_ERASE_CMD, SECTOR_ERASE_CMD,
+  PROG_ERASE_SUSPEND_CMD, PROG_ERASE_RESUME_CMD,
+  QSPI_ADDRESS_24_BITS,
+  QUAD_INOUT_FAST_READ_CMD, QSPI_ADDRESS_4_LINES, QSPI_ALTERNATE_BYTES_NONE, QSPI_DATA_4_LINES,
+  N25Q128A_DUMMY_CYCLES_READ_QUAD,
+  EXT_QUAD_IN_FAST_PROG_CMD, QSPI_ADDRESS_4_LINES, QSPI_DATA_4_LINES,
+  0
+};
+
+/* Lines of the SFDP_READ_x modes */
+static const uint32_t QSPI_ReadAddressMode[SFDP_READ_MODES] =
+{
+  QSPI_ADDRESS_1_LINE, QSPI_ADDRESS_1_LINE, QSPI_ADDRESS_2_LINES,
+  QSPI_ADDRESS_1_LINE, QSPI_ADDRESS_4_LINES, QSPI_ADDRESS_4_LINES
+};
+static const uint32_t QSPI_ReadAlternateMode[SFDP_READ_MODES] =
+{
+  QSPI_ALTERNATE_BYTES_1_LINE, QSPI_ALTERNATE_BYTES_1_LINE, QSPI_ALTERNATE_BYTES_2_LINES,
+  QSPI_ALTERNATE_BYTES_1_LINE, QSPI_ALTERNATE_BYTES_4_LINES, QSPI_ALTERNATE_BYTES_4_LINES
+};
+static const uint32_t QSPI_ReadDataMode[SFDP_READ_MODES] =
+{
+  QSPI_DATA_1_LINE, QSPI_DATA_2_LINES, QSPI_DATA_2_LINES,
+  QSPI_DATA_4_LINES, QSPI_DATA_4_LINES, QSPI_DATA_4_LINES
+};
+static const uint8_t QSPI_ReadAddressLines[SFDP_READ_MODES] = { 1, 1, 2, 1, 4, 4 };
+
 /**
   * @}
   */
@@ -88,10 +178,17 @@ QSPI_HandleTypeDef QSPIHandle;
   */
 static void    QSPI_MspInit(void);
 static void    QSPI_MspDeInit(void);
+static HAL_StatusTypeDef QSPI_Command(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd, uint32_t Timeout);
 static uint8_t QSPI_ResetMemory(QSPI_HandleTypeDef *hqspi);
 static uint8_t QSPI_DummyCyclesCfg(QSPI_HandleTypeDef *hqspi);
+static uint8_t QSPI_ReadSFDP(uint32_t Address, uint8_t *pData, uint32_t Size);
+static uint8_t QSPI_MemoryCfg(QSPI_HandleTypeDef *hqspi);
+static uint8_t QSPI_QuadEnable(QSPI_HandleTypeDef *hqspi);
+static uint8_t QSPI_ReadRegister(QSPI_HandleTypeDef *hqspi, uint8_t Instruction, uint8_t *pReg);
+static uint8_t QSPI_WriteRegister(QSPI_HandleTypeDef *hqspi, uint8_t Instruction, uint8_t *pReg, uint32_t Size);
 static uint8_t QSPI_WriteEnable(QSPI_HandleTypeDef *hqspi);
 static uint8_t QSPI_AutoPollingMemReady(QSPI_HandleTypeDef *hqspi, uint32_t Timeout);
+static uint8_t QSPI_WaitForMatch(QSPI_HandleTypeDef *hqspi, uint32_t Timeout);
 
 /**
   * @}
@@ -139,8 +236,8 @@ uint8_t BSP_QSPI_Init(void)
     return QSPI_NOT_SUPPORTED;
   }
 
-  /* Configuration of the dummy cucles on QSPI memory side */
-  if (QSPI_DummyCyclesCfg(&QSPIHandle) != QSPI_OK)
+  /* Geometry and commands of the memory from its SFDP */
+  if (QSPI_MemoryCfg(&QSPIHandle) != QSPI_OK)
   {
     return QSPI_NOT_SUPPORTED;
   }
@@ -180,21 +277,23 @@ uint8_t BSP_QSPI_Read(uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
   QSPI_CommandTypeDef sCommand;
 
   /* Initialize the read command */
-  sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
-  sCommand.Instruction       = QUAD_INOUT_FAST_READ_CMD;
-  sCommand.AddressMode       = QSPI_ADDRESS_4_LINES;
-  sCommand.AddressSize       = QSPI_ADDRESS_24_BITS;
-  sCommand.Address           = ReadAddr;
-  sCommand.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
-  sCommand.DataMode          = QSPI_DATA_4_LINES;
-  sCommand.DummyCycles       = N25Q128A_DUMMY_CYCLES_READ_QUAD;
-  sCommand.NbData            = Size;
+  sCommand.InstructionMode    = QSPI_INSTRUCTION_1_LINE;
+  sCommand.Instruction        = QSPI_Memory.ReadCmd;
+  sCommand.AddressMode        = QSPI_Memory.ReadAddressMode;
+  sCommand.AddressSize        = QSPI_Memory.AddressSize;
+  sCommand.Address            = ReadAddr;
+  sCommand.AlternateByteMode  = QSPI_Memory.ReadAlternateMode;
+  sCommand.AlternateBytesSize = QSPI_ALTERNATE_BYTES_8_BITS;
+  sCommand.AlternateBytes     = 0xFF;
+  sCommand.DataMode           = QSPI_Memory.ReadDataMode;
+  sCommand.DummyCycles        = QSPI_Memory.ReadDummyCycles;
+  sCommand.NbData             = Size;
   sCommand.DdrMode           = QSPI_DDR_MODE_DISABLE;
   sCommand.DdrHoldHalfCycle  = QSPI_DDR_HHC_ANALOG_DELAY;
   sCommand.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
 
   /* Configure the command */
-  if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return QSPI_ERROR;
   }
@@ -221,7 +320,7 @@ uint8_t BSP_QSPI_Write(uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
   uint32_t end_addr, current_size, current_addr;
 
   /* Calculation of the size between the write address and the end of the page */
-  current_size = N25Q128A_PAGE_SIZE - (WriteAddr % N25Q128A_PAGE_SIZE);
+  current_size = QSPI_Memory.PageSize - (WriteAddr % QSPI_Memory.PageSize);
 
   /* Check if the size of the data is less than the remaining place in the page */
   if (current_size > Size)
@@ -235,11 +334,11 @@ uint8_t BSP_QSPI_Write(uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
 
   /* Initialize the program command */
   sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
-  sCommand.Instruction       = EXT_QUAD_IN_FAST_PROG_CMD;
-  sCommand.AddressMode       = QSPI_ADDRESS_4_LINES;
-  sCommand.AddressSize       = QSPI_ADDRESS_24_BITS;
+  sCommand.Instruction       = QSPI_Memory.ProgCmd;
+  sCommand.AddressMode       = QSPI_Memory.ProgAddressMode;
+  sCommand.AddressSize       = QSPI_Memory.AddressSize;
   sCommand.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
-  sCommand.DataMode          = QSPI_DATA_4_LINES;
+  sCommand.DataMode          = QSPI_Memory.ProgDataMode;
   sCommand.DummyCycles       = 0;
   sCommand.DdrMode           = QSPI_DDR_MODE_DISABLE;
   sCommand.DdrHoldHalfCycle  = QSPI_DDR_HHC_ANALOG_DELAY;
@@ -258,7 +357,7 @@ uint8_t BSP_QSPI_Write(uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
     }
 
     /* Configure the command */
-    if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
     {
       return QSPI_ERROR;
     }
@@ -278,7 +377,7 @@ uint8_t BSP_QSPI_Write(uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
     /* Update the address and size variables for next page programming */
     current_addr += current_size;
     pData += current_size;
-    current_size = ((current_addr + N25Q128A_PAGE_SIZE) > end_addr) ? (end_addr - current_addr) : N25Q128A_PAGE_SIZE;
+    current_size = ((current_addr + QSPI_Memory.PageSize) > end_addr) ? (end_addr - current_addr) : QSPI_Memory.PageSize;
   }
   while (current_addr < end_addr);
 
@@ -296,9 +395,9 @@ uint8_t BSP_QSPI_Erase_Block(uint32_t BlockAddress)
 
   /* Initialize the erase command */
   sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
-  sCommand.Instruction       = SUBSECTOR_ERASE_CMD;
+  sCommand.Instruction       = QSPI_Memory.SubsectorEraseCmd;
   sCommand.AddressMode       = QSPI_ADDRESS_1_LINE;
-  sCommand.AddressSize       = QSPI_ADDRESS_24_BITS;
+  sCommand.AddressSize       = QSPI_Memory.AddressSize;
   sCommand.Address           = BlockAddress;
   sCommand.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
   sCommand.DataMode          = QSPI_DATA_NONE;
@@ -314,7 +413,7 @@ uint8_t BSP_QSPI_Erase_Block(uint32_t BlockAddress)
   }
 
   /* Send the command */
-  if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return QSPI_ERROR;
   }
@@ -342,16 +441,16 @@ uint8_t BSP_QSPI_Erase_Sector(uint32_t Sector)
 {
   QSPI_CommandTypeDef sCommand;
 
-  if (Sector >= (uint32_t)(N25Q128A_FLASH_SIZE / N25Q128A_SECTOR_SIZE))
+  if (Sector >= (uint32_t)(QSPI_Memory.FlashSize / N25Q128A_SECTOR_SIZE))
   {
     return QSPI_ERROR;
   }
 
   /* Initialize the erase command */
   sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
-  sCommand.Instruction       = SECTOR_ERASE_CMD;
+  sCommand.Instruction       = QSPI_Memory.SectorEraseCmd;
   sCommand.AddressMode       = QSPI_ADDRESS_1_LINE;
-  sCommand.AddressSize       = QSPI_ADDRESS_24_BITS;
+  sCommand.AddressSize       = QSPI_Memory.AddressSize;
   sCommand.Address           = (Sector * N25Q128A_SECTOR_SIZE);
   sCommand.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
   sCommand.DataMode          = QSPI_DATA_NONE;
@@ -367,7 +466,7 @@ uint8_t BSP_QSPI_Erase_Sector(uint32_t Sector)
   }
 
   /* Send the command */
-  if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return QSPI_ERROR;
   }
@@ -406,7 +505,7 @@ uint8_t BSP_QSPI_Erase_Chip(void)
   }
 
   /* Send the command */
-  if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return QSPI_ERROR;
   }
@@ -428,6 +527,17 @@ uint8_t BSP_QSPI_GetStatus(void)
 
   uint8_t reg;
 
+  /* Without flag status register, the status register only tells busy */
+  if (QSPI_Memory.SfdpCommands != 0)
+  {
+    if (QSPI_ReadRegister(&QSPIHandle, READ_STATUS_REG_CMD, &reg) != QSPI_OK)
+    {
+      return QSPI_ERROR;
+    }
+
+    return ((reg & N25Q128A_SR_WIP) != 0) ? QSPI_BUSY : QSPI_OK;
+  }
+
   /* Initialize the read flag status register command */
   sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
   sCommand.Instruction       = READ_FLAG_STATUS_REG_CMD;
@@ -441,7 +551,7 @@ uint8_t BSP_QSPI_GetStatus(void)
   sCommand.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
 
   /* Configure the command */
-  if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return QSPI_ERROR;
   }
@@ -479,11 +589,58 @@ uint8_t BSP_QSPI_GetStatus(void)
 uint8_t BSP_QSPI_GetInfo(QSPI_Info *pInfo)
 {
   /* Configure the structure with the memory configuration */
-  pInfo->FlashSize          = N25Q128A_FLASH_SIZE;
-  pInfo->EraseSectorSize    = N25Q128A_SUBSECTOR_SIZE;
-  pInfo->EraseSectorsNumber = (N25Q128A_FLASH_SIZE / N25Q128A_SUBSECTOR_SIZE);
-  pInfo->ProgPageSize       = N25Q128A_PAGE_SIZE;
-  pInfo->ProgPagesNumber    = (N25Q128A_FLASH_SIZE / N25Q128A_PAGE_SIZE);
+  pInfo->FlashSize          = QSPI_Memory.FlashSize;
+  pInfo->EraseSectorSize    = QSPI_Memory.SubsectorSize;
+  pInfo->EraseSectorsNumber = (QSPI_Memory.FlashSize / QSPI_Memory.SubsectorSize);
+  pInfo->ProgPageSize       = QSPI_Memory.PageSize;
+  pInfo->ProgPagesNumber    = (QSPI_Memory.FlashSize / QSPI_Memory.PageSize);
+
+  return QSPI_OK;
+}
+
+/**
+  * @brief  Waits for the end of the ongoing program/erase operation.
+  * @param  Timeout: Timeout for the operation, in ms
+  * @retval QSPI memory status
+  */
+uint8_t BSP_QSPI_WaitForReady(uint32_t Timeout)
+{
+  return QSPI_AutoPollingMemReady(&QSPIHandle, Timeout);
+}
+
+/**
+  * @brief  Return the time spent waiting for the memory by the last
+  *         program/erase operation.
+  * @retval Wait time in us
+  */
+uint32_t BSP_QSPI_GetWaitTime(void)
+{
+  return QSPI_WaitTime;
+}
+
+/**
+  * @brief  Return the number of commands sent to the QSPI memory, a status
+  *         polling counts as one command.
+  * @retval Commands since the algorithm was loaded
+  */
+uint32_t BSP_QSPI_GetCommandCount(void)
+{
+  return QSPI_Commands;
+}
+
+/**
+  * @brief  Return the parameters read from the SFDP of the QSPI memory.
+  * @param  pInfo: pointer on the SFDP parameters
+  * @retval QSPI memory status, QSPI_NOT_SUPPORTED when the memory has no SFDP
+  */
+uint8_t BSP_QSPI_GetSFDP(SFDP_InfoTypeDef *pInfo)
+{
+  if (QSPI_SfdpStatus != SFDP_OK)
+  {
+    return QSPI_NOT_SUPPORTED;
+  }
+
+  *pInfo = QSPI_Sfdp;
 
   return QSPI_OK;
 }
@@ -498,16 +655,18 @@ uint8_t BSP_QSPI_EnableMemoryMappedMode(void)
   QSPI_MemoryMappedTypeDef sMemMappedCfg;
 
   /* Configure the command for the read instruction */
-  sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
-  sCommand.Instruction       = QUAD_INOUT_FAST_READ_CMD;
-  sCommand.AddressMode       = QSPI_ADDRESS_4_LINES;
-  sCommand.AddressSize       = QSPI_ADDRESS_24_BITS;
-  sCommand.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
-  sCommand.DataMode          = QSPI_DATA_4_LINES;
-  sCommand.DummyCycles       = N25Q128A_DUMMY_CYCLES_READ_QUAD;
-  sCommand.DdrMode           = QSPI_DDR_MODE_DISABLE;
-  sCommand.DdrHoldHalfCycle  = QSPI_DDR_HHC_ANALOG_DELAY;
-  sCommand.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
+  sCommand.InstructionMode    = QSPI_INSTRUCTION_1_LINE;
+  sCommand.Instruction        = QSPI_Memory.ReadCmd;
+  sCommand.AddressMode        = QSPI_Memory.ReadAddressMode;
+  sCommand.AddressSize        = QSPI_Memory.AddressSize;
+  sCommand.AlternateByteMode  = QSPI_Memory.ReadAlternateMode;
+  sCommand.AlternateBytesSize = QSPI_ALTERNATE_BYTES_8_BITS;
+  sCommand.AlternateBytes     = 0xFF;
+  sCommand.DataMode           = QSPI_Memory.ReadDataMode;
+  sCommand.DummyCycles        = QSPI_Memory.ReadDummyCycles;
+  sCommand.DdrMode            = QSPI_DDR_MODE_DISABLE;
+  sCommand.DdrHoldHalfCycle   = QSPI_DDR_HHC_ANALOG_DELAY;
+  sCommand.SIOOMode           = QSPI_SIOO_INST_EVERY_CMD;
 
   /* Configure the memory mapped mode */
   sMemMappedCfg.TimeOutActivation = QSPI_TIMEOUT_COUNTER_DISABLE;
@@ -527,6 +686,12 @@ uint8_t BSP_QSPI_EnableMemoryMappedMode(void)
 uint8_t BSP_QSPI_SuspendErase(void)
 {
   QSPI_CommandTypeDef sCommand;
+  uint8_t status;
+
+  if (QSPI_Memory.EraseSuspendCmd == 0)
+  {
+    return QSPI_NOT_SUPPORTED;
+  }
 
   /* Check whether the device is busy (erase operation is
   in progress).
@@ -535,7 +700,7 @@ uint8_t BSP_QSPI_SuspendErase(void)
   {
     /* Initialize the erase command */
     sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
-    sCommand.Instruction       = PROG_ERASE_SUSPEND_CMD;
+    sCommand.Instruction       = QSPI_Memory.EraseSuspendCmd;
     sCommand.AddressMode       = QSPI_ADDRESS_NONE;
     sCommand.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
     sCommand.DataMode          = QSPI_DATA_NONE;
@@ -551,12 +716,21 @@ uint8_t BSP_QSPI_SuspendErase(void)
     }
 
     /* Send the command */
-    if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
     {
       return QSPI_ERROR;
     }
 
-    if (BSP_QSPI_GetStatus() == QSPI_SUSPENDED)
+    /* The device stays busy until the suspend latency has elapsed, the erase
+    may also have completed meanwhile.
+    */
+    if (QSPI_AutoPollingMemReady(&QSPIHandle, QSPI_SUSPEND_TIMEOUT) != QSPI_OK)
+    {
+      return QSPI_ERROR;
+    }
+
+    status = BSP_QSPI_GetStatus();
+    if ((status == QSPI_SUSPENDED) || (status == QSPI_OK))
     {
       return QSPI_OK;
     }
@@ -574,13 +748,16 @@ uint8_t BSP_QSPI_SuspendErase(void)
 uint8_t BSP_QSPI_ResumeErase(void)
 {
   QSPI_CommandTypeDef sCommand;
+  uint8_t status = BSP_QSPI_GetStatus();
 
-  /* Check whether the device is in suspended state */
-  if (BSP_QSPI_GetStatus() == QSPI_SUSPENDED)
+  /* Check whether the device is in suspended state, the status register
+  alone does not tell: the memories ignore the resume when not suspended.
+  */
+  if ((status == QSPI_SUSPENDED) || ((QSPI_Memory.SfdpCommands != 0) && (status == QSPI_OK)))
   {
     /* Initialize the erase command */
     sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
-    sCommand.Instruction       = PROG_ERASE_RESUME_CMD;
+    sCommand.Instruction       = QSPI_Memory.EraseResumeCmd;
     sCommand.AddressMode       = QSPI_ADDRESS_NONE;
     sCommand.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
     sCommand.DataMode          = QSPI_DATA_NONE;
@@ -596,7 +773,7 @@ uint8_t BSP_QSPI_ResumeErase(void)
     }
 
     /* Send the command */
-    if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
     {
       return QSPI_ERROR;
     }
@@ -607,7 +784,7 @@ uint8_t BSP_QSPI_ResumeErase(void)
     if the device is not in a suspended state.
     */
 
-    if (BSP_QSPI_GetStatus() == QSPI_BUSY)
+    if ((QSPI_Memory.SfdpCommands != 0) || (BSP_QSPI_GetStatus() == QSPI_BUSY))
     {
       return QSPI_OK;
     }
@@ -626,6 +803,21 @@ uint8_t BSP_QSPI_ResumeErase(void)
   * @{
   */
 
+/**
+  * @brief  Sends a command to the QSPI memory, counted for
+  *         BSP_QSPI_GetCommandCount().
+  * @param  hqspi: QSPI handle
+  * @param  cmd: structure that contains the command configuration
+  * @param  Timeout: Timeout duration
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef QSPI_Command(QSPI_HandleTypeDef *hqspi, QSPI_CommandTypeDef *cmd, uint32_t Timeout)
+{
+  QSPI_Commands++;
+
+  return HAL_QSPI_Command(hqspi, cmd, Timeout);
+}
+
 /**
   * @brief  Initializes the QSPI MSP.
   * @retval None
@@ -713,14 +905,14 @@ static uint8_t QSPI_ResetMemory(QSPI_HandleTypeDef *hqspi)
   sCommand.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
 
   /* Send the command */
-  if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return QSPI_ERROR;
   }
 
   /* Send the reset memory command */
   sCommand.Instruction = RESET_MEMORY_CMD;
-  if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return QSPI_ERROR;
   }
@@ -757,7 +949,7 @@ static uint8_t QSPI_DummyCyclesCfg(QSPI_HandleTypeDef *hqspi)
   sCommand.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
 
   /* Configure the command */
-  if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return QSPI_ERROR;
   }
@@ -779,7 +971,7 @@ static uint8_t QSPI_DummyCyclesCfg(QSPI_HandleTypeDef *hqspi)
   MODIFY_REG(reg, N25Q128A_VCR_NB_DUMMY, (N25Q128A_DUMMY_CYCLES_READ_QUAD << POSITION_VAL(N25Q128A_VCR_NB_DUMMY)));
 
   /* Configure the write volatile configuration register command */
-  if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return QSPI_ERROR;
   }
@@ -793,6 +985,339 @@ static uint8_t QSPI_DummyCyclesCfg(QSPI_HandleTypeDef *hqspi)
   return QSPI_OK;
 }
 
+/**
+  * @brief  This function reads the SFDP area of the QSPI memory.
+  * @param  Address: SFDP address
+  * @param  pData: Pointer to data to be read
+  * @param  Size: Size of data to read
+  * @retval SFDP status
+  */
+static uint8_t QSPI_ReadSFDP(uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  QSPI_CommandTypeDef sCommand;
+
+  /* Initialize the read SFDP command */
+  sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
+  sCommand.Instruction       = SFDP_READ_CMD;
+  sCommand.AddressMode       = QSPI_ADDRESS_1_LINE;
+  sCommand.AddressSize       = QSPI_ADDRESS_24_BITS;
+  sCommand.Address           = Address;
+  sCommand.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode          = QSPI_DATA_1_LINE;
+  sCommand.DummyCycles       = SFDP_DUMMY_CYCLES;
+  sCommand.NbData            = Size;
+  sCommand.DdrMode           = QSPI_DDR_MODE_DISABLE;
+  sCommand.DdrHoldHalfCycle  = QSPI_DDR_HHC_ANALOG_DELAY;
+  sCommand.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
+
+  /* Configure the command */
+  if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return SFDP_ERROR;
+  }
+
+  /* Reception of the data */
+  if (HAL_QSPI_Receive(&QSPIHandle, pData, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return SFDP_ERROR;
+  }
+
+  return SFDP_OK;
+}
+
+/**
+  * @brief  This function configures the driver and the memory from the SFDP
+  *         of the memory, read at the first call.
+  * @param  hqspi: QSPI handle
+  * @retval QSPI memory status
+  * @note   The geometry (size, page, erase types, address bytes) comes from
+  *         the SFDP whenever present. The read and program commands come
+  *         from it only when the quad enable requirements are known
+  *         (JESD216A), the N25Q128A commands are used otherwise.
+  */
+static uint8_t QSPI_MemoryCfg(QSPI_HandleTypeDef *hqspi)
+{
+  QSPI_CommandTypeDef      sCommand;
+  const SFDP_EraseTypeDef *erase;
+  uint8_t                  mode;
+
+  if (QSPI_SfdpStatus == 0xFF)
+  {
+    QSPI_SfdpStatus = SFDP_ReadInfo(QSPI_ReadSFDP, &QSPI_Sfdp);
+    if (QSPI_SfdpStatus == SFDP_ERROR)
+    {
+      QSPI_SfdpStatus = 0xFF;
+      return QSPI_ERROR;
+    }
+
+    if (QSPI_SfdpStatus == SFDP_OK)
+    {
+      /* The sectors of the loader are N25Q128A_SECTOR_SIZE */
+      erase = SFDP_GetEraseType(&QSPI_Sfdp, N25Q128A_SECTOR_SIZE);
+      if ((erase == NULL) || (erase->Size != N25Q128A_SECTOR_SIZE))
+      {
+        QSPI_SfdpStatus = 0xFF;
+        return QSPI_NOT_SUPPORTED;
+      }
+      QSPI_Memory.SectorEraseCmd = erase->Instruction;
+
+      erase = SFDP_GetEraseType(&QSPI_Sfdp, N25Q128A_SUBSECTOR_SIZE);
+      if (erase == NULL)
+      {
+        erase = SFDP_GetEraseType(&QSPI_Sfdp, N25Q128A_SECTOR_SIZE);
+      }
+      QSPI_Memory.SubsectorSize     = erase->Size;
+      QSPI_Memory.SubsectorEraseCmd = erase->Instruction;
+
+      QSPI_Memory.FlashSize       = QSPI_Sfdp.FlashSize;
+      QSPI_Memory.PageSize        = QSPI_Sfdp.PageSize;
+
+      /* Erase suspend and resume from DWORD 12 and 13 (JESD216A), the
+         N25Q128A table (JESD216, 9 DWORDs) does not describe them */
+      if (QSPI_Sfdp.Dwords >= 13U)
+      {
+        QSPI_Memory.EraseSuspendCmd = QSPI_Sfdp.EraseSuspend;
+        QSPI_Memory.EraseResumeCmd  = QSPI_Sfdp.EraseResume;
+      }
+
+      /* Above 16 MB: 4-byte addresses when the memory tells how to enter
+         them, the first 16 MB only otherwise */
+      if (QSPI_Memory.FlashSize > 0x1000000U)
+      {
+        if ((QSPI_Sfdp.AddressBytes == SFDP_ADDRESS_4) ||
+            ((QSPI_Sfdp.AddressBytes == SFDP_ADDRESS_3_OR_4) &&
+             ((QSPI_Sfdp.Enter4ByteAddress & (SFDP_4B_ENTER_B7 | SFDP_4B_ENTER_WREN_B7)) != 0U)))
+        {
+          QSPI_Memory.AddressSize = QSPI_ADDRESS_32_BITS;
+        }
+        else
+        {
+          QSPI_Memory.FlashSize = 0x1000000U;
+        }
+      }
+
+      if (QSPI_Sfdp.QuadEnable != SFDP_QE_UNKNOWN)
+      {
+        /* Fastest read mode without entering the QPI (4-4-4) mode, the
+           mode bits are sent as 0xFF when they fill a byte */
+        mode = SFDP_GetReadMode(&QSPI_Sfdp, SFDP_READ_MODE(SFDP_READ_1_1_2) | SFDP_READ_MODE(SFDP_READ_1_2_2) |
+                                            SFDP_READ_MODE(SFDP_READ_1_1_4) | SFDP_READ_MODE(SFDP_READ_1_4_4));
+
+        QSPI_Memory.ReadCmd         = QSPI_Sfdp.Read[mode].Instruction;
+        QSPI_Memory.ReadAddressMode = QSPI_ReadAddressMode[mode];
+        QSPI_Memory.ReadDataMode    = QSPI_ReadDataMode[mode];
+        if ((QSPI_Sfdp.Read[mode].ModeClocks * QSPI_ReadAddressLines[mode]) == 8U)
+        {
+          QSPI_Memory.ReadAlternateMode = QSPI_ReadAlternateMode[mode];
+          QSPI_Memory.ReadDummyCycles   = QSPI_Sfdp.Read[mode].DummyCycles;
+        }
+        else
+        {
+          QSPI_Memory.ReadAlternateMode = QSPI_ALTERNATE_BYTES_NONE;
+          QSPI_Memory.ReadDummyCycles   = QSPI_Sfdp.Read[mode].ModeClocks + QSPI_Sfdp.Read[mode].DummyCycles;
+        }
+
+        /* Page program, the only program command every memory has */
+        QSPI_Memory.ProgCmd         = PAGE_PROG_CMD;
+        QSPI_Memory.ProgAddressMode = QSPI_ADDRESS_1_LINE;
+        QSPI_Memory.ProgDataMode    = QSPI_DATA_1_LINE;
+        QSPI_Memory.SfdpCommands    = 1;
+      }
+    }
+  }
+
+  /* Memory-mapped range of the memory */
+  hqspi->Init.FlashSize = POSITION_VAL(QSPI_Memory.FlashSize) - 1;
+  MODIFY_REG(hqspi->Instance->DCR, QUADSPI_DCR_FSIZE, (hqspi->Init.FlashSize << QUADSPI_DCR_FSIZE_Pos));
+
+  if (QSPI_Memory.AddressSize == QSPI_ADDRESS_32_BITS)
+  {
+    /* The reset of the memory went back to 3-byte addresses */
+    if ((QSPI_Sfdp.AddressBytes != SFDP_ADDRESS_4) &&
+        ((QSPI_Sfdp.Enter4ByteAddress & SFDP_4B_ENTER_B7) == 0U) &&
+        (QSPI_WriteEnable(hqspi) != QSPI_OK))
+    {
+      return QSPI_ERROR;
+    }
+
+    if (QSPI_Sfdp.AddressBytes != SFDP_ADDRESS_4)
+    {
+      sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
+      sCommand.Instruction       = ENTER_4_BYTE_ADDR_CMD;
+      sCommand.AddressMode       = QSPI_ADDRESS_NONE;
+      sCommand.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
+      sCommand.DataMode          = QSPI_DATA_NONE;
+      sCommand.DummyCycles       = 0;
+      sCommand.DdrMode           = QSPI_DDR_MODE_DISABLE;
+      sCommand.DdrHoldHalfCycle  = QSPI_DDR_HHC_ANALOG_DELAY;
+      sCommand.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
+
+      if (QSPI_Command(hqspi, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+      {
+        return QSPI_ERROR;
+      }
+    }
+  }
+
+  if (QSPI_Memory.SfdpCommands != 0)
+  {
+    /* Dummy cycles at their reset value, as described by the SFDP */
+    return QSPI_QuadEnable(hqspi);
+  }
+
+  /* Configuration of the dummy cucles on QSPI memory side */
+  return QSPI_DummyCyclesCfg(hqspi);
+}
+
+/**
+  * @brief  This function sets the quad enable bit of the memory, as
+  *         described by its SFDP. Non volatile: written when not yet set.
+  * @param  hqspi: QSPI handle
+  * @retval QSPI memory status
+  */
+static uint8_t QSPI_QuadEnable(QSPI_HandleTypeDef *hqspi)
+{
+  uint8_t reg[2];
+
+  switch (QSPI_Sfdp.QuadEnable)
+  {
+  case SFDP_QE_SR1_BIT6:
+    if (QSPI_ReadRegister(hqspi, READ_STATUS_REG_CMD, &reg[0]) != QSPI_OK)
+    {
+      return QSPI_ERROR;
+    }
+    if ((reg[0] & 0x40U) != 0U)
+    {
+      return QSPI_OK;
+    }
+    reg[0] |= 0x40U;
+    return QSPI_WriteRegister(hqspi, WRITE_STATUS_REG_CMD, reg, 1);
+
+  case SFDP_QE_SR2_BIT7:
+    if (QSPI_ReadRegister(hqspi, READ_STATUS_REG2_3F_CMD, &reg[0]) != QSPI_OK)
+    {
+      return QSPI_ERROR;
+    }
+    if ((reg[0] & 0x80U) != 0U)
+    {
+      return QSPI_OK;
+    }
+    reg[0] |= 0x80U;
+    return QSPI_WriteRegister(hqspi, WRITE_STATUS_REG2_3E_CMD, reg, 1);
+
+  case SFDP_QE_SR2_BIT1_NORD:
+    /* Status register 2 cannot be read */
+    if (QSPI_ReadRegister(hqspi, READ_STATUS_REG_CMD, &reg[0]) != QSPI_OK)
+    {
+      return QSPI_ERROR;
+    }
+    reg[1] = 0x02U;
+    return QSPI_WriteRegister(hqspi, WRITE_STATUS_REG_CMD, reg, 2);
+
+  case SFDP_QE_SR2_BIT1:
+  case SFDP_QE_SR2_BIT1_35H:
+  case SFDP_QE_SR2_BIT1_31H:
+    if ((QSPI_ReadRegister(hqspi, READ_STATUS_REG_CMD, &reg[0]) != QSPI_OK) ||
+        (QSPI_ReadRegister(hqspi, READ_STATUS_REG2_CMD, &reg[1]) != QSPI_OK))
+    {
+      return QSPI_ERROR;
+    }
+    if ((reg[1] & 0x02U) != 0U)
+    {
+      return QSPI_OK;
+    }
+    reg[1] |= 0x02U;
+    if (QSPI_Sfdp.QuadEnable == SFDP_QE_SR2_BIT1_31H)
+    {
+      return QSPI_WriteRegister(hqspi, WRITE_STATUS_REG2_CMD, &reg[1], 1);
+    }
+    return QSPI_WriteRegister(hqspi, WRITE_STATUS_REG_CMD, reg, 2);
+
+  default:
+    /* No quad enable bit */
+    return QSPI_OK;
+  }
+}
+
+/**
+  * @brief  This function reads a one byte register of the memory.
+  * @param  hqspi: QSPI handle
+  * @param  Instruction: read register instruction
+  * @param  pReg: register value
+  * @retval QSPI memory status
+  */
+static uint8_t QSPI_ReadRegister(QSPI_HandleTypeDef *hqspi, uint8_t Instruction, uint8_t *pReg)
+{
+  QSPI_CommandTypeDef sCommand;
+
+  sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
+  sCommand.Instruction       = Instruction;
+  sCommand.AddressMode       = QSPI_ADDRESS_NONE;
+  sCommand.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode          = QSPI_DATA_1_LINE;
+  sCommand.DummyCycles       = 0;
+  sCommand.NbData            = 1;
+  sCommand.DdrMode           = QSPI_DDR_MODE_DISABLE;
+  sCommand.DdrHoldHalfCycle  = QSPI_DDR_HHC_ANALOG_DELAY;
+  sCommand.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
+
+  if (QSPI_Command(hqspi, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return QSPI_ERROR;
+  }
+
+  if (HAL_QSPI_Receive(hqspi, pReg, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return QSPI_ERROR;
+  }
+
+  return QSPI_OK;
+}
+
+/**
+  * @brief  This function writes registers of the memory and waits for the
+  *         end of the write.
+  * @param  hqspi: QSPI handle
+  * @param  Instruction: write register instruction
+  * @param  pReg: register values
+  * @param  Size: number of bytes to write
+  * @retval QSPI memory status
+  */
+static uint8_t QSPI_WriteRegister(QSPI_HandleTypeDef *hqspi, uint8_t Instruction, uint8_t *pReg, uint32_t Size)
+{
+  QSPI_CommandTypeDef sCommand;
+
+  sCommand.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
+  sCommand.Instruction       = Instruction;
+  sCommand.AddressMode       = QSPI_ADDRESS_NONE;
+  sCommand.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
+  sCommand.DataMode          = QSPI_DATA_1_LINE;
+  sCommand.DummyCycles       = 0;
+  sCommand.NbData            = Size;
+  sCommand.DdrMode           = QSPI_DDR_MODE_DISABLE;
+  sCommand.DdrHoldHalfCycle  = QSPI_DDR_HHC_ANALOG_DELAY;
+  sCommand.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
+
+  /* Enable write operations */
+  if (QSPI_WriteEnable(hqspi) != QSPI_OK)
+  {
+    return QSPI_ERROR;
+  }
+
+  if (QSPI_Command(hqspi, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return QSPI_ERROR;
+  }
+
+  if (HAL_QSPI_Transmit(hqspi, pReg, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return QSPI_ERROR;
+  }
+
+  /* Non volatile status register write */
+  return QSPI_AutoPollingMemReady(hqspi, HAL_QPSI_TIMEOUT_DEFAULT_VALUE);
+}
+
 /**
   * @brief  This function send a Write Enable and wait it is effective.
   * @param  hqspi: QSPI handle
@@ -814,7 +1339,7 @@ static uint8_t QSPI_WriteEnable(QSPI_HandleTypeDef *hqspi)
   sCommand.DdrHoldHalfCycle  = QSPI_DDR_HHC_ANALOG_DELAY;
   sCommand.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
 
-  if (HAL_QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (QSPI_Command(&QSPIHandle, &sCommand, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return QSPI_ERROR;
   }
@@ -830,6 +1355,7 @@ static uint8_t QSPI_WriteEnable(QSPI_HandleTypeDef *hqspi)
   sCommand.Instruction    = READ_STATUS_REG_CMD;
   sCommand.DataMode       = QSPI_DATA_1_LINE;
 
+  QSPI_Commands++;
   if (HAL_QSPI_AutoPolling(&QSPIHandle, &sCommand, &sConfig, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return QSPI_ERROR;
@@ -867,7 +1393,88 @@ static uint8_t QSPI_AutoPollingMemReady(QSPI_HandleTypeDef *hqspi, uint32_t Time
   sConfig.Interval        = 0x10;
   sConfig.AutomaticStop   = QSPI_AUTOMATIC_STOP_ENABLE;
 
-  if (HAL_QSPI_AutoPolling(&QSPIHandle, &sCommand, &sConfig, Timeout) != HAL_OK)
+  QSPI_Commands++;
+  if (HAL_QSPI_AutoPolling_IT(hqspi, &sCommand, &sConfig) != HAL_OK)
+  {
+    return QSPI_ERROR;
+  }
+
+  /* Sleep until the memory is ready */
+  return QSPI_WaitForMatch(hqspi, Timeout);
+}
+
+/**
+  * @brief  Sleeps until the automatic polling running on the QSPI matches.
+  * @param  hqspi: QSPI handle
+  * @param  Timeout: Timeout for the match, in ms
+  * @retval QSPI memory status
+  * @note   The status match and transfer error interrupts, as well as the
+  *         TIM6 update used as time reference, stay disabled in the NVIC:
+  *         they only wake the core up from WFE (SEVONPEND), no handler runs.
+  *         The measured wait is returned by BSP_QSPI_GetWaitTime().
+  */
+static uint8_t QSPI_WaitForMatch(QSPI_HandleTypeDef *hqspi, uint32_t Timeout)
+{
+  uint32_t overflow = 0;
+  uint32_t elapsed  = 0;
+  uint32_t period;
+
+  /* TIM6 free running at 1 MHz, updates every 65.536 ms, or when the
+     timeout expires for a shorter wait */
+  period = (Timeout < 64U) ? ((Timeout + 1U) * 1000U) : 0x10000U;
+  __HAL_RCC_TIM6_CLK_ENABLE();
+  TIM6->CR1  = 0;
+  TIM6->PSC  = (Tick_TimerClock() / 1000000U) - 1U;
+  TIM6->ARR  = period - 1U;
+  TIM6->EGR  = TIM_EGR_UG;
+  TIM6->SR   = 0;
+  TIM6->DIER = TIM_DIER_UIE;
+  TIM6->CR1  = TIM_CR1_CEN;
+
+  NVIC_DisableIRQ(QUADSPI_IRQn);
+  NVIC_DisableIRQ(TIM6_DAC_IRQn);
+  SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+
+  while ((__HAL_QSPI_GET_FLAG(hqspi, QSPI_FLAG_SM) == RESET) && (__HAL_QSPI_GET_FLAG(hqspi, QSPI_FLAG_TE) == RESET))
+  {
+    if ((TIM6->SR & TIM_SR_UIF) != 0U)
+    {
+      TIM6->SR = 0;
+      overflow++;
+    }
+
+    elapsed = (overflow * period) + TIM6->CNT;
+    if ((elapsed / 1000U) > Timeout)
+    {
+      break;
+    }
+
+    /* A flag raised after the test pends its interrupt, which sets the
+       event register: WFE returns immediately in that case */
+    NVIC_ClearPendingIRQ(QUADSPI_IRQn);
+    NVIC_ClearPendingIRQ(TIM6_DAC_IRQn);
+    __WFE();
+  }
+
+  TIM6->CR1  = 0;
+  TIM6->DIER = 0;
+  TIM6->SR   = 0;
+  NVIC_ClearPendingIRQ(QUADSPI_IRQn);
+  NVIC_ClearPendingIRQ(TIM6_DAC_IRQn);
+
+  QSPI_WaitTime = (overflow * period) + TIM6->CNT;
+
+  if ((__HAL_QSPI_GET_FLAG(hqspi, QSPI_FLAG_SM) == RESET) && (__HAL_QSPI_GET_FLAG(hqspi, QSPI_FLAG_TE) == RESET))
+  {
+    /* Timeout: stop the automatic polling */
+    HAL_QSPI_Abort(hqspi);
+    return QSPI_ERROR;
+  }
+
+  /* Let the HAL acknowledge the match and release the handle */
+  HAL_QSPI_IRQHandler(hqspi);
+
+  if (hqspi->ErrorCode != HAL_QSPI_ERROR_NONE)
   {
     return QSPI_ERROR;
   }
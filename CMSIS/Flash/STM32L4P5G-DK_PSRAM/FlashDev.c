@@ -19,11 +19,13 @@ struct FlashDevice const FlashDevice  =  {
    0x00001000,                   // Programming Page Size 4096 Bytes
    0x00,                         // Reserved, must be 0
    0xFF,                         // Initial Content of Erased Memory
-   10000,                        // Program Page Timeout 100 mSec
+   10000,                        // Program Page Timeout 10 Sec
    6000,                         // Erase Sector Timeout 6000 mSec
 
 // Specify Size and Address of Sectors
-   0x00800000, 0x000000,           
-   SECTOR_END
+   {
+     { 0x00800000, 0x000000 },
+     { SECTOR_END }
+   }
 };
 #endif // FLASH_MEM
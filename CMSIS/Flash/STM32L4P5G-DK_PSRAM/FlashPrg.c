@@ -40,6 +40,11 @@ int Init (unsigned long adr, unsigned long clk, unsigned long fnc) {
 #if defined FLASH_MEM || defined FLASH_OTP
 int UnInit (unsigned long fnc) {
 
+  /* The DMA writes leave the OSPI in indirect mode, the image stays readable
+     through the memory-mapped window after programming: the internal Flash
+     algorithm reads it there (ProgramStaged) */
+  if (fnc == 2 && Init_PSRAM () == 0)
+    return 1;
 
   return (0);
 }
@@ -95,13 +100,32 @@ int ProgramPage (unsigned long block_start, unsigned long size, unsigned char *b
 
 
 
+/*
+ *  Self-test of the PSRAM, the report is in PSRAM_TestReport
+ *    Parameter:      adr:  Start Address of the tested area
+ *                    sz:   Size (in bytes), the area is overwritten
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#ifdef PSRAM_SELF_TEST
+int SelfTest (unsigned long adr, unsigned long sz) {
+
+	if(SelfTest_PSRAM(adr ,sz)!=0)
+  return 0;
+	 else
+  return 1;
+}
+#endif
+
+
 unsigned long Verify (unsigned long adr, unsigned long sz, unsigned char *buf){
 	
 	
 	while (sz-->0)
 	{
-		if ( *(char*)adr++ != *((char*)buf++))
+		if ( *(char*)adr != *((char*)buf++))
 			return (adr);
+		adr++;
 	}
 		
   return adr;
@@ -20,6 +20,7 @@
   */
 
 #include "STM32L4PSRAM.h"
+#include "STM32L4Tick.h"
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -27,37 +28,267 @@
   * @{
   */
 
-void HAL_Delay(uint32_t Delay)
+static void Error_Handler(void)
 {
-  int i=0;
-  for (i=0; i<0x1000; i++);
+  /* User may add here some code to deal with this error */
+  while(1)
+  {
+  }
 }
- uint32_t HAL_GetTick(void)
+/**
+  * @brief   Configure the OSPI in memory-mapped mode, unless it already is:
+  *          the OSPI rejects commands in this mode.
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+static int Enter_MemoryMapped(void)
 {
+  if (HAL_OSPI_GetState(&OSPIPSRAMHandle) != HAL_OSPI_STATE_BUSY_MEM_MAPPED)
+  {
+    if (BSP_PSRAM_EnableMemoryMappedMode() != PSRAM_OK)
+      return 0;
+  }
+  return 1;
+}
 
+#if defined PSRAM_SELF_TEST
+/**
+  * @brief   Leave the memory-mapped mode for the indirect transfers.
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+static int Leave_MemoryMapped(void)
+{
+  if (HAL_OSPI_GetState(&OSPIPSRAMHandle) == HAL_OSPI_STATE_BUSY_MEM_MAPPED)
+  {
+    if (HAL_OSPI_Abort(&OSPIPSRAMHandle) != HAL_OK)
+      return 0;
+  }
   return 1;
 }
-static void Error_Handler(void)
+
+/**
+  * @brief   Wait for the end of an indirect DMA transfer, the core sleeps
+  *          in between.
+  * @param   State  : OSPI state of the transfer, HAL_OSPI_STATE_BUSY_TX/RX
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  * @note    The OSPI and DMA interrupts stay disabled in the NVIC: they only
+  *          wake the core up from WFE (SEVONPEND), the HAL handlers are
+  *          called from here. TIM6 times the wait and wakes the core up if
+  *          the transfer hangs.
+  */
+static int Wait_Transfer(uint32_t State)
 {
-  /* User may add here some code to deal with this error */
-  while(1)
+  Tick_WakeupStart();
+
+  while (HAL_OSPI_GetState(&OSPIPSRAMHandle) == State)
   {
+    /* The end of the DMA transfer hands over to the OSPI transfer complete */
+    if (HAL_DMA_GetState(OSPIPSRAMHandle.hdma) == HAL_DMA_STATE_BUSY)
+      HAL_DMA_IRQHandler(OSPIPSRAMHandle.hdma);
+    HAL_OSPI_IRQHandler(&OSPIPSRAMHandle);
+
+    if (Tick_WakeupElapsed() > TIMEOUT)
+    {
+      Tick_WakeupStop();
+      HAL_OSPI_Abort(&OSPIPSRAMHandle);
+      return 0;
+    }
+
+    /* A flag raised after the handlers pends its interrupt, which sets the
+       event register: WFE returns immediately in that case */
+    NVIC_ClearPendingIRQ(OCTOSPI1_IRQn);
+    NVIC_ClearPendingIRQ(PSRAM_DMAx_IRQn);
+    __WFE();
   }
+
+  Tick_WakeupStop();
+  NVIC_ClearPendingIRQ(OCTOSPI1_IRQn);
+  NVIC_ClearPendingIRQ(PSRAM_DMAx_IRQn);
+
+  if (HAL_OSPI_GetError(&OSPIPSRAMHandle) != HAL_OSPI_ERROR_NONE)
+    return 0;
+
+  return 1;
 }
-/** @defgroup STM32L4P5G_Disco_PSRAM_Exported_Functions Exported Functions
-  * @{
+
+/**
+  * @brief   Program memory, the DMA feeds the OSPI FIFO while the core
+  *          sleeps until the end of the transfer.
+  * @param   Address: page address
+  * @param   Size   : size of data
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
   */
+static int Write_DMA (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  /* The indirect write needs the memory-mapped mode to be left, Init_PSRAM
+     enables it again for the verification */
+  if (Leave_MemoryMapped() == 0)
+    return 0;
+
+  NVIC_DisableIRQ(OCTOSPI1_IRQn);
+  NVIC_DisableIRQ(PSRAM_DMAx_IRQn);
+  SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+
+  if (BSP_PSRAM_WriteData_DMA(Address & 0x0fffffff, buffer, Size) != PSRAM_OK)
+    return 0;
+
+  return Wait_Transfer(HAL_OSPI_STATE_BUSY_TX);
+}
+#endif /* PSRAM_SELF_TEST */
 
 /**
-  * @brief  Initializes the PSRAM interface.
-  * @param  Instance   PSRAM Instance
-  * @param  Init       PSRAM Init structure
-  * @retval BSP status
+  * @brief   Program memory, with stores into the memory-mapped window.
+  * @param   Address: page address
+  * @param   Size   : size of data
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
   */
- HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
-{ 
-  return HAL_OK;
+static int Write_Mapped (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  volatile uint32_t *word;
+  volatile uint8_t  *byte;
+  const uint32_t    *data;
+
+  if (Enter_MemoryMapped() == 0)
+    return 0;
+
+  byte = (volatile uint8_t *)(OCTOSPI1_BASE + (Address & 0x0fffffff));
+
+  /* Leading bytes up to the first word of the memory */
+  while ((((uint32_t)byte & 3U) != 0U) && (Size != 0U))
+  {
+    *byte++ = *buffer++;
+    Size--;
+  }
+
+  /* 32-bit stores, 8 at a time, when the buffer is aligned as well */
+  if (((uint32_t)buffer & 3U) == 0U)
+  {
+    word = (volatile uint32_t *)byte;
+    data = (const uint32_t *)buffer;
+
+    for (; Size >= 32U; Size -= 32U)
+    {
+      word[0] = data[0]; word[1] = data[1]; word[2] = data[2]; word[3] = data[3];
+      word[4] = data[4]; word[5] = data[5]; word[6] = data[6]; word[7] = data[7];
+      word += 8;
+      data += 8;
+    }
+
+    for (; Size >= 4U; Size -= 4U)
+    {
+      *word++ = *data++;
+    }
+
+    byte   = (volatile uint8_t *)word;
+    buffer = (uint8_t *)data;
+  }
+
+  /* Trailing bytes, the data strobe masks the other byte of the beat */
+  while (Size != 0U)
+  {
+    *byte++ = *buffer++;
+    Size--;
+  }
+
+  /* The stores are posted, the page is in the memory once they complete */
+  __DSB();
+
+  return 1;
+}
+
+#if defined PSRAM_SELF_TEST
+/**
+  * @brief   Read memory through the memory-mapped window.
+  * @param   Address: memory address
+  * @param   Size   : size of data
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+static int Read_Mapped (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  if (Enter_MemoryMapped() == 0)
+    return 0;
+
+  memcpy(buffer, (const void *)(OCTOSPI1_BASE + (Address & 0x0fffffff)), Size);
+  return 1;
+}
+
+/**
+  * @brief   Read memory with an indirect DMA transfer.
+  * @param   Address: memory address
+  * @param   Size   : size of data
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+static int Read_DMA (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  if (Leave_MemoryMapped() == 0)
+    return 0;
+
+  NVIC_DisableIRQ(OCTOSPI1_IRQn);
+  NVIC_DisableIRQ(PSRAM_DMAx_IRQn);
+  SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+
+  if (BSP_PSRAM_ReadData_DMA(Address & 0x0fffffff, buffer, Size) != PSRAM_OK)
+    return 0;
+
+  return Wait_Transfer(HAL_OSPI_STATE_BUSY_RX);
+}
+
+/**
+  * @brief   Program memory with an indirect transfer, the core feeds the FIFO.
+  * @param   Address: memory address
+  * @param   Size   : size of data
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+static int Write_Polling (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  if (Leave_MemoryMapped() == 0)
+    return 0;
+
+  return (BSP_PSRAM_WriteData(Address & 0x0fffffff, buffer, Size) == PSRAM_OK) ? 1 : 0;
 }
+
+/**
+  * @brief   Read memory with an indirect transfer, the core drains the FIFO.
+  * @param   Address: memory address
+  * @param   Size   : size of data
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+static int Read_Polling (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  if (Leave_MemoryMapped() == 0)
+    return 0;
+
+  return (BSP_PSRAM_ReadData(Address & 0x0fffffff, buffer, Size) == PSRAM_OK) ? 1 : 0;
+}
+#endif /* PSRAM_SELF_TEST */
+
+/**
+  * @}
+  */
+
+/** @defgroup STM32L4P5G_Disco_PSRAM_Exported_Functions Exported Functions
+  * @{
+  */
+
+#if defined PSRAM_SELF_TEST
+/* Report of the last self-test, read by the host */
+PSRAM_Test_ReportTypeDef PSRAM_TestReport;
+#endif
+
 /**
   * @brief  System initialization.
   * @param  None
@@ -66,7 +297,6 @@ static void Error_Handler(void)
   */
 int Init_PSRAM()
 { 
-  int32_t result=0;
  /*Initialisation*/ 
   SystemInit(); 
    HAL_Init();
@@ -77,10 +307,8 @@ int Init_PSRAM()
     if(BSP_PSRAM_Init() !=0)
     return 0;
 		
-  result=BSP_PSRAM_EnableMemoryMappedMode();  
-  if(result!=0)
-    return result;  
-   return 1;
+  /*Configure the OSPI in memory-mapped mode, for the whole session*/
+  return Enter_MemoryMapped();
 }
 
 /**
@@ -90,19 +318,46 @@ int Init_PSRAM()
   * @param   buffer : pointer to data buffer
   * @retval  1      : Operation succeeded
   * @retval  0      : Operation failed
+  * @note    The pages are written with CPU stores, the DMA path is only
+  *          measured against them by the self-test (PSRAM_SELF_TEST).
   */
-
-
  int Write (uint32_t Address, uint32_t Size, uint8_t* buffer)
 {
-  Address = Address & 0x0fffffff;
-  BSP_PSRAM_DeInit();
-	BSP_PSRAM_Init();
-    
-  BSP_PSRAM_WriteData(Address ,buffer, Size);
-  
-   return 1;
+  return Write_Mapped(Address, Size, buffer);
+}
+
+#if defined PSRAM_SELF_TEST
+/**
+  * @brief   Self-test of the memory: integrity tests, then bandwidth of the
+  *          polling, DMA and memory-mapped paths, in PSRAM_TestReport.
+  * @param   Address: start address of the tested area
+  * @param   Size   : size of the tested area
+  * @retval  1      : Operation succeeded, the memory passed the tests
+  * @retval  0      : Operation failed
+  * @note    The tested area is overwritten.
+  */
+int SelfTest_PSRAM (uint32_t Address, uint32_t Size)
+{
+  static const PSRAM_Test_PathTypeDef paths[PSRAM_TEST_PATHS] =
+  {
+    { Write_Polling, Read_Polling },   /* PSRAM_TEST_POLLING */
+    { Write_DMA,     Read_DMA     },   /* PSRAM_TEST_DMA     */
+    { Write_Mapped,  Read_Mapped  },   /* PSRAM_TEST_MAPPED  */
+  };
+  uint32_t status;
+
+  if (Enter_MemoryMapped() == 0)
+    return 0;
+
+  status = PSRAM_Test_Run(paths, OCTOSPI1_BASE + (Address & 0x0fffffff), Size, &PSRAM_TestReport);
+
+  /* Back to the mode of the session */
+  if (Enter_MemoryMapped() == 0)
+    return 0;
+
+  return (status == PSRAM_TEST_OK) ? 1 : 0;
 }
+#endif /* PSRAM_SELF_TEST */
 
  
 /**
@@ -247,7 +247,9 @@ uint8_t BSP_PSRAM_Init(void)
     OSPIPSRAMHandle.Init.ClockPrescaler        = 0x03;
     OSPIPSRAMHandle.Init.SampleShifting        = HAL_OSPI_SAMPLE_SHIFTING_NONE;
     OSPIPSRAMHandle.Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_ENABLE;
-    OSPIPSRAMHandle.Init.ChipSelectBoundary    = 1;//4;
+    /* Bursts of up to 128 bytes: the chip select stays low for less than
+       the 4 us tCEM of the memory, which refreshes while it is high */
+    OSPIPSRAMHandle.Init.ChipSelectBoundary    = 7;
     OSPIPSRAMHandle.Init.DelayBlockBypass      = HAL_OSPI_DELAY_BLOCK_USED;
     OSPIPSRAMHandle.Init.MaxTran               = 0;
 
@@ -362,7 +364,7 @@ uint8_t BSP_PSRAM_EnableMemoryMappedMode(void)
   sCommand.Address            = 0;
   sCommand.NbData             = 10;
 
-  sCommand.Instruction = WRITE_REG_CMD_SRAM;
+  sCommand.Instruction = WRITE_CMD_SRAM;
   sCommand.DummyCycles = DUMMY_CLOCK_CYCLES_SRAM_WRITE;
 
 
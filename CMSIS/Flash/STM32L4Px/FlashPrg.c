@@ -18,13 +18,19 @@
  * 3. This notice may not be removed or altered from any source distribution.
  *
  *
- * $Date:        28. March 2023
- * $Revision:    V1.3.0
+ * $Date:        19. October 2026
+ * $Revision:    V1.6.0
  *
  * Project:      Flash Programming Functions for ST STM32L4Px/Qx Flash
  * --------------------------------------------------------------------------- */
 
 /* History:
+ *  Version 1.6.0
+ *    Added ProgramScatter, programming of a descriptor list of regions (STM32L4Scatter.c)
+ *  Version 1.5.0
+ *    Added Benchmark, throughput report over a corpus of images (STM32L4Bench.c)
+ *  Version 1.4.0
+ *    Added ProgramStaged, programming from an image staged in external memory
  *  Version 1.3.0
  *    Reworked algorithms
  *    Added Single Bank configuration
@@ -39,6 +45,11 @@
    STM32L4Px devices have Dual Bank Flash configuration. */
 
 #include "..\FlashOS.h"        /* FlashOS Structures */
+#include "..\Common\STM32L4Bench.h"
+#include "..\Common\STM32L4Trace.h"
+#include "..\Common\STM32L4Scatter.h"
+
+extern struct FlashDevice const FlashDevice;
 
 typedef volatile unsigned long    vu32;
 typedef          unsigned long     u32;
@@ -396,6 +407,8 @@ int Init (unsigned long adr, unsigned long clk, unsigned long fnc)
     WWDG->CR  = 0x7F;
   }
 
+  TRACE_HCLK (clk);                                      /* The algorithm keeps the clock */
+
   return (0);
 }
 
@@ -460,6 +473,8 @@ int BlankCheck (unsigned long adr, unsigned long sz, unsigned char pat)
 #if defined FLASH_MEM
 int EraseChip (void)
 {
+  TRACE_BEGIN (TRACE_ERASE_CHIP, gFlashBase, gFlashSize);
+
   FLASH->SR = FLASH_PGERR;                               /* Reset Error Flags */
 
   FLASH->CR  = (FLASH_CR_MER1 | FLASH_CR_MER2);          /* Bank A/B mass erase enabled */
@@ -470,10 +485,10 @@ int EraseChip (void)
 
   if (FLASH->SR & FLASH_PGERR) {                         /* Check for Error */
     FLASH->SR  = FLASH_PGERR;                            /* Reset Error Flags */
-    return (1);                                          /* Failed */
+    return (TRACE_END (1));                              /* Failed */
   }
 
-  return (0);                                            /* Done */
+  return (TRACE_END (0));                                /* Done */
 }
 #endif /* FLASH_MEM */
 
@@ -498,6 +513,8 @@ int EraseSector (unsigned long adr)
 {
   u32 b, p;
 
+  TRACE_BEGIN (TRACE_ERASE_SECTOR, adr, gFlashPageSize);
+
   b = GetFlashBankNum(adr);                              /* Get Bank Number 0..1  */
   p = GetFlashPageNum(adr);                              /* Get Page Number 0..127 */
 
@@ -515,10 +532,10 @@ int EraseSector (unsigned long adr)
 
   if (FLASH->SR & FLASH_PGERR) {                         /* Check for Error */
     FLASH->SR  = FLASH_PGERR;                            /* Reset Error Flags */
-    return (1);                                          /* Failed */
+    return (TRACE_END (1));                              /* Failed */
   }
 
-  return (0);                                            /* Done */
+  return (TRACE_END (0));                                /* Done */
 }
 #endif /* FLASH_MEM */
 
@@ -545,6 +562,7 @@ int EraseSector (unsigned long adr)
 #if defined FLASH_MEM
 int ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf)
 {
+  TRACE_BEGIN (TRACE_PROGRAM, adr, sz);
 
   sz = (sz + 7) & ~7U;                                   /* Adjust size for four words */
 
@@ -573,7 +591,7 @@ int ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf)
 
     if (FLASH->SR & FLASH_PGERR) {                       /* Check for Error */
       FLASH->SR  = FLASH_PGERR;                          /* Reset Error Flags */
-      return (1);                                        /* Failed */
+      return (TRACE_END (1));                            /* Failed */
     }
 
     adr += 8;                                            /* Next double-word */
@@ -583,6 +601,73 @@ int ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf)
 
   FLASH->CR = 0U;                                        /* Reset CR */
 
+  return (TRACE_END (0));                                /* Done */
+}
+#endif /* FLASH_MEM */
+
+
+/*
+ *  Program Flash Memory from an Image staged in external Memory
+ *    Parameter:      adr:  Flash Start Address (Sector aligned)
+ *                    sz:   Image Size (in bytes)
+ *                    src:  Image Address, memory-mapped (FMC or OctoSPI PSRAM)
+ *    Return Value:   0 - OK,  1 - Failed
+ *
+ *  The host writes the whole image with the PSRAM algorithm, then calls this
+ *  function once after Init (fnc 2): the sectors are erased and programmed
+ *  without further debugger round trips. The PSRAM keeps the configuration
+ *  left by its algorithm, it is not initialized here.
+ */
+
+#if defined FLASH_MEM
+int ProgramStaged (unsigned long adr, unsigned long sz, unsigned long src)
+{
+  u32 n;
+
+  if (adr & (gFlashPageSize - 1U)) {                     /* Sector aligned start only */
+    return (1);                                          /* Failed */
+  }
+
+  while (sz)
+  {
+    n = (sz < gFlashPageSize) ? sz : gFlashPageSize;
+
+    if (EraseSector (adr) != 0) {
+      return (1);                                        /* Failed */
+    }
+    if (ProgramPage (adr, n, (unsigned char *)src) != 0) {
+      return (1);                                        /* Failed */
+    }
+
+    adr += n;                                            /* Next sector */
+    src += n;
+    sz  -= n;
+  }
+
+  return (0);                                            /* Done */
+}
+#endif /* FLASH_MEM */
+
+
+/*
+ *  Program the Regions of a Descriptor List downloaded in one Buffer (STM32L4Scatter.c)
+ *    Parameter:      cnt:  Number of Descriptors
+ *                    sz:   Buffer Size (in bytes)
+ *                    buf:  Descriptors, then the Data of the Regions
+ *    Return Value:   0 - OK,  1 - Failed
+ *
+ *  The small sections of an image (vectors, configuration, calibration, code)
+ *  are programmed in one call instead of one ProgramPage call each. The
+ *  regions are erased before and double-word aligned.
+ */
+
+#if defined FLASH_MEM
+int ProgramScatter (unsigned long cnt, unsigned long sz, unsigned char *buf)
+{
+  if (Scatter_Program (ProgramPage, cnt, sz, buf, FlashDevice.szPage, 8U) != 0U) {
+    return (1);                                          /* Failed */
+  }
+
   return (0);                                            /* Done */
 }
 #endif /* FLASH_MEM */
@@ -618,3 +703,28 @@ unsigned long Verify (unsigned long adr, unsigned long sz, unsigned char *buf)
   return (adr + sz);
 }
 #endif /* FLASH_OPT */
+
+/*
+ *  Benchmark the Programming Functions over a Corpus of Images (STM32L4Bench.c),
+ *  the Report is read from Bench_Report. The Flash Content is lost.
+ *    Parameter:      adr:  Start Address of the Images
+ *                    sz:   Size of the Images, 0 - whole Device
+ *                    clk:  HCLK Frequency (Hz), the algorithm keeps the clock
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#if defined FLASH_MEM && defined FLASH_BENCHMARK
+int Benchmark (unsigned long adr, unsigned long sz, unsigned long clk)
+{
+  /* Read back instead of Verify, the commands are not counted */
+  static const Bench_AlgoTypeDef algo = {
+    Init, UnInit, EraseSector, ProgramPage, NULL, NULL, NULL
+  };
+
+  if (Bench_Run (&algo, &FlashDevice, adr, sz, clk) != BENCH_OK) {
+    return (1);                                          /* Failed */
+  }
+
+  return (0);                                            /* Done */
+}
+#endif /* FLASH_MEM && FLASH_BENCHMARK */
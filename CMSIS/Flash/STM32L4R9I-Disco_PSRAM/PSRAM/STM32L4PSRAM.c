@@ -19,6 +19,7 @@
   ******************************************************************************
   */
 #include "STM32L4PSRAM.h"
+#include "STM32L4Tick.h"
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -26,16 +27,6 @@
   * @{
   */
 
-void HAL_Delay(uint32_t Delay)
-{
-  int i=0;
-  for (i=0; i<0x1000; i++);
-}
- uint32_t HAL_GetTick(void)
-{
-
-  return 1;
-}
 static void Error_Handler(void)
 {
   /* User may add here some code to deal with this error */
@@ -47,16 +38,6 @@ static void Error_Handler(void)
   * @{
   */
 
-/**
-  * @brief  Initializes the PSRAM interface.
-  * @param  Instance   PSRAM Instance
-  * @param  Init       PSRAM Init structure
-  * @retval BSP status
-  */
- HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
-{ 
-  return HAL_OK;
-}
 /**
   * @brief  System initialization.
   * @param  None
@@ -81,35 +62,256 @@ int Init_PSRAM()
 }
 
 /**
-  * @brief   Program memory.
+  * @brief   Program the bytes around the words, with 8-bit and 16-bit stores.
+  * @param   Address: address
+  * @param   Size   : size of data, below 4 bytes
+  * @param   buffer : pointer to data buffer
+  */
+static void Write_Bytes (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  if (((Address & 1U) == 0U) && (Size >= 2U))
+  {
+    *(__IO uint16_t *)Address = (uint16_t)(buffer[0] | (buffer[1] << 8));
+    Address += 2U;
+    buffer  += 2U;
+    Size    -= 2U;
+  }
+  for (; Size != 0U; Size--)
+    *(__IO uint8_t *)Address++ = *buffer++;
+}
+
+#if defined PSRAM_SELF_TEST
+/**
+  * @brief   Wait for the end of a DMA transfer, the core sleeps in between.
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  * @note    The DMA interrupt stays disabled in the NVIC: it only wakes the
+  *          core up from WFE (SEVONPEND), the HAL handler is called from here.
+  *          TIM6 times the wait and wakes the core up if the DMA hangs.
+  */
+static int Wait_DMA (void)
+{
+  Tick_WakeupStart();
+
+  while (HAL_DMA_GetState(psramHandle.hdma) == HAL_DMA_STATE_BUSY)
+  {
+    HAL_DMA_IRQHandler(psramHandle.hdma);
+
+    if (Tick_WakeupElapsed() > TIMEOUT)
+    {
+      Tick_WakeupStop();
+      HAL_DMA_Abort(psramHandle.hdma);
+      psramHandle.State = HAL_SRAM_STATE_READY;
+      return 0;
+    }
+
+    /* A flag raised after the handler pends its interrupt, which sets the
+       event register: WFE returns immediately in that case */
+    NVIC_ClearPendingIRQ(PSRAM_DMAx_IRQn);
+    __WFE();
+  }
+
+  Tick_WakeupStop();
+  NVIC_ClearPendingIRQ(PSRAM_DMAx_IRQn);
+
+  if (HAL_DMA_GetError(psramHandle.hdma) != HAL_DMA_ERROR_NONE)
+    return 0;
+
+  return 1;
+}
+
+/**
+  * @brief   Program memory, the DMA copies the page to the FMC bank while
+  *          the core sleeps until the end of the transfer.
   * @param   Address: page address
   * @param   Size   : size of data
   * @param   buffer : pointer to data buffer
   * @retval  1      : Operation succeeded
   * @retval  0      : Operation failed
   */
+static int Write_DMA (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  uint32_t words = Size / 4U;
+
+  /* Word transfers, a misaligned address or buffer is written by the core */
+  if (((Address | (uint32_t)buffer) & 3U) != 0U)
+  {
+    for (; Size != 0U; Size--)
+      *(__IO uint8_t *)Address++ = *buffer++;
+    return 1;
+  }
 
+  if (words != 0U)
+  {
+    NVIC_DisableIRQ(PSRAM_DMAx_IRQn);
+    SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+
+    /* The DMA sizes are in words */
+    if (BSP_PSRAM_WriteData_DMA(Address, (uint16_t*)buffer, words) != PSRAM_OK)
+      return 0;
+
+    if (Wait_DMA() == 0)
+      return 0;
+  }
+
+  /* Trailing bytes of a size that is not a multiple of 4 */
+  Write_Bytes(Address + words * 4U, Size & 3U, buffer + words * 4U);
+
+  return 1;
+}
+#endif /* PSRAM_SELF_TEST */
 
+/**
+  * @brief   Program memory, with 32-bit stores posted to the FMC write FIFO.
+  * @param   Address: page address
+  * @param   Size   : size of data
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+static int Write_Mapped (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  __IO uint32_t *dst;
+  uint32_t count = (Address & 3U) ? (4U - (Address & 3U)) : 0U;
+
+  /* Leading bytes up to a word address */
+  if (count > Size)
+    count = Size;
+  Write_Bytes(Address, count, buffer);
+  Address += count;
+  buffer  += count;
+  Size    -= count;
+
+  /* Each word is two halfword beats of the 16-bit bus, in one burst */
+  dst = (__IO uint32_t *)Address;
+  if (((uint32_t)buffer & 3U) == 0U)
+  {
+    const uint32_t *src = (const uint32_t *)buffer;
+
+    for (; Size >= 4U; Size -= 4U)
+      *dst++ = *src++;
+    buffer = (uint8_t *)src;
+  }
+  else
+  {
+    for (; Size >= 4U; Size -= 4U)
+    {
+      *dst++ = (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) |
+               ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+      buffer += 4U;
+    }
+  }
+
+  /* Trailing bytes */
+  Write_Bytes((uint32_t)dst, Size, buffer);
+
+  /* The stores are posted, the page is in the memory once they complete */
+  __DSB();
+
+  return 1;
+}
+
+#if defined PSRAM_SELF_TEST
+/**
+  * @brief   Read memory with core loads from the FMC bank.
+  * @param   Address: memory address
+  * @param   Size   : size of data
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  */
+static int Read_Mapped (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  memcpy(buffer, (const void *)Address, Size);
+  return 1;
+}
+
+/**
+  * @brief   Read memory with a word DMA transfer, Address, buffer and Size
+  *          multiples of 4.
+  * @param   Address: memory address
+  * @param   Size   : size of data
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+static int Read_DMA (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  NVIC_DisableIRQ(PSRAM_DMAx_IRQn);
+  SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+
+  if (BSP_PSRAM_ReadData_DMA(Address, (uint16_t*)buffer, Size / 4U) != PSRAM_OK)
+    return 0;
+
+  return Wait_DMA();
+}
+
+/**
+  * @brief   Program memory with the HAL halfword polling loop.
+  * @param   Address: memory address
+  * @param   Size   : size of data, multiple of 2
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+static int Write_Polling (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  return (BSP_PSRAM_WriteData(Address, (uint16_t*)buffer, Size / 2U) == PSRAM_OK) ? 1 : 0;
+}
+
+/**
+  * @brief   Read memory with the HAL halfword polling loop.
+  * @param   Address: memory address
+  * @param   Size   : size of data, multiple of 2
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  */
+static int Read_Polling (uint32_t Address, uint32_t Size, uint8_t* buffer)
+{
+  return (BSP_PSRAM_ReadData(Address, (uint16_t*)buffer, Size / 2U) == PSRAM_OK) ? 1 : 0;
+}
+
+/* Report of the last self-test, read by the host */
+PSRAM_Test_ReportTypeDef PSRAM_TestReport;
+#endif /* PSRAM_SELF_TEST */
+
+/**
+  * @brief   Program memory.
+  * @param   Address: page address
+  * @param   Size   : size of data
+  * @param   buffer : pointer to data buffer
+  * @retval  1      : Operation succeeded
+  * @retval  0      : Operation failed
+  * @note    The pages are written with CPU stores, the DMA path is only
+  *          measured against them by the self-test (PSRAM_SELF_TEST).
+  */
  int Write (uint32_t Address, uint32_t Size, uint8_t* buffer)
 {
+  return Write_Mapped(Address, Size, buffer);
+}
 
-//	 __IO uint32_t write_pointer = (uint32_t)Address;
-//  
-//  /* while there is data to write */
-//  for (; Size != 0; Size--) 
-//  {
-//    /* Transfer data to the memory */
-//    *(uint16_t *) ( write_pointer) = *(uint16_t*)buffer++;
-
-//    /* Increment the address*/
-//    write_pointer += 2;
-//  }
-  
-	
-	BSP_PSRAM_WriteData(Address ,(uint16_t*)buffer, Size);
-  
-   return 1;
+#if defined PSRAM_SELF_TEST
+/**
+  * @brief   Self-test of the memory: integrity tests, then bandwidth of the
+  *          polling, DMA and memory-mapped paths, in PSRAM_TestReport.
+  * @param   Address: start address of the tested area
+  * @param   Size   : size of the tested area
+  * @retval  1      : Operation succeeded, the memory passed the tests
+  * @retval  0      : Operation failed
+  * @note    The tested area is overwritten.
+  */
+int SelfTest_PSRAM (uint32_t Address, uint32_t Size)
+{
+  static const PSRAM_Test_PathTypeDef paths[PSRAM_TEST_PATHS] =
+  {
+    { Write_Polling, Read_Polling },   /* PSRAM_TEST_POLLING */
+    { Write_DMA,     Read_DMA     },   /* PSRAM_TEST_DMA     */
+    { Write_Mapped,  Read_Mapped  },   /* PSRAM_TEST_MAPPED  */
+  };
+
+  return (PSRAM_Test_Run(paths, Address, Size, &PSRAM_TestReport) == PSRAM_TEST_OK) ? 1 : 0;
 }
+#endif /* PSRAM_SELF_TEST */
 
 /**
   * @brief  System Clock Configuration
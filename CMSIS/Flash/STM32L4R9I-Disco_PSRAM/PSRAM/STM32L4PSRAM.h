@@ -23,17 +23,29 @@
 
 
 /* Includes ------------------------------------------------------------------*/
-#include "stm32L4xx_hal.h"
+#include "stm32l4xx_hal.h"
 #include "stm32l4r9i_discovery_psram.h"
 #include <string.h>
 #include "stdint.h"
 #define TIMEOUT 5000U
 
+/* Uncomment this line to add the self-test (SelfTest entry) to the
+   algorithm, it overwrites the tested area */
+/* #define PSRAM_SELF_TEST */
+
+#if defined PSRAM_SELF_TEST
+#include "STM32L4PSRAMTest.h"
+#endif
+
 
 
 /* Private function prototypes -----------------------------------------------*/
 int Init_PSRAM(void);
 int Write (uint32_t Address, uint32_t Size, uint8_t* buffer);
+#if defined PSRAM_SELF_TEST
+int SelfTest_PSRAM (uint32_t Address, uint32_t Size);
+extern PSRAM_Test_ReportTypeDef PSRAM_TestReport;
+#endif
 static void SystemClock_Config(void);
 static void Error_Handler(void);
 #endif
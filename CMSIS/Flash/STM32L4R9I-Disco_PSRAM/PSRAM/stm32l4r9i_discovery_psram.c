@@ -26,7 +26,10 @@
        BSP_PSRAM_ReadData()/BSP_PSRAM_WriteData(), or by DMA transfer using the functions
        BSP_PSRAM_ReadData_DMA()/BSP_PSRAM_WriteData_DMA().
      o The AHB access is performed with 16-bit width transaction, the DMA transfer
-       configuration is fixed at single (no burst) halfword transfer.
+       configuration is fixed at single (no burst) word transfer: the DMA sizes
+       are in words.
+     o With PSRAM_BURSTACCESS or PSRAM_WRITEBURST enabled, BSP_PSRAM_Init()
+       switches the memory to its synchronous burst mode before the FMC.
      o User can implement his own functions for read/write access with his desired
        configurations.
      o If interrupt mode is used for DMA transfer, the function BSP_PSRAM_DMA_IRQHandler()
@@ -71,6 +74,10 @@ SRAM_HandleTypeDef psramHandle = {0};
 /* LCD/PSRAM initialization status sharing the same power source */
 static uint32_t bsp_lcd_initialized;
 
+/* PSRAM power status, the MFX power sequence is done once: the algorithm
+   calls BSP_PSRAM_Init for each of the erase, program and verify steps */
+static uint32_t bsp_psram_powered;
+
 
 /**
   * @}
@@ -81,6 +88,8 @@ static uint32_t bsp_lcd_initialized;
   */
 static void PSRAM_PowerOn(void);
 static void PSRAM_PowerOff(void);
+static void PSRAM_WriteBCR(uint16_t Value);
+static void PSRAM_SetTiming(FMC_NORSRAM_TimingTypeDef *Timing);
 /**
   * @}
   */
@@ -100,20 +109,17 @@ uint8_t BSP_PSRAM_Init(void)
 
     static FMC_NORSRAM_TimingTypeDef Timing;
 	
-bsp_lcd_initialized=1;
+    /* The MFX drivers are not part of the algorithm, the rails are left as
+       the board powers them, like when the LCD has been initialized */
+    bsp_lcd_initialized=1;
+
     /* Power on PSRAM */
     PSRAM_PowerOn();
 
     /* PSRAM device configuration */
-    /* Timing configuration derived from system clock (up to 120Mhz)
-    for 60Mhz as PSRAM clock frequency */
-    Timing.AddressSetupTime      = 4;
-    Timing.AddressHoldTime       = 2;
-    Timing.DataSetupTime         = 6;
-    Timing.BusTurnAroundDuration = 1;
-    Timing.CLKDivision           = 2;
-    Timing.DataLatency           = 2;
-    Timing.AccessMode        = FMC_ACCESS_MODE_A;
+    /* Timing configuration derived from the system clock and the PSRAM
+    timing limits, the tightest the memory accepts */
+    PSRAM_SetTiming(&Timing);
 
     psramHandle.Init.NSBank             = FMC_NORSRAM_BANK1;
     psramHandle.Init.DataAddressMux     = FMC_DATA_ADDRESS_MUX_DISABLE;
@@ -128,7 +134,7 @@ bsp_lcd_initialized=1;
     psramHandle.Init.AsynchronousWait   = FMC_ASYNCHRONOUS_WAIT_DISABLE;
     psramHandle.Init.WriteBurst         = FMC_WRITE_BURST_DISABLE;
     psramHandle.Init.ContinuousClock    = FMC_CONTINUOUS_CLOCK_SYNC_ASYNC;
-    psramHandle.Init.WriteFifo          = FMC_WRITE_FIFO_DISABLE;
+    psramHandle.Init.WriteFifo          = PSRAM_WRITEFIFO;
     psramHandle.Init.NBLSetupTime       = 0;
     psramHandle.Init.PageSize           = FMC_PAGE_SIZE_NONE;
 
@@ -148,6 +154,29 @@ bsp_lcd_initialized=1;
       psram_status = PSRAM_OK;
     }
 
+    if((psram_status == PSRAM_OK) &&
+       ((PSRAM_BURSTACCESS == FMC_BURST_ACCESS_MODE_ENABLE) || (PSRAM_WRITEBURST == FMC_WRITE_BURST_ENABLE)))
+    {
+      /* The bus configuration register is written with asynchronous
+         accesses, the FMC follows the memory in synchronous mode */
+      PSRAM_WriteBCR(PSRAM_BCR_SYNC);
+
+      /* The NWAIT signal inserts the variable latency (DATLAT must be 0
+         for a CRAM), the clock division is set by PSRAM_SetTiming */
+      Timing.DataLatency           = 2;
+
+      psramHandle.Init.BurstAccessMode    = PSRAM_BURSTACCESS;
+      psramHandle.Init.WriteBurst         = PSRAM_WRITEBURST;
+      psramHandle.Init.WaitSignal         = FMC_WAIT_SIGNAL_ENABLE;
+      psramHandle.Init.ContinuousClock    = CONTINUOUSCLOCK_FEATURE;
+
+      /* The handle is initialized, the MSP is not configured again */
+      if(HAL_SRAM_Init(&psramHandle, &Timing, &Timing) != HAL_OK)
+      {
+        psram_status = PSRAM_ERROR;
+      }
+    }
+
 
   return psram_status;
 }
@@ -207,7 +236,7 @@ uint8_t BSP_PSRAM_ReadData(uint32_t uwStartAddress, uint16_t *pData, uint32_t uw
   * @brief  Reads an amount of data from the PSRAM device in DMA mode.
   * @param  uwStartAddress: Read start address
   * @param  pData: Pointer to data to be read
-  * @param  uwDataSize: Size of read data from the memory
+  * @param  uwDataSize: Size of read data from the memory, in words
   * @retval PSRAM status
   */
 uint8_t BSP_PSRAM_ReadData_DMA(uint32_t uwStartAddress, uint16_t *pData, uint32_t uwDataSize)
@@ -245,7 +274,7 @@ uint8_t BSP_PSRAM_WriteData(uint32_t uwStartAddress, uint16_t *pData, uint32_t u
   * @brief  Writes an amount of data from the PSRAM device in DMA mode.
   * @param  uwStartAddress: Write start address
   * @param  pData: Pointer to data to be written
-  * @param  uwDataSize: Size of written data from the memory
+  * @param  uwDataSize: Size of written data from the memory, in words
   * @retval PSRAM status
   */
 uint8_t BSP_PSRAM_WriteData_DMA(uint32_t uwStartAddress, uint16_t *pData, uint32_t uwDataSize)
@@ -362,8 +391,8 @@ __weak void BSP_PSRAM_MspInit(SRAM_HandleTypeDef  *hsram, void *Params)
   dma_handle.Init.Direction           = DMA_MEMORY_TO_MEMORY;
   dma_handle.Init.PeriphInc           = DMA_PINC_ENABLE;
   dma_handle.Init.MemInc              = DMA_MINC_ENABLE;
-  dma_handle.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
-  dma_handle.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
+  dma_handle.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  dma_handle.Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
   dma_handle.Init.Mode                = DMA_NORMAL;
   dma_handle.Init.Priority            = DMA_PRIORITY_HIGH;
 
@@ -375,8 +404,9 @@ __weak void BSP_PSRAM_MspInit(SRAM_HandleTypeDef  *hsram, void *Params)
   /* Configure the DMA Channel */
   HAL_DMA_Init(&dma_handle);
 
-  /* Associate the DMA handle to the FMC SRAM one */
-  hsram->hdma = &dma_handle;
+  /* Associate the DMA handle to the FMC SRAM one, the transfer complete
+     callback reaches the SRAM handle through the DMA parent */
+  __HAL_LINKDMA(hsram, hdma, dma_handle);
 
   HAL_NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_0);
 
@@ -430,8 +460,10 @@ __weak void BSP_PSRAM_MspDeInit(SRAM_HandleTypeDef  *hsram, void *Params)
   */
 static void PSRAM_PowerOn(void)
 {
-  /* Configure DSI_RESET and DSI_POWER_ON only if lcd is not currently used */
-  if(bsp_lcd_initialized == 0)
+  /* Configure DSI_RESET and DSI_POWER_ON only if lcd is not currently used,
+     and once: the I2C transactions and the 16 ms of delays are skipped when
+     the PSRAM is already powered */
+  if((bsp_lcd_initialized == 0) && (bsp_psram_powered == 0))
   {
     BSP_IO_Init();
 
@@ -473,9 +505,81 @@ static void PSRAM_PowerOn(void)
 
     /* Wait at least 15 ms (minimum reset low width is 10ms and add margin for 1V8_LCD ramp-up) */
     HAL_Delay(15);
+
+    bsp_psram_powered = 1;
   }
 }
 
+/**
+  * @brief  Compute the FMC timings from the HCLK frequency and the PSRAM
+  *         timing limits: mode A for the asynchronous accesses, and the
+  *         fastest PSRAM clock for the synchronous burst mode.
+  * @param  Timing: FMC timings to fill
+  */
+static void PSRAM_SetTiming(FMC_NORSRAM_TimingTypeDef *Timing)
+{
+  uint32_t khz = HAL_RCC_GetHCLKFreq() / 1000U;
+  uint32_t addset, datast;
+
+  /* HCLK cycles covering a time in ns, rounded up */
+#define PSRAM_CYCLES(ns)  ((((ns) * khz) + 999999U) / 1000000U)
+
+  /* The read strobe covers the cycle time with the address setup, the write
+     strobe (DATAST + 1 HCLK) also covers the WE# pulse width */
+  addset = PSRAM_CYCLES(PSRAM_T_AS_NS);
+  datast = PSRAM_CYCLES(PSRAM_T_RC_NS);
+  datast = (datast > addset) ? (datast - addset) : 1U;
+  if (datast < PSRAM_CYCLES(PSRAM_T_WP_NS))
+  {
+    datast = PSRAM_CYCLES(PSRAM_T_WP_NS);
+  }
+
+  Timing->AddressSetupTime      = (addset > 15U) ? 15U : addset;
+  Timing->AddressHoldTime       = 1;
+  Timing->DataSetupTime         = (datast > 255U) ? 255U : datast;
+  Timing->BusTurnAroundDuration = (PSRAM_CYCLES(PSRAM_T_HZ_NS) > 15U) ? 15U : PSRAM_CYCLES(PSRAM_T_HZ_NS);
+
+  /* PSRAM clock HCLK/2 at most */
+  Timing->CLKDivision           = ((khz * 1000U) + PSRAM_CLK_MAX_HZ - 1U) / PSRAM_CLK_MAX_HZ;
+  if (Timing->CLKDivision < 2U)
+  {
+    Timing->CLKDivision = 2U;
+  }
+  if (Timing->CLKDivision > 16U)
+  {
+    Timing->CLKDivision = 16U;
+  }
+  Timing->DataLatency           = 2;
+  Timing->AccessMode            = FMC_ACCESS_MODE_A;
+
+#undef PSRAM_CYCLES
+}
+
+/**
+  * @brief  Write the bus configuration register of the PSRAM with the
+  *         software access sequence: two reads and two writes at the last
+  *         address, the second write selecting the BCR, then the value.
+  *         The FMC must be in asynchronous mode.
+  * @param  Value: bus configuration register value
+  */
+static void PSRAM_WriteBCR(uint16_t Value)
+{
+  __IO uint16_t *last = (__IO uint16_t *)(PSRAM_DEVICE_ADDR + PSRAM_DEVICE_SIZE - 2U);
+  uint16_t data;
+
+  data = *last;
+  data = *last;
+  *last = 1U;
+  *last = 1U;
+  *last = Value;
+
+  /* The write FIFO posts the stores, the read back drains it before the FMC
+     is reconfigured */
+  __DSB();
+  data = *last;
+  (void)data;
+}
+
 /**
   * @brief  PSRAM power off
   *         Power off PSRAM.
@@ -492,6 +596,7 @@ static void PSRAM_PowerOff(void)
     BSP_IO_ConfigPin(IO_PIN_8, IO_MODE_ANALOG);
 #endif /* USE_STM32L4R9I_DISCO_REVA || USE_STM32L4R9I_DISCO_REVB */
 
+    bsp_psram_powered = 0;
 }
 
 /**
@@ -54,19 +54,40 @@
 #define PSRAM_DEVICE_ADDR  ((uint32_t)0x60000000)
 #define PSRAM_DEVICE_SIZE  ((uint32_t)0x400000)  /* PSRAM device size in Bytes */
 
+/* IS66WVC2M16ECLL-7010 timing limits, the FMC timings are derived from
+   them and the HCLK frequency at BSP_PSRAM_Init */
+#define PSRAM_T_AS_NS         0U           /* Address setup to WE#/OE#, tAS  */
+#define PSRAM_T_RC_NS         70U          /* Read/write cycle, tRC/tWC      */
+#define PSRAM_T_WP_NS         45U          /* WE# pulse width, tWP           */
+#define PSRAM_T_HZ_NS         8U           /* CE# high to bus high-Z, tHZ    */
+#define PSRAM_CLK_MAX_HZ      104000000U   /* Synchronous burst clock        */
+
 /* #define SRAM_MEMORY_WIDTH    FMC_NORSRAM_MEM_BUS_WIDTH_8*/
 #define PSRAM_MEMORY_WIDTH    FMC_NORSRAM_MEM_BUS_WIDTH_16
 
-#define PSRAM_BURSTACCESS     FMC_BURST_ACCESS_MODE_DISABLE
-/* #define PSRAM_BURSTACCESS     FMC_BURST_ACCESS_MODE_ENABLE*/
+/* Synchronous burst mode. Not measured on a board: from the timings at
+   HCLK = 110 MHz, about 20 MB/s in asynchronous mode A and 31 MB/s in
+   32-bit bursts at 55 MHz. The self-test (PSRAM_SELF_TEST) measures it:
+   PSRAM_TestReport.Bandwidth[PSRAM_TEST_MAPPED].SeqWrite, with these two
+   switches enabled, then both disabled */
+/* #define PSRAM_BURSTACCESS     FMC_BURST_ACCESS_MODE_DISABLE */
+#define PSRAM_BURSTACCESS     FMC_BURST_ACCESS_MODE_ENABLE
 
-#define PSRAM_WRITEBURST      FMC_WRITE_BURST_DISABLE
-/* #define PSRAM_WRITEBURST     FMC_WRITE_BURST_ENABLE */
+/* #define PSRAM_WRITEBURST      FMC_WRITE_BURST_DISABLE */
+#define PSRAM_WRITEBURST     FMC_WRITE_BURST_ENABLE
 
 #define CONTINUOUSCLOCK_FEATURE    FMC_CONTINUOUS_CLOCK_SYNC_ONLY
 /* #define CONTINUOUSCLOCK_FEATURE     FMC_CONTINUOUS_CLOCK_SYNC_ASYNC */
 
-/* DMA definitions for SRAM DMA transfer */
+#define PSRAM_WRITEFIFO       FMC_WRITE_FIFO_ENABLE
+/* #define PSRAM_WRITEFIFO      FMC_WRITE_FIFO_DISABLE */
+
+/* Bus configuration register of the synchronous burst mode: variable latency
+   code 3, WAIT active high one clock before the data, continuous burst
+   without wrap. The memory is in asynchronous mode at power up. */
+#define PSRAM_BCR_SYNC        ((uint16_t)0x1D1F)
+
+/* DMA definitions for SRAM DMA transfer, single word transfers */
 #define __PSRAM_DMAx_CLK_ENABLE            __HAL_RCC_DMA2_CLK_ENABLE
 #define __PSRAM_DMAx_CLK_DISABLE           __HAL_RCC_DMA2_CLK_DISABLE
 #define PSRAM_DMAx_INSTANCE                DMA2_Channel3
@@ -0,0 +1,76 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Flash Device Description for ST STM32L4R9I internal Flash and
+ *               MX25LM51245G OctoSPI Flash
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+#include "..\FlashOS.H"        // FlashOS Structures
+
+#ifdef FLASH_MEM
+
+/* One device from the internal Flash to the end of the OctoSPI Flash,
+   the gap between them is a single sector that is never programmed:
+   BlankCheck reports it blank and EraseSector leaves it alone */
+
+/* The internal sectors follow the bank mode (FLASH_OPTR DBANK): 4kB in
+   Dual Bank mode, 8kB in Single Bank mode (STM32L4Rx_2048_SB). Init fails
+   when the option bytes do not match the variant. */
+#ifdef STM32L4Rx_2048_SB
+  #define INTERNAL_SECTOR_SIZE  0x02000  // Sector Size   8kB, Internal Flash (256 Sectors)
+  #define INTERNAL_BANK_NAME    "2MB Single Bank"
+#else
+  #define INTERNAL_SECTOR_SIZE  0x01000  // Sector Size   4kB, Internal Flash (512 Sectors)
+  #define INTERNAL_BANK_NAME    "2MB Dual Bank"
+#endif
+
+struct FlashDevice const FlashDevice  =  {
+   FLASH_DRV_VERS,             // Driver Version, do not modify!
+#ifdef STM32L4R9I_DK
+   "STM32L4R9I-DK " INTERNAL_BANK_NAME " + OSPI1",     // Device Name
+#endif
+#ifdef STM32L4R9I_EVAL
+   "STM32L4R9I-EVAL " INTERNAL_BANK_NAME " + OSPI1",   // Device Name
+#endif
+   ONCHIP,                     // Device Type
+   0x08000000,                   // Device Start Address
+   0x8C000000,                   // Device Size in Bytes (up to 0x94000000)
+   0x00001000,                   // Programming Page Size 4096 Bytes
+   0x00,                         // Reserved, must be 0
+   0xFF,                         // Initial Content of Erased Memory
+   10000,                        // Program Page Timeout 10 Sec
+   6000,                         // Erase Sector Timeout 6000 mSec
+
+// Specify Size and Address of Sectors
+   INTERNAL_SECTOR_SIZE, 0x00000000, // Internal Flash
+   0x87E00000, 0x00200000,       // Gap up to the OctoSPI Flash, not programmable
+   0x10000,    0x88000000,       // Sector Size  64kB, OctoSPI Flash (1024 Sectors)
+   SECTOR_END
+};
+
+#endif // FLASH_MEM
@@ -0,0 +1,318 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Flash Programming Functions for ST STM32L4R9I internal Flash
+ *               and MX25LM51245G OctoSPI Flash
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+#include "..\FlashOS.H"
+#include "STM32L4OSPI.h"
+#include "STM32L4Trace.h"
+#include "STM32L4Scatter.h"
+#include "STM32L4Bench.h"
+
+extern struct FlashDevice const FlashDevice;
+
+/* Memories of the composite device, dispatched by address */
+#define INTERNAL_BASE   0x08000000
+#define INTERNAL_SIZE   0x00200000
+#define OSPI_BASE       0x90000000
+#define OSPI_SIZE       0x04000000
+
+#define IS_INTERNAL(adr)  (((adr) >= INTERNAL_BASE) && ((adr) < (INTERNAL_BASE + INTERNAL_SIZE)))
+#define IS_OSPI(adr)      (((adr) >= OSPI_BASE) && ((adr) < (OSPI_BASE + OSPI_SIZE)))
+#define IS_GAP(adr)       (((adr) >= (INTERNAL_BASE + INTERNAL_SIZE)) && ((adr) < OSPI_BASE))
+
+/* STM32L4Rx internal Flash Programming Functions (InternalFlash.c) */
+extern int Internal_Init        (unsigned long adr, unsigned long clk, unsigned long fnc);
+extern int Internal_UnInit      (unsigned long fnc);
+extern int Internal_BlankCheck  (unsigned long adr, unsigned long sz, unsigned char pat);
+extern int Internal_EraseChip   (void);
+extern int Internal_EraseSector (unsigned long adr);
+extern int Internal_ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf);
+
+static unsigned long SectorSize (unsigned long adr);
+
+/*
+ *  Initialize Flash Programming Functions
+ *    Parameter:      adr:  Device Base Address
+ *                    clk:  Clock Frequency (Hz)
+ *                    fnc:  Function Code (1 - Erase, 2 - Program, 3 - Verify)
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#ifdef FLASH_MEM
+int Init (unsigned long adr, unsigned long clk, unsigned long fnc) {
+
+  (void)adr;
+  (void)clk;
+
+  TRACE_BEGIN (TRACE_INIT, adr, fnc);
+
+  /* The system clock and the OctoSPI are configured once for both
+     memories, the internal Flash then only needs to be unlocked */
+  if (Init_OSPI () == 0)
+    return TRACE_END (1);
+
+  /* FlashDev.c is fixed at build time, the memory found must hold it */
+  if (CheckDevice_OSPI (OSPI_SIZE, SectorSize (OSPI_BASE)) == 0)
+    return TRACE_END (1);
+
+  /* and the internal sectors must be those of the bank mode */
+  if (SectorSize (INTERNAL_BASE) != (((FLASH->OPTR & FLASH_OPTR_DBANK) != 0U) ? 0x1000U : 0x2000U))
+    return TRACE_END (1);
+
+  /* The internal Flash algorithm traces HCLK from its clk */
+  return TRACE_END (Internal_Init (INTERNAL_BASE, SystemCoreClock, fnc));
+}
+#endif
+
+
+/*
+ *  De-Initialize Flash Programming Functions
+ *    Parameter:      fnc:  Function Code (1 - Erase, 2 - Program, 3 - Verify)
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#ifdef FLASH_MEM
+int UnInit (unsigned long fnc) {
+
+  TRACE_BEGIN (TRACE_UNINIT, 0, fnc);
+
+  if (Internal_UnInit (fnc) != 0)
+    return TRACE_END (1);
+
+  /* The last page program ends here, the memory is left idle and
+     memory-mapped */
+  if (UnInit_OSPI () == 0)
+    return TRACE_END (1);
+
+  return TRACE_END (0);
+}
+#endif
+
+
+/*
+ *  Blank Check Checks if Memory is Blank
+ *    Parameter:      adr:  Block Start Address
+ *                    sz:   Block Size (in bytes)
+ *                    pat:  Block Pattern
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#ifdef FLASH_MEM
+int BlankCheck (unsigned long adr, unsigned long sz, unsigned char pat) {
+
+  TRACE_BEGIN (TRACE_BLANK_CHECK, adr, sz);
+
+  if (IS_INTERNAL (adr))
+    return TRACE_END (Internal_BlankCheck (adr, sz, pat));
+
+  /* The gap is no memory, nothing to erase there */
+  if (IS_GAP (adr))
+    return TRACE_END (0);
+
+  /* A blank sector is not erased again */
+  if (IS_OSPI (adr) && BlankCheck_OSPI (adr, sz, pat) == 1)
+    return TRACE_END (0);
+
+  return TRACE_END (1);
+}
+#endif
+
+
+/*
+ *  Erase complete Flash Memory
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#ifdef FLASH_MEM
+int EraseChip (void) {
+
+  TRACE_BEGIN (TRACE_ERASE_CHIP, 0, 0);
+
+  if (Internal_EraseChip () != 0)
+    return TRACE_END (1);
+
+  return TRACE_END (MassErase ());
+}
+#endif
+
+
+/*
+ *  Erase Sector in Flash Memory
+ *    Parameter:      adr:  Sector Address
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#ifdef FLASH_MEM
+/*
+ *  Size of the Sector at an Address, from the Device Description
+ *    Parameter:      adr:  Sector Address
+ *    Return Value:   Sector Size (in bytes)
+ */
+
+static unsigned long SectorSize (unsigned long adr) {
+  const struct FlashSectors *sector;
+  unsigned long size = 0;
+
+  adr -= FlashDevice.DevAdr;
+  for (sector = FlashDevice.sectors; sector->szSector != 0xFFFFFFFF; sector++) {
+    if (sector->AddrSector > adr)
+      break;
+    size = sector->szSector;
+  }
+
+  return size;
+}
+
+int EraseSector (unsigned long adr) {
+  unsigned long size = SectorSize (adr);
+
+  TRACE_BEGIN (TRACE_ERASE_SECTOR, adr, size);
+
+  if (IS_INTERNAL (adr))
+    return TRACE_END (Internal_EraseSector (adr));
+
+  /* The gap sector is declared only to keep the device contiguous */
+  if (IS_GAP (adr))
+    return TRACE_END (0);
+
+  /* Exactly the sector declared in FlashDev.c, nothing more */
+  if (IS_OSPI (adr) && SectorErase ((uint32_t) adr, (uint32_t) (adr + size)) == 1)
+    return TRACE_END (0);
+
+  return TRACE_END (1);
+}
+#endif
+
+
+/*
+ *  Program Page in Flash Memory
+ *    Parameter:      adr:  Page Start Address
+ *                    sz:   Page Size
+ *                    buf:  Page Data
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#ifdef FLASH_MEM
+int ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf) {
+
+  TRACE_BEGIN (TRACE_PROGRAM, adr, sz);
+
+  if (IS_INTERNAL (adr))
+    return TRACE_END (Internal_ProgramPage (adr, sz, buf));
+
+  if (IS_OSPI (adr) && Write (adr, sz, buf) != 0)
+    return TRACE_END (0);
+
+  return TRACE_END (1);
+}
+
+
+/*
+ *  Verify Flash Contents, both memories are memory-mapped
+ *    Parameter:      adr:  Start Address
+ *                    sz:   Size (in bytes)
+ *                    buf:  Data
+ *    Return Value:   (adr+sz) - OK, Failed Address
+ */
+
+unsigned long Verify (unsigned long adr, unsigned long sz, unsigned char *buf) {
+
+  TRACE_BEGIN (TRACE_VERIFY, adr, sz);
+
+  while (sz-- > 0) {
+    if (*(volatile unsigned char *)adr != *buf++)
+      return TRACE_END (adr);
+    adr++;
+  }
+
+  return TRACE_END (adr);
+}
+#endif
+
+
+/*
+ *  Program the Regions of a Descriptor List downloaded in one Buffer (STM32L4Scatter.c)
+ *    Parameter:      cnt:  Number of Descriptors
+ *                    sz:   Buffer Size (in bytes)
+ *                    buf:  Descriptors, then the Data of the Regions
+ *    Return Value:   0 - OK,  1 - Failed
+ *
+ *  The regions may be in both memories, each page goes to the memory of its
+ *  address. They are erased before and double-word aligned, as the internal
+ *  Flash needs.
+ */
+
+#ifdef FLASH_MEM
+int ProgramScatter (unsigned long cnt, unsigned long sz, unsigned char *buf) {
+
+  if (Scatter_Program (ProgramPage, cnt, sz, buf, FlashDevice.szPage, 8U) != 0U) {
+    return (1);                                         /* Failed */
+  }
+
+  return (0);                                           /* Done */
+}
+#endif
+
+
+/*
+ *  Benchmark the Programming Functions over a Corpus of Images (STM32L4Bench.c),
+ *  the Report is read from Bench_Report. The Memory Content is lost.
+ *    Parameter:      adr:  Start Address of the Images
+ *                    sz:   Size of the Images, not 0: the device spans a gap
+ *                    clk:  Clock Frequency (Hz)
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#if defined FLASH_MEM && defined FLASH_BENCHMARK
+static uint32_t BenchCommands (void) {
+  return (BusCount.Commands);
+}
+
+static uint32_t BenchClock (void) {
+  return (SystemCoreClock);
+}
+
+int Benchmark (unsigned long adr, unsigned long sz, unsigned long clk) {
+  static const Bench_AlgoTypeDef Algo = {
+    Init, UnInit, EraseSector, ProgramPage, Verify, BenchCommands, BenchClock
+  };
+
+  /* The images stay in the memory of adr */
+  if (sz == 0 || !((IS_INTERNAL (adr) && IS_INTERNAL (adr + sz - 1)) ||
+                   (IS_OSPI (adr) && IS_OSPI (adr + sz - 1))))
+    return 1;
+
+  if (Bench_Run (&Algo, &FlashDevice, adr, sz, clk) == BENCH_OK)
+    return 0;
+
+  return 1;
+}
+#endif
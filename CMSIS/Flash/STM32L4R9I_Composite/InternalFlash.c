@@ -0,0 +1,43 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Internal Flash part of the ST STM32L4R9I composite algorithm
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/* The STM32L4Rx algorithm defines its own register types, it is built in a
+   translation unit of its own, away from the CMSIS device header */
+#define Init           Internal_Init
+#define UnInit         Internal_UnInit
+#define BlankCheck     Internal_BlankCheck
+#define EraseChip      Internal_EraseChip
+#define EraseSector    Internal_EraseSector
+#define ProgramPage    Internal_ProgramPage
+#define ProgramScatter Internal_ProgramScatter
+#define Benchmark      Internal_Benchmark
+
+#include "..\STM32L4Rx\FlashPrg.c"
@@ -18,13 +18,15 @@
  * 3. This notice may not be removed or altered from any source distribution.
  *
  *
- * $Date:        28. March 2023
- * $Revision:    V1.1.0
+ * $Date:        19. October 2026
+ * $Revision:    V1.2.0
  *
  * Project:      Flash Device Description for ST STM32L4Rx/Sx Flash
  * --------------------------------------------------------------------------- */
 
 /* History:
+ *  Version 1.2.0
+ *    Added large page variants (FLASH_LARGE_PAGE)
  *  Version 1.1.0
  *    Reworked algorithms
  *    Added Single Bank configuration
@@ -34,20 +36,32 @@
 
 #include "..\FlashOS.h"                /* FlashOS Structures */
 
+/* The large page variants (FLASH_LARGE_PAGE) program 16 kB per ProgramPage
+   call instead of 1 kB: the buffer still fits the 32 kB RAM of the algorithm */
+#ifdef FLASH_LARGE_PAGE
+  #define FLASH_PAGE_SIZE     0x4000         /* Programming Page Size 16 kB */
+  #define FLASH_PAGE_TIMEOUT  3000           /* Program Page Timeout 3 Sec */
+  #define FLASH_PAGE_NAME     ", 16kB Page"
+#else
+  #define FLASH_PAGE_SIZE     1024           /* Programming Page Size 1 kB */
+  #define FLASH_PAGE_TIMEOUT  400            /* Program Page Timeout 400 mSec */
+  #define FLASH_PAGE_NAME     ""
+#endif
+
 
 #ifdef FLASH_MEM
 
 #ifdef STM32L4Rx_2048_DB
   struct FlashDevice const FlashDevice  =  {
     FLASH_DRV_VERS,                    /* Driver Version, do not modify! */
-    "STM32L4Rx 2MB Dual Bank Flash",   /* Device Name */
+    "STM32L4Rx 2MB Dual Bank Flash" FLASH_PAGE_NAME, /* Device Name */
     ONCHIP,                            /* Device Type */
     0x08000000,                        /* Device Start Address */
     0x00200000,                        /* Device Size in Bytes (2048 kB) */
-    1024,                              /* Programming Page Size */
+    FLASH_PAGE_SIZE,                   /* Programming Page Size */
     0,                                 /* Reserved, must be 0 */
     0xFF,                              /* Initial Content of Erased Memory */
-    400,                               /* Program Page Timeout 400 mSec */
+    FLASH_PAGE_TIMEOUT,                /* Program Page Timeout */
     400,                               /* Erase Sector Timeout 400 mSec */
     /* Specify Size and Address of Sectors */
     0x1000, 0x000000,                  /* Sector Size  4kB (512 Sectors) */
@@ -58,14 +72,14 @@
 #ifdef STM32L4Rx_2048_SB
   struct FlashDevice const FlashDevice  =  {
     FLASH_DRV_VERS,                    /* Driver Version, do not modify! */
-    "STM32L4Rx 2MB Single Bank Flash", /* Device Name */
+    "STM32L4Rx 2MB Single Bank Flash" FLASH_PAGE_NAME, /* Device Name */
     ONCHIP,                            /* Device Type */
     0x08000000,                        /* Device Start Address */
     0x00200000,                        /* Device Size in Bytes (2048 kB) */
-    1024,                              /* Programming Page Size */
+    FLASH_PAGE_SIZE,                   /* Programming Page Size */
     0,                                 /* Reserved, must be 0 */
     0xFF,                              /* Initial Content of Erased Memory */
-    400,                               /* Program Page Timeout 400 mSec */
+    FLASH_PAGE_TIMEOUT,                /* Program Page Timeout */
     400,                               /* Erase Sector Timeout 400 mSec */
     /* Specify Size and Address of Sectors */
     0x2000, 0x000000,                  /* Sector Size  8kB (256 Sectors) */
@@ -76,14 +90,14 @@
 #ifdef STM32L4Rx_1024_DB
   struct FlashDevice const FlashDevice  =  {
     FLASH_DRV_VERS,                    /* Driver Version, do not modify! */
-    "STM32L4Rx 1MB Dual Bank Flash",   /* Device Name */
+    "STM32L4Rx 1MB Dual Bank Flash" FLASH_PAGE_NAME, /* Device Name */
     ONCHIP,                            /* Device Type */
     0x08000000,                        /* Device Start Address */
     0x00100000,                        /* Device Size in Bytes (1024 kB) */
-    1024,                              /* Programming Page Size */
+    FLASH_PAGE_SIZE,                   /* Programming Page Size */
     0,                                 /* Reserved, must be 0 */
     0xFF,                              /* Initial Content of Erased Memory */
-    400,                               /* Program Page Timeout 400 mSec */
+    FLASH_PAGE_TIMEOUT,                /* Program Page Timeout */
     400,                               /* Erase Sector Timeout 400 mSec */
     /* Specify Size and Address of Sectors */
     0x1000, 0x000000,                  /* Sector Size  4kB (256 Sectors) */
@@ -94,14 +108,14 @@
 #ifdef STM32L4Rx_1024_SB
   struct FlashDevice const FlashDevice  =  {
     FLASH_DRV_VERS,                    /* Driver Version, do not modify! */
-    "STM32L4Rx 1MB Single Bank Flash", /* Device Name */
+    "STM32L4Rx 1MB Single Bank Flash" FLASH_PAGE_NAME, /* Device Name */
     ONCHIP,                            /* Device Type */
     0x08000000,                        /* Device Start Address */
     0x00100000,                        /* Device Size in Bytes (1024 kB) */
-    1024,                              /* Programming Page Size */
+    FLASH_PAGE_SIZE,                   /* Programming Page Size */
     0,                                 /* Reserved, must be 0 */
     0xFF,                              /* Initial Content of Erased Memory */
-    400,                               /* Program Page Timeout 400 mSec */
+    FLASH_PAGE_TIMEOUT,                /* Program Page Timeout */
     400,                               /* Erase Sector Timeout 400 mSec */
     /* Specify Size and Address of Sectors */
     0x2000, 0x000000,                  /* Sector Size  8kB (128 Sectors) */
@@ -18,13 +18,15 @@
  * 3. This notice may not be removed or altered from any source distribution.
  *
  *
- * $Date:        29. March 2017
- * $Revision:    V1.1.0
+ * $Date:        19. October 2026
+ * $Revision:    V1.2.0
  *
  * Project:      Flash Device Description for ST STM32L4xx Flash
  * --------------------------------------------------------------------------- */
 
 /* History:
+ *  Version 1.2.0
+ *    Added large page variants (FLASH_LARGE_PAGE)
  *  Version 1.1.0
  *    Added OPT Algorithms
  *  Version 1.0.0
@@ -33,19 +35,31 @@
 
 #include "..\FlashOS.h"        // FlashOS Structures
 
+// The large page variants (FLASH_LARGE_PAGE) program 8 kB per ProgramPage
+// call instead of 1 kB: the buffer still fits the 32 kB RAM of the algorithm
+#ifdef FLASH_LARGE_PAGE
+  #define FLASH_PAGE_SIZE     0x2000    // Programming Page Size 8 kB
+  #define FLASH_PAGE_TIMEOUT  3000      // Program Page Timeout 3 Sec
+  #define FLASH_PAGE_NAME     ", 8kB Page"
+#else
+  #define FLASH_PAGE_SIZE     1024      // Programming Page Size 1 kB
+  #define FLASH_PAGE_TIMEOUT  400       // Program Page Timeout 400 mSec
+  #define FLASH_PAGE_NAME     ""
+#endif
+
 #ifdef FLASH_MEM
 
 #ifdef STM32L4x_1024
   struct FlashDevice const FlashDevice  =  {
     FLASH_DRV_VERS,             // Driver Version, do not modify!
-    "STM32L4xx 1MB Flash",      // Device Name (1024kB)
+    "STM32L4xx 1MB Flash" FLASH_PAGE_NAME, // Device Name (1024kB)
     ONCHIP,                     // Device Type
     0x08000000,                 // Device Start Address
     0x00100000,                 // Device Size in Bytes (1024kB)
-    1024,                       // Programming Page Size
+    FLASH_PAGE_SIZE,            // Programming Page Size
     0,                          // Reserved, must be 0
     0xFF,                       // Initial Content of Erased Memory
-    400,                        // Program Page Timeout 400 mSec
+    FLASH_PAGE_TIMEOUT,         // Program Page Timeout
     400,                        // Erase Sector Timeout 400 mSec
     // Specify Size and Address of Sectors
     0x800, 0x000000,            // Sector Size  2kB
@@ -56,14 +70,14 @@
 #ifdef STM32L4x_512
   struct FlashDevice const FlashDevice  =  {
     FLASH_DRV_VERS,             // Driver Version, do not modify!
-    "STM32L4xx 512 KB Flash",   // Device Name (512kB)
+    "STM32L4xx 512 KB Flash" FLASH_PAGE_NAME, // Device Name (512kB)
     ONCHIP,                     // Device Type
     0x08000000,                 // Device Start Address
     0x00080000,                 // Device Size in Bytes (512kB)
-    1024,                       // Programming Page Size
+    FLASH_PAGE_SIZE,            // Programming Page Size
     0,                          // Reserved, must be 0
     0xFF,                       // Initial Content of Erased Memory
-    400,                        // Program Page Timeout 400 mSec
+    FLASH_PAGE_TIMEOUT,         // Program Page Timeout
     400,                        // Erase Sector Timeout 400 mSec
     // Specify Size and Address of Sectors
     0x800, 0x000000,             // Sector Size  2kB
@@ -74,14 +88,14 @@
 #ifdef STM32L4x_256
   struct FlashDevice const FlashDevice  =  {
     FLASH_DRV_VERS,             // Driver Version, do not modify!
-    "STM32L4xx 256 KB Flash",   // Device Name (256kB)
+    "STM32L4xx 256 KB Flash" FLASH_PAGE_NAME, // Device Name (256kB)
     ONCHIP,                     // Device Type
     0x08000000,                 // Device Start Address
     0x00040000,                 // Device Size in Bytes (256kB)
-    1024,                       // Programming Page Size
+    FLASH_PAGE_SIZE,            // Programming Page Size
     0,                          // Reserved, must be 0
     0xFF,                       // Initial Content of Erased Memory
-    400,                        // Program Page Timeout 400 mSec
+    FLASH_PAGE_TIMEOUT,         // Program Page Timeout
     400,                        // Erase Sector Timeout 400 mSec
     // Specify Size and Address of Sectors
     0x800, 0x000000,            // Sector Size  2kB
@@ -92,14 +106,14 @@
 #ifdef STM32L4x_128
   struct FlashDevice const FlashDevice  =  {
     FLASH_DRV_VERS,             // Driver Version, do not modify!
-    "STM32L4xx 128 KB Flash",   // Device Name (256kB)
+    "STM32L4xx 128 KB Flash" FLASH_PAGE_NAME, // Device Name (256kB)
     ONCHIP,                     // Device Type
     0x08000000,                 // Device Start Address
     0x00020000,                 // Device Size in Bytes (128kB)
-    1024,                       // Programming Page Size
+    FLASH_PAGE_SIZE,            // Programming Page Size
     0,                          // Reserved, must be 0
     0xFF,                       // Initial Content of Erased Memory
-    400,                        // Program Page Timeout 400 mSec
+    FLASH_PAGE_TIMEOUT,         // Program Page Timeout
     400,                        // Erase Sector Timeout 400 mSec
     // Specify Size and Address of Sectors
     0x800, 0x000000,            // Sector Size  2kB
@@ -110,14 +124,14 @@
 #ifdef STM32L4x_64
   struct FlashDevice const FlashDevice  =  {
     FLASH_DRV_VERS,             // Driver Version, do not modify!
-    "STM32L4xx 64 KB Flash",   // Device Name (256kB)
+    "STM32L4xx 64 KB Flash" FLASH_PAGE_NAME, // Device Name (256kB)
     ONCHIP,                     // Device Type
     0x08000000,                 // Device Start Address
     0x00010000,                 // Device Size in Bytes (128kB)
-    1024,                       // Programming Page Size
+    FLASH_PAGE_SIZE,            // Programming Page Size
     0,                          // Reserved, must be 0
     0xFF,                       // Initial Content of Erased Memory
-    400,                        // Program Page Timeout 400 mSec
+    FLASH_PAGE_TIMEOUT,         // Program Page Timeout
     400,                        // Erase Sector Timeout 400 mSec
     // Specify Size and Address of Sectors
     0x800, 0x000000,            // Sector Size  2kB
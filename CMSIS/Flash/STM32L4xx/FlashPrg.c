@@ -18,13 +18,17 @@
  * 3. This notice may not be removed or altered from any source distribution.
  *
  *
- * $Date:        29. March 2017
- * $Revision:    V1.1.0
+ * $Date:        19. October 2026
+ * $Revision:    V1.3.0
  *
  * Project:      Flash Programming Functions for ST STM32L4xx Flash
  * --------------------------------------------------------------------------- */
 
 /* History:
+ *  Version 1.3.0
+ *    Added ProgramScatter, programming of a descriptor list of regions (STM32L4Scatter.c)
+ *  Version 1.2.0
+ *    Added Benchmark, throughput report over a corpus of images (STM32L4Bench.c)
  *  Version 1.1.0
  *    Added OPT Algorithms
  *  Version 1.0.0
@@ -32,6 +36,11 @@
  */
 
 #include "..\FlashOS.h"        // FlashOS Structures
+#include "..\Common\STM32L4Bench.h"
+#include "..\Common\STM32L4Trace.h"
+#include "..\Common\STM32L4Scatter.h"
+
+extern struct FlashDevice const FlashDevice;
 
 typedef volatile unsigned long    vu32;
 typedef          unsigned long     u32;
@@ -300,6 +309,8 @@ int Init (unsigned long adr, unsigned long clk, unsigned long fnc) {
     IWDG->RLR = 4095;                                   // Set reload value to 4095
   }
 
+  TRACE_HCLK (clk);                                     // The algorithm keeps the clock
+
   return (0);                                           // Done
 }
 
@@ -349,6 +360,8 @@ int BlankCheck (unsigned long adr, unsigned long sz, unsigned char pat) {
 #if defined FLASH_MEM
 int EraseChip (void) {
 
+  TRACE_BEGIN (TRACE_ERASE_CHIP, 0, 0);
+
   FLASH->SR  = FLASH_PGERR;                             // Reset Error Flags
 
   FLASH->CR  = (FLASH_MER1 | FLASH_MER2);               // Bank A/B Mass Erase Enabled
@@ -360,7 +373,7 @@ int EraseChip (void) {
 
   FLASH->CR  =  0;                                      // Reset CR
 
-  return (0);                                           // Done
+  return (TRACE_END (0));                               // Done
 }
 #endif // FLASH_MEM
 
@@ -408,6 +421,8 @@ int EraseChip (void) {
 int EraseSector (unsigned long adr) {
   unsigned long b, n;
 
+  TRACE_BEGIN (TRACE_ERASE_SECTOR, adr, 0x800);         // Sector Size 2kB
+
   b = GetBankNum(adr);                                  // Get Bank Number   0..1
   n = GetSecNum(adr);                                   // Get Sector Number 0..255 or 0..511
 
@@ -427,10 +442,10 @@ int EraseSector (unsigned long adr) {
 
   if (FLASH->SR & FLASH_PGERR) {                        // Check for Error
     FLASH->SR  = FLASH_PGERR;                           // Reset Error Flags
-    return (1);                                         // Failed
+    return (TRACE_END (1));                             // Failed
   }
 
-  return (0);                                           // Done
+  return (TRACE_END (0));                               // Done
 }
 #endif // FLASH_MEM
 
@@ -459,6 +474,9 @@ int ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf) {
   
 unsigned long tab[8];
 	int i;
+
+  TRACE_BEGIN (TRACE_PROGRAM, adr, sz);
+
   FLASH->SR  = FLASH_PGERR;                             // Reset Error Flags
   FLASH->CR  =  0;                                      // Reset CR
 
@@ -475,7 +493,7 @@ if(sz>=8){
 
     if (FLASH->SR & FLASH_PGERR) {                      // Check for Error
       FLASH->SR  = FLASH_PGERR;                         // Reset Error Flags
-      return (1);                                       // Failed
+      return (TRACE_END (1));                           // Failed
     }
 
     adr += 8;                                           // Go to next DoubleWord
@@ -504,11 +522,11 @@ sz =0;
 
     if (FLASH->SR & FLASH_PGERR) {                       /* Check for Error */
       FLASH->SR  = FLASH_PGERR;                          /* Reset Error Flags */
-      return (1);                                        /* Failed */
+      return (TRACE_END (1));                            /* Failed */
     }
   }
 }
-  return (0);                                           // Done
+  return (TRACE_END (0));                               // Done
 }
 #endif // FLASH_MEM || FLASH_OTP
 
@@ -645,3 +663,50 @@ unsigned long Verify (unsigned long adr, unsigned long sz, unsigned char *buf) {
   return (adr + sz);
 }
 #endif // FLASH_OPT
+
+/*
+ *  Program the Regions of a Descriptor List downloaded in one Buffer (STM32L4Scatter.c)
+ *    Parameter:      cnt:  Number of Descriptors
+ *                    sz:   Buffer Size (in bytes)
+ *                    buf:  Descriptors, then the Data of the Regions
+ *    Return Value:   0 - OK,  1 - Failed
+ *
+ *  The small sections of an image (vectors, configuration, calibration, code)
+ *  are programmed in one call instead of one ProgramPage call each. The
+ *  regions are erased before and double-word aligned.
+ */
+
+#if defined FLASH_MEM || defined FLASH_OTP
+int ProgramScatter (unsigned long cnt, unsigned long sz, unsigned char *buf) {
+
+  if (Scatter_Program (ProgramPage, cnt, sz, buf, FlashDevice.szPage, 8U) != 0U) {
+    return (1);                                         /* Failed */
+  }
+
+  return (0);                                           /* Done */
+}
+#endif // FLASH_MEM || FLASH_OTP
+
+/*
+ *  Benchmark the Programming Functions over a Corpus of Images (STM32L4Bench.c),
+ *  the Report is read from Bench_Report. The Flash Content is lost.
+ *    Parameter:      adr:  Start Address of the Images
+ *                    sz:   Size of the Images, 0 - whole Device
+ *                    clk:  HCLK Frequency (Hz), the algorithm keeps the clock
+ *    Return Value:   0 - OK,  1 - Failed
+ */
+
+#if defined FLASH_MEM && defined FLASH_BENCHMARK
+int Benchmark (unsigned long adr, unsigned long sz, unsigned long clk) {
+  // Read back instead of Verify, the commands are not counted
+  static const Bench_AlgoTypeDef algo = {
+    Init, UnInit, EraseSector, ProgramPage, NULL, NULL, NULL
+  };
+
+  if (Bench_Run (&algo, &FlashDevice, adr, sz, clk) != BENCH_OK) {
+    return (1);                                         // Failed
+  }
+
+  return (0);                                           // Done
+}
+#endif // FLASH_MEM && FLASH_BENCHMARK